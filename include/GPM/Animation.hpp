@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "Matrix4.hpp"
+#include "Transform.hpp"
+#include "SIMD.hpp"
+
+namespace GPM
+{
+
+// Key-frame track: key times sorted in increasing order, and one value per key.
+// Samples are clamped to the first and last keys, and interpolated linearly
+// in between (shortest-path normalized lerp for rotations).
+template<typename T>
+class KeyframeTrack
+{
+protected:
+    std::vector<f32> m_times;
+    std::vector<T>   m_values;
+
+    u32 findKey(const f32 time)                         const noexcept;
+
+public:
+    void        reserve     (const size_t count);
+    void        clear       ()                          noexcept;
+
+    // Keys can be added in any order, but appending in time order is O(1)
+    void        addKey      (const f32 time, const T& value);
+
+    size_t      size        ()                          const noexcept { return m_times.size(); }
+    bool        empty       ()                          const noexcept { return m_times.empty(); }
+    f32         startTime   ()                          const noexcept { return m_times.front(); }
+    f32         endTime     ()                          const noexcept { return m_times.back(); }
+    const f32*  times       ()                          const noexcept { return m_times.data(); }
+    const T*    values      ()                          const noexcept { return m_values.data(); }
+
+    // The track must not be empty. The second version starts from the key found
+    // by the previous sample: playing forward costs O(1) instead of a binary search.
+    // cursor must be 0 the first time.
+    T           sample      (const f32 time)            const noexcept;
+    T           sample      (const f32 time, u32& cursor) const noexcept;
+};
+
+using Vec3Track = KeyframeTrack<Vec3>;
+using QuatTrack = KeyframeTrack<Quat>;
+
+
+// Animated local transform of one bone. Empty tracks keep the identity value.
+struct TransformTrack
+{
+    Vec3Track position;
+    QuatTrack rotation;
+    Vec3Track scale;
+};
+
+
+// Parent index of the root bones
+constexpr u32 invalidBone{~0u};
+
+// Pose pipeline. Poses are arrays of local SplitTransforms, one per bone, and
+// bones are sorted so that parents come before their children. None of these
+// functions allocate.
+// - sampleTracks() samples count bone tracks at time, cursors holds 3 * count
+//   cursors, zeroed before the first call
+// - blendPoses() interpolates two poses, out may be a or b
+// - localMatrices() is the batched version of toTransform()
+// - modelMatrices() accumulates the local matrices down the hierarchy
+// - skinningPalette() multiplies model-space matrices with the inverse bind matrices
+void sampleTracks   (const TransformTrack* tracks, const f32 time,
+                     SplitTransform* pose, u32* cursors, const size_t count)    noexcept;
+void blendPoses     (const SplitTransform* a, const SplitTransform* b, const f32 t,
+                     SplitTransform* out, const size_t count)                   noexcept;
+void localMatrices  (const SplitTransform* pose, Mat4* out, const size_t count) noexcept;
+void modelMatrices  (const SplitTransform* pose, const u32* parents,
+                     Mat4* out, const size_t count)                             noexcept;
+void skinningPalette(const Mat4* model, const Mat4* inverseBind,
+                     Mat4* out, const size_t count)                             noexcept;
+
+#include "Animation.inl"
+
+} // End of namespace GPM
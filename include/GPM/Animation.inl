@@ -0,0 +1,241 @@
+/* =================== Interpolation =================== */
+namespace Keyframe
+{
+
+inline Vec3 interpolate(const Vec3& a, const Vec3& b, const f32 t) noexcept
+{
+    return a.lerp(b, t);
+}
+
+
+// Shortest-path normalized lerp: keys are close enough for it to follow slerp
+inline Quat interpolate(const Quat& a, const Quat& b, const f32 t) noexcept
+{
+    const f32 sign{a.dot(b) < .0f ? -1.f : 1.f};
+
+    return (a * ((1.f - t) * sign) + b * t).normalized();
+}
+
+} // End of namespace Keyframe
+
+
+
+
+/* =================== KeyframeTrack =================== */
+template<typename T>
+inline void KeyframeTrack<T>::reserve(const size_t count)
+{
+    m_times .reserve(count);
+    m_values.reserve(count);
+}
+
+
+template<typename T>
+inline void KeyframeTrack<T>::clear() noexcept
+{
+    m_times .clear();
+    m_values.clear();
+}
+
+
+template<typename T>
+inline void KeyframeTrack<T>::addKey(const f32 time, const T& value)
+{
+    if (m_times.empty() || time >= m_times.back())
+    {
+        m_times .push_back(time);
+        m_values.push_back(value);
+        return;
+    }
+
+    const size_t index{static_cast<size_t>(std::upper_bound(m_times.begin(), m_times.end(), time) - m_times.begin())};
+
+    m_times .insert(m_times.begin()  + index, time);
+    m_values.insert(m_values.begin() + index, value);
+}
+
+
+// Index of the key starting the segment that contains time,
+// for times strictly between the first and last keys
+template<typename T>
+inline u32 KeyframeTrack<T>::findKey(const f32 time) const noexcept
+{
+    return static_cast<u32>(std::upper_bound(m_times.begin(), m_times.end(), time) - m_times.begin()) - 1u;
+}
+
+
+template<typename T>
+inline T KeyframeTrack<T>::sample(const f32 time) const noexcept
+{
+    if (time <= m_times.front())
+        return m_values.front();
+
+    if (time >= m_times.back())
+        return m_values.back();
+
+    const u32 key{findKey(time)};
+    const f32 t  {(time - m_times[key]) / (m_times[key + 1u] - m_times[key])};
+
+    return Keyframe::interpolate(m_values[key], m_values[key + 1u], t);
+}
+
+
+template<typename T>
+inline T KeyframeTrack<T>::sample(const f32 time, u32& cursor) const noexcept
+{
+    if (time <= m_times.front())
+    {
+        cursor = 0u;
+        return m_values.front();
+    }
+
+    if (time >= m_times.back())
+    {
+        cursor = static_cast<u32>(m_times.size()) - 1u;
+        return m_values.back();
+    }
+
+    // Time is strictly inside the track: m_times[key + 1] exists for every
+    // key visited here. A few steps forward cover normal playback, anything
+    // else (seeking, looping, playing backward) falls back to a binary search.
+    constexpr u32 maxSteps{4u};
+    u32           key     {cursor};
+
+    if (key < m_times.size() && m_times[key] <= time)
+    {
+        u32 steps{0u};
+        while (m_times[key + 1u] <= time && steps++ < maxSteps)
+            ++key;
+
+        if (m_times[key + 1u] <= time)
+            key = findKey(time);
+    }
+    else
+    {
+        key = findKey(time);
+    }
+
+    cursor = key;
+
+    const f32 t{(time - m_times[key]) / (m_times[key + 1u] - m_times[key])};
+
+    return Keyframe::interpolate(m_values[key], m_values[key + 1u], t);
+}
+
+
+
+
+/* =================== Pose pipeline =================== */
+inline void sampleTracks(const TransformTrack* tracks, const f32 time,
+                         SplitTransform* pose, u32* cursors, const size_t count) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const TransformTrack& track{tracks[i]};
+        u32* const            cursor{cursors + 3u * i};
+
+        pose[i].rotation = track.rotation.empty() ? Quat::identity() : track.rotation.sample(time, cursor[0]);
+        pose[i].position = track.position.empty() ? Vec3::zero()     : track.position.sample(time, cursor[1]);
+        pose[i].scale    = track.scale   .empty() ? Vec3::one()      : track.scale   .sample(time, cursor[2]);
+    }
+}
+
+
+inline void blendPoses(const SplitTransform* a, const SplitTransform* b, const f32 t,
+                       SplitTransform* out, const size_t count) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+    {
+        out[i] =
+        {
+            Keyframe::interpolate(a[i].rotation, b[i].rotation, t),
+            Keyframe::interpolate(a[i].position, b[i].position, t),
+            Keyframe::interpolate(a[i].scale,    b[i].scale,    t)
+        };
+    }
+}
+
+
+// GPM_SIMD_WIDTH bones at a time: the transforms are gathered into one
+// register per component, and the matrices computed like toMatrix3(const Quat&)
+// and toTransform(const SplitTransform&) do, with every lane independent
+inline void localMatrices(const SplitTransform* pose, Mat4* out, const size_t count) noexcept
+{
+    alignas(GPM_SIMD_ALIGNMENT) f32 in [10][GPM_SIMD_WIDTH];
+    alignas(GPM_SIMD_ALIGNMENT) f32 res[9] [GPM_SIMD_WIDTH];
+
+    const SIMD::f32v one{SIMD::set1(1.f)}, two{SIMD::set1(2.f)};
+
+    for (size_t first{0u}; first < count; first += GPM_SIMD_WIDTH)
+    {
+        const size_t size{count - first < GPM_SIMD_WIDTH ? count - first : GPM_SIMD_WIDTH};
+
+        for (size_t lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        {
+            // Padding lanes hold the identity transform
+            const SplitTransform& transfo{pose[first + (lane < size ? lane : 0u)]};
+            const bool            used   {lane < size};
+
+            in[0][lane] = used ? transfo.rotation.x : .0f;
+            in[1][lane] = used ? transfo.rotation.y : .0f;
+            in[2][lane] = used ? transfo.rotation.z : .0f;
+            in[3][lane] = used ? transfo.rotation.w : 1.f;
+            in[4][lane] = transfo.position.x;
+            in[5][lane] = transfo.position.y;
+            in[6][lane] = transfo.position.z;
+            in[7][lane] = transfo.scale.x;
+            in[8][lane] = transfo.scale.y;
+            in[9][lane] = transfo.scale.z;
+        }
+
+        const SIMD::f32v x{SIMD::load(in[0])}, y{SIMD::load(in[1])}, z{SIMD::load(in[2])}, w{SIMD::load(in[3])};
+        const SIMD::f32v sx{SIMD::load(in[7])}, sy{SIMD::load(in[8])}, sz{SIMD::load(in[9])};
+
+        const SIMD::f32v x2{SIMD::mul(x, x)}, y2{SIMD::mul(y, y)}, z2{SIMD::mul(z, z)},
+                         xy{SIMD::mul(x, y)}, yz{SIMD::mul(y, z)}, xz{SIMD::mul(x, z)},
+                         wx{SIMD::mul(w, x)}, wy{SIMD::mul(w, y)}, wz{SIMD::mul(w, z)};
+        const SIMD::f32v s_2{SIMD::div(two, SIMD::add(SIMD::add(x2, y2), SIMD::add(z2, SIMD::mul(w, w))))};
+
+        SIMD::store(res[0],  SIMD::mul(SIMD::sub(one, SIMD::mul(s_2, SIMD::add(y2, z2))), sx));
+        SIMD::store(res[1],  SIMD::mul(SIMD::mul(s_2, SIMD::add(xy, wz)), sx));
+        SIMD::store(res[2],  SIMD::mul(SIMD::mul(s_2, SIMD::sub(xz, wy)), sx));
+        SIMD::store(res[3],  SIMD::mul(SIMD::mul(s_2, SIMD::sub(xy, wz)), sy));
+        SIMD::store(res[4],  SIMD::mul(SIMD::sub(one, SIMD::mul(s_2, SIMD::add(x2, z2))), sy));
+        SIMD::store(res[5],  SIMD::mul(SIMD::mul(s_2, SIMD::add(yz, wx)), sy));
+        SIMD::store(res[6],  SIMD::mul(SIMD::mul(s_2, SIMD::add(xz, wy)), sz));
+        SIMD::store(res[7],  SIMD::mul(SIMD::mul(s_2, SIMD::sub(yz, wx)), sz));
+        SIMD::store(res[8],  SIMD::mul(SIMD::sub(one, SIMD::mul(s_2, SIMD::add(x2, y2))), sz));
+
+        for (size_t lane{0u}; lane < size; ++lane)
+        {
+            out[first + lane] =
+            {
+                res[0][lane], res[1][lane], res[2][lane], .0f,
+                res[3][lane], res[4][lane], res[5][lane], .0f,
+                res[6][lane], res[7][lane], res[8][lane], .0f,
+                in[4][lane],  in[5][lane],  in[6][lane],  1.f
+            };
+        }
+    }
+}
+
+
+inline void modelMatrices(const SplitTransform* pose, const u32* parents, Mat4* out, const size_t count) noexcept
+{
+    localMatrices(pose, out, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        if (parents[i] != invalidBone)
+            out[i] = out[parents[i]].multiplyAffine(out[i]);
+    }
+}
+
+
+inline void skinningPalette(const Mat4* model, const Mat4* inverseBind, Mat4* out, const size_t count) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+    {
+        out[i] = model[i].multiplyAffine(inverseBind[i]);
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Frustum.hpp"
+#include "JobSystem.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/Segment.hpp"
+#include "Shape3D/Sphere.hpp"
+
+namespace GPM
+{
+
+// Node of a flattened BVH, 32 bytes, stored in depth-first order: the first child
+// of an internal node directly follows it and index is the second one. A leaf
+// holds count primitives from index in BVH::primitiveIndices().
+struct BVHNode
+{
+    Vec3 min;
+    u32  index;
+    Vec3 max;
+    u32  count;
+
+    bool isLeaf() const noexcept { return count != 0u; }
+};
+
+// Min and max corners of a primitive, in leaf order
+struct BVHBounds
+{
+    Vec3 min;
+    Vec3 max;
+};
+
+// Primitive index and parameter of the point origin + t * direction where the
+// ray enters its box, 0 when the origin is inside
+struct BVHHit
+{
+    u32 index;
+    f32 t;
+};
+
+// Static bounding-volume hierarchy over AABBs. Leaves hold up to maxLeafSize
+// primitives, and the primitives of any subtree are contiguous in leaf order:
+// a subtree of nodes [n, end) covers the primitives from the first leaf after n
+// to the end of node end - 1, its last leaf.
+class BVH
+{
+protected:
+    std::vector<BVHNode>   m_nodes;
+    std::vector<BVHBounds> m_bounds;
+    std::vector<u32>       m_indices;
+
+    void build              (const AABB* bounds, const size_t count, JobSystem* jobs);
+    void appendPrimitives   (const u32 node, const u32 end, u32* out, size_t& size) const noexcept;
+
+    // Calls visit(i) for every primitive i whose box and the boxes of its
+    // ancestors pass overlaps(min, max)
+    template<typename O, typename F>
+    void traverse           (O&& overlaps, F&& visit)                   const noexcept;
+
+public:
+    // Traversals use fixed-size stacks, builds never go deeper
+    static constexpr u32 maxDepth   {64u};
+    static constexpr u32 maxLeafSize{4u};
+
+    // Constructors
+    BVH()                                                               = default;
+    BVH(const AABB* bounds, const size_t count);
+    BVH(const AABB* bounds, const size_t count, JobSystem& jobs);
+
+    // Builds the tree over the primitives [0, count) with the surface area
+    // heuristic, evaluated on 16 bins per axis (Wald 2007). The parallel build
+    // bins the large nodes near the root in chunks, then builds the subtrees
+    // below them as independent jobs, and falls back to the serial build when
+    // jobs has no workers. Both give the same tree.
+    void              build             (const AABB* bounds, const size_t count);
+    void              build             (const AABB* bounds, const size_t count,
+                                         JobSystem& jobs);
+
+    // Storage
+    bool              empty             ()                              const noexcept { return m_nodes.empty(); }
+    size_t            nodeCount         ()                              const noexcept { return m_nodes.size(); }
+    size_t            primitiveCount    ()                              const noexcept { return m_indices.size(); }
+    const BVHNode*    nodes             ()                              const noexcept { return m_nodes.data(); }
+    const BVHBounds*  primitiveBounds   ()                              const noexcept { return m_bounds.data(); }
+    const u32*        primitiveIndices  ()                              const noexcept { return m_indices.data(); }
+
+    // Hierarchical frustum culling: writes the indices of the primitives that
+    // may be visible to out, in leaf order, and returns their count. out must
+    // hold primitiveCount() elements.
+    // Every node hands its children the planes it straddles, subtrees entirely
+    // inside the frustum are copied without further tests, and planeCache,
+    // nodeCount() bytes kept from one frame to the next (zeroed the first time),
+    // holds the plane that rejected each node. It may be null.
+    size_t            cull              (const Frustum& frustum, u32* out,
+                                         u8* planeCache = nullptr)      const noexcept;
+
+    // Ray queries against the primitive boxes, for the ray origin + t * direction
+    // with t in [0, tMax], or the segment with t in [0, 1]. direction needn't be
+    // normalized. The closest versions return false when nothing is hit.
+    bool              raycast           (const Vec3& origin, const Vec3& direction,
+                                         const f32 tMax, BVHHit& hit)   const noexcept;
+    bool              raycast           (const Segment& segment,
+                                         BVHHit& hit)                   const noexcept;
+
+    // Overlap queries: the first capacity results are written to hits or out,
+    // in no particular order, and the total count is returned, so a count above
+    // capacity means that the buffer was too small. Nothing is allocated.
+    size_t            raycast           (const Vec3& origin, const Vec3& direction,
+                                         const f32 tMax, BVHHit* hits,
+                                         const size_t capacity)         const noexcept;
+    size_t            raycast           (const Segment& segment, BVHHit* hits,
+                                         const size_t capacity)         const noexcept;
+    size_t            overlap           (const AABB& aabb, u32* out,
+                                         const size_t capacity)         const noexcept;
+    size_t            overlap           (const Sphere& sphere, u32* out,
+                                         const size_t capacity)         const noexcept;
+};
+
+#include "BVH.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,763 @@
+/* =================== Build helpers =================== */
+namespace BVHBuild
+{
+
+constexpr u32 binCount{16u};
+
+// Nodes of the top of the tree with more primitives are binned by several
+// threads, in chunks: until the subtree tasks start, the other threads are idle
+constexpr u32 parallelBinningSize{65536u};
+constexpr u32 chunkSize          {16384u};
+
+// Primitive as seen by the build. The references are reordered along with the
+// partitions, so that every pass over a node reads a contiguous range.
+struct Reference
+{
+    BVHBounds bounds;
+    Vec3      center;
+    u32       primitive;
+};
+
+// Bounds of a set of primitives and of their centers
+struct Extent
+{
+    Vec3 min      {std::numeric_limits<f32>::infinity()};
+    Vec3 max      {-std::numeric_limits<f32>::infinity()};
+    Vec3 centerMin{std::numeric_limits<f32>::infinity()};
+    Vec3 centerMax{-std::numeric_limits<f32>::infinity()};
+    u32  count    {0u};
+
+    void add(const Reference& reference) noexcept
+    {
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            min.e[axis]       = std::min(min.e[axis],       reference.bounds.min.e[axis]);
+            max.e[axis]       = std::max(max.e[axis],       reference.bounds.max.e[axis]);
+            centerMin.e[axis] = std::min(centerMin.e[axis], reference.center.e[axis]);
+            centerMax.e[axis] = std::max(centerMax.e[axis], reference.center.e[axis]);
+        }
+
+        ++count;
+    }
+};
+
+// Bounds and count of the primitives binned together. The SAH sweep doesn't need
+// the bounds of the centers, the children get theirs once the node is partitioned.
+struct Bin
+{
+    Vec3 min  {std::numeric_limits<f32>::infinity()};
+    Vec3 max  {-std::numeric_limits<f32>::infinity()};
+    u32  count{0u};
+
+    void add(const BVHBounds& bounds) noexcept
+    {
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            min.e[axis] = std::min(min.e[axis], bounds.min.e[axis]);
+            max.e[axis] = std::max(max.e[axis], bounds.max.e[axis]);
+        }
+
+        ++count;
+    }
+
+    void add(const Bin& other) noexcept
+    {
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            min.e[axis] = std::min(min.e[axis], other.min.e[axis]);
+            max.e[axis] = std::max(max.e[axis], other.max.e[axis]);
+        }
+
+        count += other.count;
+    }
+};
+
+
+inline f32 halfArea(const Vec3& min, const Vec3& max) noexcept
+{
+    const Vec3 size{max - min};
+    return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+
+struct Bins
+{
+    Bin bins[3][binCount];
+};
+
+
+// References shared by the build jobs, each job owns a disjoint range of them
+struct Builder
+{
+    Reference* references;
+    JobSystem* jobs;
+
+    Extent extentOf(const u32 first, const u32 count) const noexcept
+    {
+        Extent extent;
+        for (u32 i{first}; i < first + count; ++i)
+            extent.add(references[i]);
+
+        return extent;
+    }
+
+    void binRange(const u32 first, const u32 count, const Vec3& offset, const Vec3& scale, Bins& bins) const noexcept
+    {
+        for (u32 i{first}; i < first + count; ++i)
+        {
+            const Reference& reference{references[i]};
+
+            for (u32 axis{0u}; axis < 3u; ++axis)
+                bins.bins[axis][binOf(reference.center, axis, offset, scale)].add(reference.bounds);
+        }
+    }
+
+    static u32 binOf(const Vec3& center, const u32 axis, const Vec3& offset, const Vec3& scale) noexcept
+    {
+        const u32 bin{static_cast<u32>((center.e[axis] - offset.e[axis]) * scale.e[axis])};
+        return bin < binCount ? bin : binCount - 1u;
+    }
+
+    // Object median along the longest axis of the centers, for degenerate nodes
+    // and near the depth limit, where it bounds the depth left to log2(count)
+    void splitMedian(const u32 first, const Extent& extent, Extent& left, Extent& right) const
+    {
+        const Vec3 spread{extent.centerMax - extent.centerMin};
+        const u32  axis  {spread.x >= spread.y && spread.x >= spread.z ? 0u : (spread.y >= spread.z ? 1u : 2u)};
+        const u32  half  {extent.count / 2u};
+
+        Reference* const begin{references + first};
+        std::nth_element(begin, begin + half, begin + extent.count, [axis](const Reference& a, const Reference& b)
+        {
+            return a.center.e[axis] < b.center.e[axis];
+        });
+
+        left  = extentOf(first, half);
+        right = extentOf(first + half, extent.count - half);
+    }
+
+    // Splits the primitives [first, first + extent.count) in two with the lowest
+    // SAH cost, or returns false when they make a cheaper leaf
+    bool split(const u32 first, const Extent& extent, const u32 depth, Extent& left, Extent& right) const
+    {
+        const u32 count{extent.count};
+
+        if (count == 1u || depth + 1u >= BVH::maxDepth)
+            return false;
+
+        if (depth + 33u >= BVH::maxDepth)
+        {
+            if (count <= BVH::maxLeafSize)
+                return false;
+
+            splitMedian(first, extent, left, right);
+            return true;
+        }
+
+        Vec3 scale;
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            const f32 spread{extent.centerMax.e[axis] - extent.centerMin.e[axis]};
+            scale.e[axis] = spread > .0f ? static_cast<f32>(binCount) / spread : .0f;
+        }
+
+        Bins bins;
+        if (jobs && count >= parallelBinningSize)
+        {
+            std::vector<Bins> chunks((count + chunkSize - 1u) / chunkSize);
+
+            jobs->parallelFor(static_cast<u32>(chunks.size()), 1u, [&](const u32 begin, const u32 end)
+            {
+                for (u32 chunk{begin}; chunk < end; ++chunk)
+                {
+                    const u32 offset{chunk * chunkSize};
+                    binRange(first + offset, std::min(chunkSize, count - offset), extent.centerMin, scale, chunks[chunk]);
+                }
+            });
+
+            for (const Bins& chunk : chunks)
+                for (u32 axis{0u}; axis < 3u; ++axis)
+                    for (u32 bin{0u}; bin < binCount; ++bin)
+                        bins.bins[axis][bin].add(chunk.bins[axis][bin]);
+        }
+        else
+        {
+            binRange(first, count, extent.centerMin, scale, bins);
+        }
+
+        // Sweep from both ends: cost of the split before bin b = area(left) * count(left) + same on the right
+        f32 bestCost{std::numeric_limits<f32>::infinity()};
+        u32 bestAxis{0u}, bestBin{0u};
+
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            if (scale.e[axis] == .0f)
+                continue;
+
+            f32 rightCosts[binCount];
+            Bin accumulated;
+
+            for (u32 bin{binCount - 1u}; bin > 0u; --bin)
+            {
+                accumulated.add(bins.bins[axis][bin]);
+                rightCosts[bin] = accumulated.count > 0u ? halfArea(accumulated.min, accumulated.max) * static_cast<f32>(accumulated.count)
+                                                         : std::numeric_limits<f32>::infinity();
+            }
+
+            accumulated = {};
+            for (u32 bin{1u}; bin < binCount; ++bin)
+            {
+                accumulated.add(bins.bins[axis][bin - 1u]);
+                if (accumulated.count == 0u)
+                    continue;
+
+                const f32 cost{halfArea(accumulated.min, accumulated.max) * static_cast<f32>(accumulated.count) + rightCosts[bin]};
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin  = bin;
+                }
+            }
+        }
+
+        // All the centers in one bin: nothing to separate them
+        if (bestBin == 0u)
+        {
+            if (count <= BVH::maxLeafSize)
+                return false;
+
+            splitMedian(first, extent, left, right);
+            return true;
+        }
+
+        // Traversal step against one test per primitive, relative to the area of the node
+        const f32 area{halfArea(extent.min, extent.max)};
+        if (count <= BVH::maxLeafSize && static_cast<f32>(count) * area <= area + bestCost)
+            return false;
+
+        Reference* const begin {references + first};
+        Reference* const middle{std::partition(begin, begin + count, [&](const Reference& reference)
+        {
+            return binOf(reference.center, bestAxis, extent.centerMin, scale) < bestBin;
+        })};
+
+        const u32 leftCount{static_cast<u32>(middle - begin)};
+        left  = extentOf(first, leftCount);
+        right = extentOf(first + leftCount, count - leftCount);
+
+        return true;
+    }
+
+    // Depth-first subtree, appended to nodes
+    void buildSubtree(const u32 first, const Extent& extent, const u32 depth, std::vector<BVHNode>& nodes) const
+    {
+        const u32 node{static_cast<u32>(nodes.size())};
+        nodes.emplace_back();
+
+        Extent left, right;
+        if (!split(first, extent, depth, left, right))
+        {
+            nodes[node] = {extent.min, first, extent.max, extent.count};
+            return;
+        }
+
+        buildSubtree(first, left, depth + 1u, nodes);
+        const u32 second{static_cast<u32>(nodes.size())};
+        buildSubtree(first + left.count, right, depth + 1u, nodes);
+
+        nodes[node] = {extent.min, second, extent.max, 0u};
+    }
+};
+
+
+// Parallel build: the top of the tree is split until the nodes are small enough
+// to be built as independent tasks, then spliced with the task subtrees
+struct Task
+{
+    u32                  first;
+    Extent               extent;
+    u32                  depth;
+    std::vector<BVHNode> nodes;
+};
+
+struct TopNode
+{
+    BVHNode node;
+    u32     task;
+};
+
+constexpr u32 noTask{~0u};
+
+
+inline void buildTop(const Builder& builder, const u32 first, const Extent& extent, const u32 depth, const u32 taskSize,
+                     std::vector<TopNode>& top, std::vector<Task>& tasks)
+{
+    const u32 node{static_cast<u32>(top.size())};
+
+    if (extent.count <= taskSize)
+    {
+        top.push_back({{}, static_cast<u32>(tasks.size())});
+        tasks.push_back({first, extent, depth, {}});
+        return;
+    }
+
+    top.emplace_back();
+
+    Extent left, right;
+    if (!builder.split(first, extent, depth, left, right))
+    {
+        top[node] = {{extent.min, first, extent.max, extent.count}, noTask};
+        return;
+    }
+
+    buildTop(builder, first, left, depth + 1u, taskSize, top, tasks);
+    const u32 second{static_cast<u32>(top.size())};
+    buildTop(builder, first + left.count, right, depth + 1u, taskSize, top, tasks);
+
+    top[node] = {{extent.min, second, extent.max, 0u}, noTask};
+}
+
+
+inline void flatten(const std::vector<TopNode>& top, const std::vector<Task>& tasks, const u32 index,
+                    std::vector<BVHNode>& nodes)
+{
+    const TopNode& current{top[index]};
+
+    if (current.task != noTask)
+    {
+        // Second children are offset by the position of the subtree
+        const u32 base{static_cast<u32>(nodes.size())};
+        for (BVHNode node : tasks[current.task].nodes)
+        {
+            if (!node.isLeaf())
+                node.index += base;
+
+            nodes.push_back(node);
+        }
+        return;
+    }
+
+    const u32 node{static_cast<u32>(nodes.size())};
+    nodes.push_back(current.node);
+
+    if (current.node.isLeaf())
+        return;
+
+    flatten(top, tasks, index + 1u, nodes);
+    nodes[node].index = static_cast<u32>(nodes.size());
+    flatten(top, tasks, current.node.index, nodes);
+}
+
+} // End of namespace BVHBuild
+
+
+
+
+/* =================== Constructors =================== */
+inline BVH::BVH(const AABB* bounds, const size_t count)
+{
+    build(bounds, count, nullptr);
+}
+
+
+inline BVH::BVH(const AABB* bounds, const size_t count, JobSystem& jobs)
+{
+    build(bounds, count, &jobs);
+}
+
+
+
+
+/* =================== Build =================== */
+inline void BVH::build(const AABB* bounds, const size_t count)
+{
+    build(bounds, count, nullptr);
+}
+
+
+inline void BVH::build(const AABB* bounds, const size_t count, JobSystem& jobs)
+{
+    build(bounds, count, &jobs);
+}
+
+
+inline void BVH::build(const AABB* bounds, const size_t count, JobSystem* jobs)
+{
+    m_nodes.clear();
+    m_bounds.resize(count);
+    m_indices.resize(count);
+
+    if (count == 0u)
+        return;
+
+    std::vector<BVHBuild::Reference> references(count);
+    for (size_t i{0u}; i < count; ++i)
+    {
+        references[i] = {{bounds[i].center - bounds[i].extents, bounds[i].center + bounds[i].extents},
+                         bounds[i].center, static_cast<u32>(i)};
+    }
+
+    const BVHBuild::Builder builder{references.data(), jobs};
+    const BVHBuild::Extent  extent {builder.extentOf(0u, static_cast<u32>(count))};
+
+    // A full binary tree with leaves of about maxLeafSize / 2 primitives or more
+    m_nodes.reserve(4u * count / maxLeafSize + 1u);
+
+    if (jobs && jobs->workerCount() > 0u)
+    {
+        // A few tasks per thread for the load balancing, large enough to amortize the splicing
+        const u32 threadCount{jobs->workerCount() + 1u};
+        const u32 taskSize   {std::max(static_cast<u32>(count / (8u * threadCount)), 4096u)};
+
+        std::vector<BVHBuild::TopNode> top;
+        std::vector<BVHBuild::Task>    tasks;
+        BVHBuild::buildTop(builder, 0u, extent, 0u, taskSize, top, tasks);
+
+        // The tasks already occupy every thread, binning them in chunks would only
+        // add jobs to the queues
+        const BVHBuild::Builder serial{references.data(), nullptr};
+
+        jobs->parallelFor(static_cast<u32>(tasks.size()), 1u, [&](const u32 begin, const u32 end)
+        {
+            for (u32 i{begin}; i < end; ++i)
+                serial.buildSubtree(tasks[i].first, tasks[i].extent, tasks[i].depth, tasks[i].nodes);
+        });
+
+        BVHBuild::flatten(top, tasks, 0u, m_nodes);
+    }
+    else
+    {
+        builder.buildSubtree(0u, extent, 0u, m_nodes);
+    }
+
+    // The references are in leaf order: bounds next to each other for the leaf tests
+    for (size_t i{0u}; i < count; ++i)
+    {
+        m_bounds[i]  = references[i].bounds;
+        m_indices[i] = references[i].primitive;
+    }
+}
+
+
+
+
+/* =================== Frustum culling =================== */
+inline void BVH::appendPrimitives(const u32 node, const u32 end, u32* out, size_t& size) const noexcept
+{
+    u32 firstLeaf{node};
+    while (!m_nodes[firstLeaf].isLeaf())
+        ++firstLeaf;
+
+    const u32 first{m_nodes[firstLeaf].index};
+    const u32 last {m_nodes[end - 1u].index + m_nodes[end - 1u].count};
+
+    std::memcpy(out + size, m_indices.data() + first, (last - first) * sizeof(u32));
+    size += last - first;
+}
+
+
+inline size_t BVH::cull(const Frustum& frustum, u32* out, u8* planeCache) const noexcept
+{
+    if (m_nodes.empty())
+        return 0u;
+
+    // Nodes to visit, with the end of their subtree and the planes they may straddle
+    struct Entry
+    {
+        u32 node;
+        u32 end;
+        u32 planeMask;
+    };
+
+    Entry  stack[maxDepth];
+    u32    top {0u};
+    size_t size{0u};
+
+    stack[top++] = {0u, static_cast<u32>(m_nodes.size()), Frustum::allPlanes};
+
+    while (top > 0u)
+    {
+        Entry entry{stack[--top]};
+
+        // Down the first children, the second ones are pushed on the way
+        for (;;)
+        {
+            const BVHNode& node{m_nodes[entry.node]};
+
+            u8 lastPlane{planeCache ? planeCache[entry.node] : u8{0u}};
+            if (frustum.classify(node.min, node.max, entry.planeMask, lastPlane) == EFrustumTest::Outside)
+            {
+                if (planeCache)
+                    planeCache[entry.node] = lastPlane;
+                break;
+            }
+
+            if (entry.planeMask == 0u)
+            {
+                appendPrimitives(entry.node, entry.end, out, size);
+                break;
+            }
+
+            if (node.isLeaf())
+            {
+                for (u32 i{node.index}; i < node.index + node.count; ++i)
+                {
+                    u32 planeMask{entry.planeMask};
+                    u8  unused   {lastPlane};
+
+                    if (frustum.classify(m_bounds[i].min, m_bounds[i].max, planeMask, unused) != EFrustumTest::Outside)
+                        out[size++] = m_indices[i];
+                }
+                break;
+            }
+
+            stack[top++] = {node.index, entry.end, entry.planeMask};
+            entry        = {entry.node + 1u, node.index, entry.planeMask};
+        }
+    }
+
+    return size;
+}
+
+
+
+
+/* =================== Queries =================== */
+namespace BVHQuery
+{
+
+// Slab test of the ray origin + t * direction, t in [0, tMax], against a box:
+// entry receives the parameter where the ray enters it
+inline bool slab(const Vec3& min, const Vec3& max, const Vec3& origin, const Vec3& inverseDirection,
+                 const f32 tMax, f32& entry) noexcept
+{
+    f32 tNear{.0f}, tFar{tMax};
+
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        const f32 t0{(min.e[axis] - origin.e[axis]) * inverseDirection.e[axis]};
+        const f32 t1{(max.e[axis] - origin.e[axis]) * inverseDirection.e[axis]};
+
+        // Written so that the NaN of a ray parallel to a face that starts on it is ignored
+        tNear = t0 < t1 ? (t0 > tNear ? t0 : tNear) : (t1 > tNear ? t1 : tNear);
+        tFar  = t0 < t1 ? (t1 < tFar  ? t1 : tFar)  : (t0 < tFar  ? t0 : tFar);
+    }
+
+    entry = tNear;
+    return tNear <= tFar;
+}
+
+
+inline Vec3 inverse(const Vec3& direction) noexcept
+{
+    return {1.f / direction.x, 1.f / direction.y, 1.f / direction.z};
+}
+
+} // End of namespace BVHQuery
+
+
+template<typename O, typename F>
+inline void BVH::traverse(O&& overlaps, F&& visit) const noexcept
+{
+    if (m_nodes.empty())
+        return;
+
+    u32 stack[maxDepth];
+    u32 top {0u};
+    u32 node{0u};
+
+    for (;;)
+    {
+        const BVHNode& current{m_nodes[node]};
+
+        if (overlaps(current.min, current.max))
+        {
+            if (!current.isLeaf())
+            {
+                stack[top++] = current.index;
+                ++node;
+                continue;
+            }
+
+            for (u32 i{current.index}; i < current.index + current.count; ++i)
+                if (overlaps(m_bounds[i].min, m_bounds[i].max))
+                    visit(i);
+        }
+
+        if (top == 0u)
+            return;
+
+        node = stack[--top];
+    }
+}
+
+
+inline bool BVH::raycast(const Vec3& origin, const Vec3& direction, const f32 tMax, BVHHit& hit) const noexcept
+{
+    if (m_nodes.empty())
+        return false;
+
+    const Vec3 inverseDirection{BVHQuery::inverse(direction)};
+
+    // Nodes to visit and the parameter where the ray enters them, the nearest child on top
+    struct Entry
+    {
+        u32 node;
+        f32 t;
+    };
+
+    Entry stack[maxDepth];
+    u32   top     {0u};
+    f32   closest {tMax};
+    bool  found   {false};
+    f32   t;
+
+    if (!BVHQuery::slab(m_nodes[0].min, m_nodes[0].max, origin, inverseDirection, closest, t))
+        return false;
+
+    stack[top++] = {0u, t};
+
+    while (top > 0u)
+    {
+        const Entry entry{stack[--top]};
+
+        // Hits found since the node was pushed may be closer than its box
+        if (entry.t > closest)
+            continue;
+
+        const BVHNode& node{m_nodes[entry.node]};
+
+        if (node.isLeaf())
+        {
+            for (u32 i{node.index}; i < node.index + node.count; ++i)
+            {
+                if (BVHQuery::slab(m_bounds[i].min, m_bounds[i].max, origin, inverseDirection, closest, t) &&
+                    (!found || t < closest))
+                {
+                    closest = t;
+                    hit     = {m_indices[i], t};
+                    found   = true;
+                }
+            }
+            continue;
+        }
+
+        const u32 first {entry.node + 1u};
+        const u32 second{node.index};
+        f32       tFirst, tSecond;
+
+        const bool hitFirst {BVHQuery::slab(m_nodes[first].min,  m_nodes[first].max,  origin, inverseDirection, closest, tFirst)};
+        const bool hitSecond{BVHQuery::slab(m_nodes[second].min, m_nodes[second].max, origin, inverseDirection, closest, tSecond)};
+
+        if (hitFirst && hitSecond)
+        {
+            if (tFirst <= tSecond)
+            {
+                stack[top++] = {second, tSecond};
+                stack[top++] = {first,  tFirst};
+            }
+            else
+            {
+                stack[top++] = {first,  tFirst};
+                stack[top++] = {second, tSecond};
+            }
+        }
+        else if (hitFirst)
+        {
+            stack[top++] = {first, tFirst};
+        }
+        else if (hitSecond)
+        {
+            stack[top++] = {second, tSecond};
+        }
+    }
+
+    return found;
+}
+
+
+inline bool BVH::raycast(const Segment& segment, BVHHit& hit) const noexcept
+{
+    return raycast(segment.getPt1(), segment.getPt2() - segment.getPt1(), 1.f, hit);
+}
+
+
+inline size_t BVH::raycast(const Vec3& origin, const Vec3& direction, const f32 tMax,
+                           BVHHit* hits, const size_t capacity) const noexcept
+{
+    const Vec3 inverseDirection{BVHQuery::inverse(direction)};
+    size_t     count{0u};
+    f32        t;
+
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        return BVHQuery::slab(min, max, origin, inverseDirection, tMax, t);
+    },
+    [&](const u32 i)
+    {
+        if (count < capacity)
+            hits[count] = {m_indices[i], t};
+        ++count;
+    });
+
+    return count;
+}
+
+
+inline size_t BVH::raycast(const Segment& segment, BVHHit* hits, const size_t capacity) const noexcept
+{
+    return raycast(segment.getPt1(), segment.getPt2() - segment.getPt1(), 1.f, hits, capacity);
+}
+
+
+inline size_t BVH::overlap(const AABB& aabb, u32* out, const size_t capacity) const noexcept
+{
+    const Vec3 queryMin{aabb.center - aabb.extents};
+    const Vec3 queryMax{aabb.center + aabb.extents};
+    size_t     count{0u};
+
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        return min.x <= queryMax.x && max.x >= queryMin.x &&
+               min.y <= queryMax.y && max.y >= queryMin.y &&
+               min.z <= queryMax.z && max.z >= queryMin.z;
+    },
+    [&](const u32 i)
+    {
+        if (count < capacity)
+            out[count] = m_indices[i];
+        ++count;
+    });
+
+    return count;
+}
+
+
+inline size_t BVH::overlap(const Sphere& sphere, u32* out, const size_t capacity) const noexcept
+{
+    const Vec3 center       {sphere.getCenter()};
+    const f32  squaredRadius{sphere.getRadius() * sphere.getRadius()};
+    size_t     count{0u};
+
+    // Squared distance from the center to the closest point of the box
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        f32 squaredDistance{.0f};
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            const f32 offset{std::max(min.e[axis] - center.e[axis], .0f) + std::max(center.e[axis] - max.e[axis], .0f)};
+            squaredDistance += offset * offset;
+        }
+
+        return squaredDistance <= squaredRadius;
+    },
+    [&](const u32 i)
+    {
+        if (count < capacity)
+            out[count] = m_indices[i];
+        ++count;
+    });
+
+    return count;
+}
@@ -8,7 +8,11 @@
 #endif
 
 #include "Types.hpp"
+#include "constants.hpp"
+#include "SIMD.hpp"
 #include <math.h>
+#include <cstddef>
+#include <type_traits>
 
 namespace GPM
 {
@@ -20,6 +24,75 @@ bool f32AreEqual(const f32 a, const f32 b, const f32 eps);
 
 f32 lerpf(const f32 a, const f32 b, const f32 alpha);
 
+
+// Accuracy tier of the Math functions below. Both tiers share the range
+// reductions, Fast evaluates shorter polynomials. Maximum errors measured
+// against libm in double precision, over the whole domain:
+//
+//  function  domain                    Precise                         Fast
+//  sin, cos  any (*)                   1.5 ulp for |x| < 4, 1e-7 abs   1.5e-6 absolute
+//  acos      [-1, 1] (clamped)         1.5 ulp                         7e-5 absolute
+//  atan2     finite, (0, 0) gives 0    3.5 ulp                         1.2e-5 absolute
+//  exp       finite (**)               1.5 ulp                         6e-6 relative
+//  log       finite, x > 0 (***)       1 ulp                           1.3e-5 relative, 1.2e-5 absolute
+//  rsqrt     x > 0                     1.5 ulp                         5e-6 relative
+//
+//  (*)   Fast is only accurate for |x| <= 8192, Precise falls back to sinf / cosf above
+//  (**)  0 below ln(FLT_MIN), +inf above ln(FLT_MAX): results that would be denormal are flushed to 0
+//  (***) log(0) = -inf, log(x < 0) = NaN, denormals are not supported
+enum class EPrecision
+{
+    Precise,
+    Fast
+};
+
+namespace Math
+{
+
+template<EPrecision P = EPrecision::Precise> f32  sin   (const f32 x)                   noexcept;
+template<EPrecision P = EPrecision::Precise> f32  cos   (const f32 x)                   noexcept;
+template<EPrecision P = EPrecision::Precise> void sincos(const f32 x, f32& s, f32& c)   noexcept;
+template<EPrecision P = EPrecision::Precise> f32  acos  (const f32 x)                   noexcept;
+template<EPrecision P = EPrecision::Precise> f32  atan2 (const f32 y, const f32 x)      noexcept;
+template<EPrecision P = EPrecision::Precise> f32  exp   (const f32 x)                   noexcept;
+template<EPrecision P = EPrecision::Precise> f32  log   (const f32 x)                   noexcept;
+template<EPrecision P = EPrecision::Precise> f32  rsqrt (const f32 x)                   noexcept;
+
+// Batched versions, GPM_SIMD_WIDTH values per iteration. out may be the input array.
+template<EPrecision P = EPrecision::Precise>
+void sin    (const f32* in, f32* out, const size_t count)                               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void cos    (const f32* in, f32* out, const size_t count)                               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void sincos (const f32* in, f32* outSin, f32* outCos, const size_t count)               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void acos   (const f32* in, f32* out, const size_t count)                               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void atan2  (const f32* y, const f32* x, f32* out, const size_t count)                  noexcept;
+template<EPrecision P = EPrecision::Precise>
+void exp    (const f32* in, f32* out, const size_t count)                               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void log    (const f32* in, f32* out, const size_t count)                               noexcept;
+template<EPrecision P = EPrecision::Precise>
+void rsqrt  (const f32* in, f32* out, const size_t count)                               noexcept;
+
+} // End of namespace Math
+
+// Register versions, for kernels written with the lane helpers of SIMD.hpp
+namespace SIMD
+{
+
+template<EPrecision P = EPrecision::Precise> f32v sin   (const f32v x)                  noexcept;
+template<EPrecision P = EPrecision::Precise> f32v cos   (const f32v x)                  noexcept;
+template<EPrecision P = EPrecision::Precise> void sincos(const f32v x, f32v& s, f32v& c) noexcept;
+template<EPrecision P = EPrecision::Precise> f32v acos  (const f32v x)                  noexcept;
+template<EPrecision P = EPrecision::Precise> f32v atan2 (const f32v y, const f32v x)    noexcept;
+template<EPrecision P = EPrecision::Precise> f32v exp   (const f32v x)                  noexcept;
+template<EPrecision P = EPrecision::Precise> f32v log   (const f32v x)                  noexcept;
+template<EPrecision P = EPrecision::Precise> f32v rsqrt (const f32v x)                  noexcept;
+
+} // End of namespace SIMD
+
 #include "Calc.inl"
 
-}
\ No newline at end of file
+}
@@ -20,4 +20,724 @@ inline bool f32AreEqual(const f32 a, const f32 b, const f32 eps)
 inline f32 lerpf(const f32 a, const f32 b, const f32 alpha)
 {
 	return (a * (1.f - alpha)) + (b * alpha);
-}
\ No newline at end of file
+}
+
+
+
+/* =================== Math kernels =================== */
+// Every function is written once, as a template over the lane type: f32 for
+// the scalar functions, SIMD::f32v for the register and batched ones.
+// Coefficients of the Precise tier are the single-precision ones of the Cephes
+// library, the Fast ones are minimax fits on the same reduced ranges.
+namespace Math::Kernel
+{
+
+// Scalar lane helpers, mirroring the ones of SIMD.hpp
+template<typename V>
+inline V    constant    (const f32 k)                                 noexcept
+{
+    if constexpr (std::is_same_v<V, f32>)
+        return k;
+    else
+        return SIMD::set1(k);
+}
+
+inline f32  add         (const f32 a, const f32 b)                    noexcept { return a + b; }
+inline f32  sub         (const f32 a, const f32 b)                    noexcept { return a - b; }
+inline f32  mul         (const f32 a, const f32 b)                    noexcept { return a * b; }
+inline f32  div         (const f32 a, const f32 b)                    noexcept { return a / b; }
+inline f32  min         (const f32 a, const f32 b)                    noexcept { return a < b ? a : b; }
+inline f32  max         (const f32 a, const f32 b)                    noexcept { return a > b ? a : b; }
+inline f32  sqrt        (const f32 a)                                 noexcept { return sqrtf(a); }
+inline f32  abs         (const f32 a)                                 noexcept { return fabsf(a); }
+inline f32  mulAdd      (const f32 a, const f32 b, const f32 c)       noexcept { return a * b + c; }
+inline bool lessThan    (const f32 a, const f32 b)                    noexcept { return a < b; }
+inline bool lessEqual   (const f32 a, const f32 b)                    noexcept { return a <= b; }
+inline bool maskAnd     (const bool a, const bool b)                  noexcept { return a && b; }
+inline bool maskOr      (const bool a, const bool b)                  noexcept { return a || b; }
+inline f32  select      (const bool m, const f32 a, const f32 b)      noexcept { return m ? a : b; }
+
+// Round to nearest even, valid for |a| < 2^22
+inline f32  roundNearest(const f32 a)                                 noexcept
+{
+    constexpr f32 magic{12582912.f};
+    return (a + magic) - magic;
+}
+
+// Whether bit is set in the integer value of a
+inline bool hasBit      (const f32 a, const s32 bit)                  noexcept { return (static_cast<s32>(a) & bit) != 0; }
+
+// 2^n for integer values of n in [-126, 127]
+inline f32  pow2i       (const f32 n)                                 noexcept
+{
+    f32u u;
+    u.bits = (static_cast<s32>(n) + 127) << 23;
+    return u.f;
+}
+
+// Mantissa in [1, 2) and unbiased exponent of a positive normal float
+inline f32  mantissa    (const f32 a)                                 noexcept
+{
+    f32u u{a};
+    u.bits = (u.bits & 0x007FFFFF) | 0x3F800000;
+    return u.f;
+}
+
+inline f32  exponent    (const f32 a)                                 noexcept
+{
+    const f32u u{a};
+    return static_cast<f32>(((u.bits >> 23) & 0xFF) - 127);
+}
+
+// 1 / sqrt(a) with at least 11 correct bits
+inline f32  rsqrtEstimate(const f32 a)                                noexcept
+{
+#if defined(GPM_USE_SSE)
+    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+#else
+    f32u u{a};
+    u.bits = 0x5F375A86 - (u.bits >> 1);
+    return u.f * (1.5f - .5f * a * u.f * u.f);
+#endif
+}
+
+
+// Vector lane helpers, on top of the ones of SIMD.hpp
+#if defined(GPM_USE_SSE)
+
+using SIMD::f32v;
+using SIMD::maskv;
+using SIMD::add;
+using SIMD::sub;
+using SIMD::mul;
+using SIMD::div;
+using SIMD::min;
+using SIMD::max;
+using SIMD::sqrt;
+using SIMD::abs;
+using SIMD::mulAdd;
+using SIMD::lessThan;
+using SIMD::lessEqual;
+using SIMD::maskAnd;
+using SIMD::maskOr;
+using SIMD::select;
+
+#endif
+
+#if defined(GPM_USE_AVX)
+
+inline f32v  roundNearest(const f32v a)                               noexcept
+{
+    return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+// AVX has no 256-bit integer arithmetic: the bit tricks go through the
+// float <-> int conversions, which are exact on the values used here
+inline maskv hasBit     (const f32v a, const s32 bit)                 noexcept
+{
+    const __m256 masked{_mm256_and_ps(_mm256_castsi256_ps(_mm256_cvtps_epi32(a)),
+                                      _mm256_castsi256_ps(_mm256_set1_epi32(bit)))};
+    return _mm256_cmp_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(masked)), _mm256_setzero_ps(), _CMP_NEQ_OQ);
+}
+
+inline f32v  pow2i      (const f32v n)                                noexcept
+{
+    const __m256 biased{_mm256_mul_ps(_mm256_add_ps(n, _mm256_set1_ps(127.f)), _mm256_set1_ps(8388608.f))};
+    return _mm256_castsi256_ps(_mm256_cvtps_epi32(biased));
+}
+
+inline f32v  mantissa   (const f32v a)                                noexcept
+{
+    return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))),
+                        _mm256_castsi256_ps(_mm256_set1_epi32(0x3F800000)));
+}
+
+inline f32v  exponent   (const f32v a)                                noexcept
+{
+    const __m256 biased{_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)))};
+    return _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(biased)), _mm256_set1_ps(1.f / 8388608.f)),
+                         _mm256_set1_ps(127.f));
+}
+
+inline f32v  rsqrtEstimate(const f32v a)                              noexcept { return _mm256_rsqrt_ps(a); }
+
+#elif defined(GPM_USE_SSE)
+
+inline f32v  roundNearest(const f32v a)                               noexcept { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+
+inline maskv hasBit     (const f32v a, const s32 bit)                 noexcept
+{
+    const __m128i mask{_mm_set1_epi32(bit)};
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_cvtps_epi32(a), mask), mask));
+}
+
+inline f32v  pow2i      (const f32v n)                                noexcept
+{
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+}
+
+inline f32v  mantissa   (const f32v a)                                noexcept
+{
+    return _mm_or_ps(_mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))),
+                     _mm_castsi128_ps(_mm_set1_epi32(0x3F800000)));
+}
+
+inline f32v  exponent   (const f32v a)                                noexcept
+{
+    const __m128i biased{_mm_srli_epi32(_mm_castps_si128(a), 23)};
+    return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_and_si128(biased, _mm_set1_epi32(0xFF)), _mm_set1_epi32(127)));
+}
+
+inline f32v  rsqrtEstimate(const f32v a)                              noexcept { return _mm_rsqrt_ps(a); }
+
+#endif
+
+
+template<typename V>
+inline V negate(const V a) noexcept
+{
+    return sub(constant<V>(.0f), a);
+}
+
+
+// x = q * PI / 2 + r, with r in [-PI / 4, PI / 4]. PI / 2 is split in parts whose
+// products with q are exact for |x| <= 8192, in three parts for Precise and two for Fast.
+template<EPrecision P, typename V>
+inline void sincos(const V x, V& s, V& c) noexcept
+{
+    const V q{roundNearest(mul(x, constant<V>(.636619772f)))};
+    V       r;
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        r = mulAdd(q, constant<V>(-1.5703125f), x);
+        r = mulAdd(q, constant<V>(-4.837512969970703125e-4f), r);
+        r = mulAdd(q, constant<V>(-7.54978995489188216e-8f), r);
+    }
+    else
+    {
+        r = mulAdd(q, constant<V>(-1.5703125f), x);
+        r = mulAdd(q, constant<V>(-4.83826794897e-4f), r);
+    }
+
+    const V z{mul(r, r)};
+    V       ps, pc;
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        ps = constant<V>(-1.9515295891e-4f);
+        ps = mulAdd(ps, z, constant<V>( 8.3321608736e-3f));
+        ps = mulAdd(ps, z, constant<V>(-1.6666654611e-1f));
+
+        pc = constant<V>(2.443315711809948e-5f);
+        pc = mulAdd(pc, z, constant<V>(-1.388731625493765e-3f));
+        pc = mulAdd(pc, z, constant<V>( 4.166664568298827e-2f));
+        pc = mulAdd(pc, z, constant<V>(-.5f));
+    }
+    else
+    {
+        ps = constant<V>(8.16328115e-3f);
+        ps = mulAdd(ps, z, constant<V>(-1.66633903e-1f));
+
+        pc = constant<V>(-1.35918526e-3f);
+        pc = mulAdd(pc, z, constant<V>( 4.16557769e-2f));
+        pc = mulAdd(pc, z, constant<V>(-4.99998847e-1f));
+    }
+
+    const V sinR{mulAdd(mul(r, z), ps, r)};
+    const V cosR{mulAdd(z, pc, constant<V>(1.f))};
+
+    // Quadrant q mod 4: {sin, cos} = {sin r, cos r}, {cos r, -sin r}, {-sin r, -cos r}, {-cos r, sin r}
+    const auto swap{hasBit(q, 1)};
+
+    s = select(swap, cosR, sinR);
+    c = select(swap, sinR, cosR);
+    s = select(hasBit(q, 2), negate(s), s);
+    c = select(hasBit(add(q, constant<V>(1.f)), 2), negate(c), c);
+}
+
+
+template<EPrecision P, typename V>
+inline V acos(const V x) noexcept
+{
+    const V one  {constant<V>(1.f)};
+    const V xc   {min(max(x, negate(one)), one)};
+    const V a    {abs(xc)};
+    const auto negative{lessThan(xc, constant<V>(.0f))};
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        // acos(|x|) = 2 asin(sqrt((1 - |x|) / 2)) above 0.5, PI / 2 - asin(x) below
+        const auto big{lessThan(constant<V>(.5f), a)};
+        const V    z  {select(big, mul(constant<V>(.5f), sub(one, a)), mul(a, a))};
+        const V    s  {select(big, sqrt(z), a)};
+
+        V p{constant<V>(4.2163199048e-2f)};
+        p = mulAdd(p, z, constant<V>(2.4181311049e-2f));
+        p = mulAdd(p, z, constant<V>(4.5470025998e-2f));
+        p = mulAdd(p, z, constant<V>(7.4953002686e-2f));
+        p = mulAdd(p, z, constant<V>(1.6666752422e-1f));
+
+        const V asinS   {mulAdd(mul(s, z), p, s)};
+        const V bigRes  {add(asinS, asinS)};
+        const V smallRes{sub(constant<V>(HALF_PI), select(negative, negate(asinS), asinS))};
+
+        return select(big, select(negative, sub(constant<V>(PI), bigRes), bigRes), smallRes);
+    }
+    else
+    {
+        // Abramowitz and Stegun 4.4.45
+        V p{constant<V>(-.0187293f)};
+        p = mulAdd(p, a, constant<V>( .0742610f));
+        p = mulAdd(p, a, constant<V>(-.2121144f));
+        p = mulAdd(p, a, constant<V>(1.5707288f));
+
+        const V res{mul(p, sqrt(sub(one, a)))};
+
+        return select(negative, sub(constant<V>(PI), res), res);
+    }
+}
+
+
+// atan(a) for a = min(|x|, |y|) / max(|x|, |y|) in [0, 1], then unfolded to the right octant
+template<EPrecision P, typename V>
+inline V atan2(const V y, const V x) noexcept
+{
+    const V zero{constant<V>(.0f)};
+    const V ax  {abs(x)}, ay{abs(y)};
+    const V hi  {max(ax, ay)};
+    const V a   {select(lessThan(zero, hi), div(min(ax, ay), hi), zero)};
+    V       r;
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        // atan(a) = PI / 4 + atan((a - 1) / (a + 1)) above tan(PI / 8)
+        const V    one{constant<V>(1.f)};
+        const auto big{lessThan(constant<V>(.414213562f), a)};
+        const V    t  {select(big, div(sub(a, one), add(a, one)), a)};
+        const V    z  {mul(t, t)};
+
+        V p{constant<V>(8.05374449538e-2f)};
+        p = mulAdd(p, z, constant<V>(-1.38776856032e-1f));
+        p = mulAdd(p, z, constant<V>( 1.99777106478e-1f));
+        p = mulAdd(p, z, constant<V>(-3.33329491539e-1f));
+
+        r = add(mulAdd(mul(t, z), p, t), select(big, constant<V>(HALF_PI * .5f), zero));
+    }
+    else
+    {
+        const V z{mul(a, a)};
+
+        V p{constant<V>(2.08448788e-2f)};
+        p = mulAdd(p, z, constant<V>(-8.51558295e-2f));
+        p = mulAdd(p, z, constant<V>( 1.80158912e-1f));
+        p = mulAdd(p, z, constant<V>(-3.30304682e-1f));
+        p = mulAdd(p, z, constant<V>( 9.99866322e-1f));
+
+        r = mul(a, p);
+    }
+
+    r = select(lessThan(ax, ay),   sub(constant<V>(HALF_PI), r), r);
+    r = select(lessThan(x, zero),  sub(constant<V>(PI), r), r);
+
+    return select(lessThan(y, zero), negate(r), r);
+}
+
+
+// x = n ln(2) + r, with r in [-ln(2) / 2, ln(2) / 2], and exp(x) = 2^n exp(r)
+template<EPrecision P, typename V>
+inline V exp(const V x) noexcept
+{
+    constexpr f32 minX{-87.3365447f}, maxX{88.7228391f};
+
+    const V xc{min(max(x, constant<V>(minX)), constant<V>(maxX))};
+    const V n {roundNearest(mul(xc, constant<V>(1.44269504f)))};
+    V       r {mulAdd(n, constant<V>(-.693359375f), xc)};
+    r = mulAdd(n, constant<V>(2.12194440e-4f), r);
+
+    V p;
+    if constexpr (P == EPrecision::Precise)
+    {
+        p = constant<V>(1.9875691500e-4f);
+        p = mulAdd(p, r, constant<V>(1.3981999507e-3f));
+        p = mulAdd(p, r, constant<V>(8.3334519073e-3f));
+        p = mulAdd(p, r, constant<V>(4.1665795894e-2f));
+        p = mulAdd(p, r, constant<V>(1.6666665459e-1f));
+        p = mulAdd(p, r, constant<V>(5.0000001201e-1f));
+    }
+    else
+    {
+        p = constant<V>(4.12777353e-2f);
+        p = mulAdd(p, r, constant<V>(1.67535144e-1f));
+        p = mulAdd(p, r, constant<V>(5.00051162e-1f));
+    }
+
+    V res{mulAdd(mul(r, r), p, add(r, constant<V>(1.f)))};
+
+    // n = 128 near ln(FLT_MAX) doesn't fit an exponent: scale by 2^(n - 1), then by 2
+    const auto scaleTwice{lessThan(constant<V>(.0f), n)};
+    res = mul(res, pow2i(select(scaleTwice, sub(n, constant<V>(1.f)), n)));
+    res = select(scaleTwice, add(res, res), res);
+
+    res = select(lessThan(x, constant<V>(minX)), constant<V>(.0f), res);
+    return select(lessThan(constant<V>(maxX), x), constant<V>(HUGE_VALF), res);
+}
+
+
+// x = 2^e m, with m in [sqrt(2) / 2, sqrt(2)), and log(x) = e ln(2) + log(m)
+template<EPrecision P, typename V>
+inline V log(const V x) noexcept
+{
+    const V    one {constant<V>(1.f)};
+    V          m   {mantissa(x)};
+    V          e   {exponent(x)};
+    const auto big {lessThan(constant<V>(1.41421356f), m)};
+
+    m = select(big, mul(m, constant<V>(.5f)), m);
+    e = select(big, add(e, one), e);
+
+    const V f{sub(m, one)};
+    const V z{mul(f, f)};
+    V       res;
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        V p{constant<V>(7.0376836292e-2f)};
+        p = mulAdd(p, f, constant<V>(-1.1514610310e-1f));
+        p = mulAdd(p, f, constant<V>( 1.1676998740e-1f));
+        p = mulAdd(p, f, constant<V>(-1.2420140846e-1f));
+        p = mulAdd(p, f, constant<V>( 1.4249322787e-1f));
+        p = mulAdd(p, f, constant<V>(-1.6668057665e-1f));
+        p = mulAdd(p, f, constant<V>( 2.0000714765e-1f));
+        p = mulAdd(p, f, constant<V>(-2.4999993993e-1f));
+        p = mulAdd(p, f, constant<V>( 3.3333331174e-1f));
+
+        V y{mul(mul(f, z), p)};
+        y   = mulAdd(e, constant<V>(-2.12194440e-4f), y);
+        y   = mulAdd(z, constant<V>(-.5f), y);
+        res = mulAdd(e, constant<V>(.693359375f), add(f, y));
+    }
+    else
+    {
+        V p{constant<V>(-1.45924241e-1f)};
+        p = mulAdd(p, f, constant<V>( 2.17764958e-1f));
+        p = mulAdd(p, f, constant<V>(-2.52450070e-1f));
+        p = mulAdd(p, f, constant<V>( 3.32854715e-1f));
+
+        const V y{mulAdd(z, constant<V>(-.5f), mul(mul(f, z), p))};
+        res = mulAdd(e, constant<V>(.693147181f), add(f, y));
+    }
+
+    const V zero{constant<V>(.0f)};
+    const V special{select(lessThan(x, zero), constant<V>(NAN), constant<V>(-HUGE_VALF))};
+
+    return select(lessEqual(x, zero), special, res);
+}
+
+
+template<EPrecision P, typename V>
+inline V rsqrt(const V x) noexcept
+{
+    if constexpr (P == EPrecision::Precise)
+    {
+        return div(constant<V>(1.f), sqrt(x));
+    }
+    else
+    {
+        // One Newton-Raphson step on the hardware estimate
+        const V y{rsqrtEstimate(x)};
+        return mul(y, mulAdd(mul(mul(x, constant<V>(-.5f)), y), y, constant<V>(1.5f)));
+    }
+}
+
+
+// Batched drivers: full registers straight from the arrays, then the tail in a padded register
+template<typename F>
+inline void forEach(const f32* in, f32* out, const size_t count, F&& kernel) noexcept
+{
+    size_t i{0u};
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+        SIMD::storeu(out + i, kernel(SIMD::loadu(in + i)));
+
+    if (i == count)
+        return;
+
+    alignas(GPM_SIMD_ALIGNMENT) f32 tail[GPM_SIMD_WIDTH]{};
+    for (size_t j{0u}; j < count - i; ++j)
+        tail[j] = in[i + j];
+
+    SIMD::store(tail, kernel(SIMD::load(tail)));
+
+    for (size_t j{0u}; j < count - i; ++j)
+        out[i + j] = tail[j];
+}
+
+
+template<typename F>
+inline void forEach(const f32* inA, const f32* inB, f32* outA, f32* outB, const size_t count, F&& kernel) noexcept
+{
+    size_t i{0u};
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+    {
+        SIMD::f32v a{SIMD::loadu(inA + i)}, b{SIMD::loadu(inB + i)};
+        kernel(a, b);
+        SIMD::storeu(outA + i, a);
+        SIMD::storeu(outB + i, b);
+    }
+
+    if (i == count)
+        return;
+
+    alignas(GPM_SIMD_ALIGNMENT) f32 tailA[GPM_SIMD_WIDTH]{};
+    alignas(GPM_SIMD_ALIGNMENT) f32 tailB[GPM_SIMD_WIDTH]{};
+    for (size_t j{0u}; j < count - i; ++j)
+    {
+        tailA[j] = inA[i + j];
+        tailB[j] = inB[i + j];
+    }
+
+    SIMD::f32v a{SIMD::load(tailA)}, b{SIMD::load(tailB)};
+    kernel(a, b);
+    SIMD::store(tailA, a);
+    SIMD::store(tailB, b);
+
+    for (size_t j{0u}; j < count - i; ++j)
+    {
+        outA[i + j] = tailA[j];
+        outB[i + j] = tailB[j];
+    }
+}
+
+} // End of namespace Math::Kernel
+
+
+
+
+/* =================== SIMD register functions =================== */
+namespace SIMD
+{
+
+// Lanes out of the exact reduction range go through libm
+template<EPrecision P>
+inline void sincos(const f32v x, f32v& s, f32v& c) noexcept
+{
+    Math::Kernel::sincos<P>(x, s, c);
+
+    if constexpr (P == EPrecision::Precise)
+    {
+        const u32 outOfRange{bits(lessThan(set1(8192.f), abs(x)))};
+        if (outOfRange == 0u)
+            return;
+
+        alignas(GPM_SIMD_ALIGNMENT) f32 in[GPM_SIMD_WIDTH], outS[GPM_SIMD_WIDTH], outC[GPM_SIMD_WIDTH];
+        store(in, x);
+        store(outS, s);
+        store(outC, c);
+
+        for (u32 lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        {
+            if (outOfRange & (1u << lane))
+            {
+                outS[lane] = sinf(in[lane]);
+                outC[lane] = cosf(in[lane]);
+            }
+        }
+
+        s = load(outS);
+        c = load(outC);
+    }
+}
+
+
+template<EPrecision P>
+inline f32v sin(const f32v x) noexcept
+{
+    f32v s, c;
+    sincos<P>(x, s, c);
+    return s;
+}
+
+
+template<EPrecision P>
+inline f32v cos(const f32v x) noexcept
+{
+    f32v s, c;
+    sincos<P>(x, s, c);
+    return c;
+}
+
+
+template<EPrecision P>
+inline f32v acos(const f32v x) noexcept
+{
+    return Math::Kernel::acos<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32v atan2(const f32v y, const f32v x) noexcept
+{
+    return Math::Kernel::atan2<P>(y, x);
+}
+
+
+template<EPrecision P>
+inline f32v exp(const f32v x) noexcept
+{
+    return Math::Kernel::exp<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32v log(const f32v x) noexcept
+{
+    return Math::Kernel::log<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32v rsqrt(const f32v x) noexcept
+{
+    return Math::Kernel::rsqrt<P>(x);
+}
+
+} // End of namespace SIMD
+
+
+
+
+/* =================== Math functions =================== */
+namespace Math
+{
+
+template<EPrecision P>
+inline void sincos(const f32 x, f32& s, f32& c) noexcept
+{
+    if constexpr (P == EPrecision::Precise)
+    {
+        if (fabsf(x) > 8192.f)
+        {
+            s = sinf(x);
+            c = cosf(x);
+            return;
+        }
+    }
+
+    Kernel::sincos<P>(x, s, c);
+}
+
+
+template<EPrecision P>
+inline f32 sin(const f32 x) noexcept
+{
+    f32 s, c;
+    sincos<P>(x, s, c);
+    return s;
+}
+
+
+template<EPrecision P>
+inline f32 cos(const f32 x) noexcept
+{
+    f32 s, c;
+    sincos<P>(x, s, c);
+    return c;
+}
+
+
+template<EPrecision P>
+inline f32 acos(const f32 x) noexcept
+{
+    return Kernel::acos<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32 atan2(const f32 y, const f32 x) noexcept
+{
+    return Kernel::atan2<P>(y, x);
+}
+
+
+template<EPrecision P>
+inline f32 exp(const f32 x) noexcept
+{
+    return Kernel::exp<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32 log(const f32 x) noexcept
+{
+    return Kernel::log<P>(x);
+}
+
+
+template<EPrecision P>
+inline f32 rsqrt(const f32 x) noexcept
+{
+    return Kernel::rsqrt<P>(x);
+}
+
+
+template<EPrecision P>
+inline void sin(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::sin<P>(x); });
+}
+
+
+template<EPrecision P>
+inline void cos(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::cos<P>(x); });
+}
+
+
+template<EPrecision P>
+inline void sincos(const f32* in, f32* outSin, f32* outCos, const size_t count) noexcept
+{
+    Kernel::forEach(in, in, outSin, outCos, count, [](SIMD::f32v& s, SIMD::f32v& c) { SIMD::sincos<P>(s, s, c); });
+}
+
+
+template<EPrecision P>
+inline void acos(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::acos<P>(x); });
+}
+
+
+template<EPrecision P>
+inline void atan2(const f32* y, const f32* x, f32* out, const size_t count) noexcept
+{
+    size_t i{0u};
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+        SIMD::storeu(out + i, SIMD::atan2<P>(SIMD::loadu(y + i), SIMD::loadu(x + i)));
+
+    for (; i < count; ++i)
+        out[i] = atan2<P>(y[i], x[i]);
+}
+
+
+template<EPrecision P>
+inline void exp(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::exp<P>(x); });
+}
+
+
+template<EPrecision P>
+inline void log(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::log<P>(x); });
+}
+
+
+template<EPrecision P>
+inline void rsqrt(const f32* in, f32* out, const size_t count) noexcept
+{
+    Kernel::forEach(in, out, count, [](const SIMD::f32v x) { return SIMD::rsqrt<P>(x); });
+}
+
+} // End of namespace Math
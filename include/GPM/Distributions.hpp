@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Calc.hpp"
+#include "Random.hpp"
+#include "Sampling.hpp"
+
+namespace GPM::Random
+{
+
+// Non-uniform distributions. G is any GPM generator (Generator, Philox) or any type
+// with a u32 next(): the batched versions draw their bits in bulk from Generator
+// and Philox, and through next() otherwise.
+//
+// normal and exponential use the Ziggurat method (Marsaglia and Tsang 2000) with
+// 128 and 256 layers: about 99% of the values cost one 32-bit draw, a table lookup
+// and a multiplication, the others fall back to exact rejection. The directions
+// are direct transforms, they never reject.
+
+/* =================== Scalar distributions =================== */
+template<typename G = Generator>
+f32  normal             (const f32 mean = .0f, const f32 stddev = 1.f,
+                         G& generator = defaultGenerator())                             noexcept;
+
+// Rate lambda, mean 1 / lambda
+template<typename G = Generator>
+f32  exponential        (const f32 lambda = 1.f,
+                         G& generator = defaultGenerator())                             noexcept;
+
+// Multiplication of uniforms below a mean of 10, transformed rejection
+// (Hoermann's PTRS, 1993) above, in constant expected time
+template<typename G = Generator>
+u32  poisson            (const f32 mean,
+                         G& generator = defaultGenerator())                             noexcept;
+
+// Unit direction around the unit vector axis, with a density proportional to the
+// cosine of the angle to it (Malley's method), e.g. for diffuse bounces
+template<typename G = Generator>
+Vec3 cosineHemisphere   (const Vec3& axis,
+                         G& generator = defaultGenerator())                             noexcept;
+
+// Unit direction uniform over the solid angle of the cone around the unit vector axis
+template<typename G = Generator>
+Vec3 cone               (const Vec3& axis, const f32 halfAngle,
+                         G& generator = defaultGenerator())                             noexcept;
+
+
+/* =================== Batched distributions =================== */
+template<typename G = Generator>
+void normal             (f32* out, const size_t count,
+                         const f32 mean = .0f, const f32 stddev = 1.f,
+                         G& generator = defaultGenerator())                             noexcept;
+template<typename G = Generator>
+void exponential        (f32* out, const size_t count, const f32 lambda = 1.f,
+                         G& generator = defaultGenerator())                             noexcept;
+template<typename G = Generator>
+void poisson            (u32* out, const size_t count, const f32 mean,
+                         G& generator = defaultGenerator())                             noexcept;
+template<typename G = Generator>
+void cosineHemisphere   (const Vec3& axis, Vec3* out, const size_t count,
+                         G& generator = defaultGenerator())                             noexcept;
+template<typename G = Generator>
+void cone               (const Vec3& axis, const f32 halfAngle, Vec3* out, const size_t count,
+                         G& generator = defaultGenerator())                             noexcept;
+
+#include "Distributions.inl"
+
+} // End of namespace GPM::Random
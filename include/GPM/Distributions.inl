@@ -0,0 +1,478 @@
+/* =================== Helpers =================== */
+namespace DistributionsDetail
+{
+
+// Bulk bits, from the bulk fills where the generator has them
+template<typename G>
+inline void bits(G& generator, u32* out, const size_t count) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+        out[i] = generator.next();
+}
+
+
+inline void bits(Generator& generator, u32* out, const size_t count) noexcept
+{
+    generator.fill(out, count);
+}
+
+
+inline void bits(Philox& generator, u32* out, const size_t count) noexcept
+{
+    generator.fill(generator.position(), out, count);
+    generator.seek(generator.position() + count);
+}
+
+
+// Uniform floats in [0, 1), and in (0, 1] where a log follows
+template<typename G>
+inline f32 uniform(G& generator) noexcept
+{
+    return static_cast<f32>(generator.next() >> 8u) * 0x1.0p-24f;
+}
+
+
+template<typename G>
+inline f32 uniformOpen(G& generator) noexcept
+{
+    return static_cast<f32>((generator.next() >> 8u) + 1u) * 0x1.0p-24f;
+}
+
+
+template<typename G>
+inline void uniforms(G& generator, f32* out, const size_t count) noexcept
+{
+    u32 raw[ShapeSampling::blockSize];
+    bits(generator, raw, count);
+
+    for (size_t i{0u}; i < count; ++i)
+        out[i] = static_cast<f32>(raw[i] >> 8u) * 0x1.0p-24f;
+}
+
+
+/* Ziggurats. The low bits of a draw pick the layer, the high 24 bits give the value,
+ * so both are independent. k[i] is the acceptance threshold of the fast path,
+ * w[i] scales the value to the layer width and f[i] is the density at its edge. */
+struct NormalTables
+{
+    static constexpr f64 tailStart{3.442619855899};
+    static constexpr f64 layerArea{9.91256303526217e-3};
+
+    u32 k[128];
+    f32 w[128];
+    f32 f[128];
+
+    NormalTables() noexcept
+    {
+        constexpr f64 scale{8388608.0}; // 2^23, the value is a signed 24-bit integer
+
+        f64 x   {tailStart};
+        f64 prev{x};
+        const f64 q{layerArea / std::exp(-.5 * x * x)};
+
+        k[0]   = static_cast<u32>((x / q) * scale);
+        k[1]   = 0u;
+        w[0]   = static_cast<f32>(q / scale);
+        w[127] = static_cast<f32>(x / scale);
+        f[0]   = 1.f;
+        f[127] = static_cast<f32>(std::exp(-.5 * x * x));
+
+        for (u32 i{126u}; i >= 1u; --i)
+        {
+            x        = std::sqrt(-2. * std::log(layerArea / x + std::exp(-.5 * x * x)));
+            k[i + 1] = static_cast<u32>((x / prev) * scale);
+            prev     = x;
+            f[i]     = static_cast<f32>(std::exp(-.5 * x * x));
+            w[i]     = static_cast<f32>(x / scale);
+        }
+    }
+};
+
+
+struct ExponentialTables
+{
+    static constexpr f64 tailStart{7.697117470131487};
+    static constexpr f64 layerArea{3.949659822581572e-3};
+
+    u32 k[256];
+    f32 w[256];
+    f32 f[256];
+
+    ExponentialTables() noexcept
+    {
+        constexpr f64 scale{16777216.0}; // 2^24
+
+        f64 x   {tailStart};
+        f64 prev{x};
+        const f64 q{layerArea / std::exp(-x)};
+
+        k[0]   = static_cast<u32>((x / q) * scale);
+        k[1]   = 0u;
+        w[0]   = static_cast<f32>(q / scale);
+        w[255] = static_cast<f32>(x / scale);
+        f[0]   = 1.f;
+        f[255] = static_cast<f32>(std::exp(-x));
+
+        for (u32 i{254u}; i >= 1u; --i)
+        {
+            x        = -std::log(layerArea / x + std::exp(-x));
+            k[i + 1] = static_cast<u32>((x / prev) * scale);
+            prev     = x;
+            f[i]     = static_cast<f32>(std::exp(-x));
+            w[i]     = static_cast<f32>(x / scale);
+        }
+    }
+};
+
+
+inline const NormalTables& normalTables() noexcept
+{
+    static const NormalTables tables{};
+    return tables;
+}
+
+
+inline const ExponentialTables& exponentialTables() noexcept
+{
+    static const ExponentialTables tables{};
+    return tables;
+}
+
+
+// Rejection for the values outside the rectangles: the wedges test the density
+// itself, the base layer samples the tail beyond tailStart (Marsaglia 1964)
+template<typename G>
+inline f32 normalSlow(const NormalTables& tables, s32 value, u32 layer, G& generator) noexcept
+{
+    constexpr f32 tailStart{static_cast<f32>(NormalTables::tailStart)};
+
+    for (;;)
+    {
+        if (layer == 0u)
+        {
+            f32 x, y;
+            do
+            {
+                x = -std::log(uniformOpen(generator)) / tailStart;
+                y = -std::log(uniformOpen(generator));
+            } while (y + y < x * x);
+
+            return value > 0 ? tailStart + x : -tailStart - x;
+        }
+
+        const f32 x{static_cast<f32>(value) * tables.w[layer]};
+        if (tables.f[layer] + uniform(generator) * (tables.f[layer - 1u] - tables.f[layer]) < std::exp(-.5f * x * x))
+            return x;
+
+        const u32 draw{generator.next()};
+        layer = draw & 127u;
+        value = static_cast<s32>(draw) >> 8;
+
+        if (static_cast<u32>(std::abs(value)) < tables.k[layer])
+            return static_cast<f32>(value) * tables.w[layer];
+    }
+}
+
+
+template<typename G>
+inline f32 normal(const NormalTables& tables, const u32 draw, G& generator) noexcept
+{
+    const u32 layer{draw & 127u};
+    const s32 value{static_cast<s32>(draw) >> 8};
+
+    if (static_cast<u32>(std::abs(value)) < tables.k[layer])
+        return static_cast<f32>(value) * tables.w[layer];
+
+    return normalSlow(tables, value, layer, generator);
+}
+
+
+template<typename G>
+inline f32 exponentialSlow(const ExponentialTables& tables, u32 value, u32 layer, G& generator) noexcept
+{
+    for (;;)
+    {
+        // The exponential is memoryless: its tail is a shifted exponential
+        if (layer == 0u)
+            return static_cast<f32>(ExponentialTables::tailStart) - std::log(uniformOpen(generator));
+
+        const f32 x{static_cast<f32>(value) * tables.w[layer]};
+        if (tables.f[layer] + uniform(generator) * (tables.f[layer - 1u] - tables.f[layer]) < std::exp(-x))
+            return x;
+
+        const u32 draw{generator.next()};
+        layer = draw & 255u;
+        value = draw >> 8u;
+
+        if (value < tables.k[layer])
+            return static_cast<f32>(value) * tables.w[layer];
+    }
+}
+
+
+template<typename G>
+inline f32 exponential(const ExponentialTables& tables, const u32 draw, G& generator) noexcept
+{
+    const u32 layer{draw & 255u};
+    const u32 value{draw >> 8u};
+
+    if (value < tables.k[layer])
+        return static_cast<f32>(value) * tables.w[layer];
+
+    return exponentialSlow(tables, value, layer, generator);
+}
+
+
+// Constants of a Poisson distribution, computed once per batch
+struct PoissonParameters
+{
+    f64 mean;
+    f64 expMinusMean;
+    f64 logMean;
+    f64 a, b, invAlpha, vr;
+
+    explicit PoissonParameters(const f32 m) noexcept
+        : mean        {static_cast<f64>(m)},
+          expMinusMean{std::exp(-mean)},
+          logMean     {std::log(mean)}
+    {
+        const f64 smu{std::sqrt(mean)};
+        b        = .931 + 2.53 * smu;
+        a        = -.059 + .02483 * b;
+        invAlpha = 1.1239 + 1.1328 / (b - 3.4);
+        vr       = .9277 - 3.6224 / (b - 2.);
+    }
+};
+
+
+template<typename G>
+inline u32 poisson(const PoissonParameters& params, G& generator) noexcept
+{
+    if (!(params.mean > .0))
+        return 0u;
+
+    // Knuth: count the uniforms whose product stays above e^-mean
+    if (params.mean < 10.)
+    {
+        u32 k{0u};
+        for (f64 product{uniformOpen(generator)}; product > params.expMinusMean; product *= uniformOpen(generator))
+            ++k;
+
+        return k;
+    }
+
+    for (;;)
+    {
+        const f64 u {static_cast<f64>(uniform(generator)) - .5};
+        const f64 v {static_cast<f64>(uniformOpen(generator))};
+        const f64 us{.5 - std::abs(u)};
+
+        if (us <= .0)
+            continue;
+
+        const f64 k{std::floor((2. * params.a / us + params.b) * u + params.mean + .43)};
+
+        if (us >= .07 && v <= params.vr)
+            return static_cast<u32>(k);
+
+        if (k < .0 || (us < .013 && v > us))
+            continue;
+
+        if (std::log(v) + std::log(params.invAlpha) - std::log(params.a / (us * us) + params.b)
+            <= -params.mean + k * params.logMean - std::lgamma(k + 1.))
+            return static_cast<u32>(k);
+    }
+}
+
+
+// Points of the unit disk (x, y) and their height on the hemisphere of density
+// cos / PI: the projection of disk-uniform points (Malley's method)
+template<typename G>
+inline void cosineHemisphere(f32* x, f32* y, f32* z, const size_t count, G& generator) noexcept
+{
+    // Zeroed, GCC can't tell that uniforms() writes the count first angles
+    f32 angles[ShapeSampling::blockSize]{};
+    uniforms(generator, z, count);
+    uniforms(generator, angles, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        y[i]       = z[i];
+        z[i]       = 1.f - z[i];
+        angles[i] *= TWO_PI;
+    }
+
+    ShapeSampling::sqrt(y, count);
+    ShapeSampling::sqrt(z, count);
+
+    f32 s[ShapeSampling::blockSize];
+    Math::sincos<EPrecision::Fast>(angles, s, x, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        x[i] *= y[i];
+        y[i]  = s[i] * y[i];
+    }
+}
+
+
+// Cones: cos(theta) uniform in [cos(halfAngle), 1] is uniform over the solid angle
+template<typename G>
+inline void cone(const f32 cosHalfAngle, f32* x, f32* y, f32* z, const size_t count, G& generator) noexcept
+{
+    f32 angles[ShapeSampling::blockSize]{};
+    uniforms(generator, z, count);
+    uniforms(generator, angles, count);
+
+    f32 r[ShapeSampling::blockSize];
+    for (size_t i{0u}; i < count; ++i)
+    {
+        z[i]       = 1.f - z[i] * (1.f - cosHalfAngle);
+        r[i]       = std::max(1.f - z[i] * z[i], .0f);
+        angles[i] *= TWO_PI;
+    }
+
+    ShapeSampling::sqrt(r, count);
+    Math::sincos<EPrecision::Fast>(angles, y, x, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        x[i] *= r[i];
+        y[i] *= r[i];
+    }
+}
+
+} // End of namespace DistributionsDetail
+
+
+
+
+/* =================== Scalar distributions =================== */
+template<typename G>
+inline f32 normal(const f32 mean, const f32 stddev, G& generator) noexcept
+{
+    return mean + stddev * DistributionsDetail::normal(DistributionsDetail::normalTables(), generator.next(), generator);
+}
+
+
+template<typename G>
+inline f32 exponential(const f32 lambda, G& generator) noexcept
+{
+    return DistributionsDetail::exponential(DistributionsDetail::exponentialTables(), generator.next(), generator) / lambda;
+}
+
+
+template<typename G>
+inline u32 poisson(const f32 mean, G& generator) noexcept
+{
+    return DistributionsDetail::poisson(DistributionsDetail::PoissonParameters{mean}, generator);
+}
+
+
+template<typename G>
+inline Vec3 cosineHemisphere(const Vec3& axis, G& generator) noexcept
+{
+    Vec3 b1, b2;
+    ShapeSampling::basis(axis, b1, b2);
+
+    const f32 r2{DistributionsDetail::uniform(generator)};
+    const f32 r {std::sqrt(r2)};
+    f32       s, c;
+    Math::sincos(DistributionsDetail::uniform(generator) * TWO_PI, s, c);
+
+    return b1 * (c * r) + b2 * (s * r) + axis * std::sqrt(1.f - r2);
+}
+
+
+template<typename G>
+inline Vec3 cone(const Vec3& axis, const f32 halfAngle, G& generator) noexcept
+{
+    Vec3 b1, b2;
+    ShapeSampling::basis(axis, b1, b2);
+
+    const f32 z{1.f - DistributionsDetail::uniform(generator) * (1.f - Math::cos(halfAngle))};
+    const f32 r{std::sqrt(std::max(1.f - z * z, .0f))};
+    f32       s, c;
+    Math::sincos(DistributionsDetail::uniform(generator) * TWO_PI, s, c);
+
+    return b1 * (c * r) + b2 * (s * r) + axis * z;
+}
+
+
+
+
+/* =================== Batched distributions =================== */
+template<typename G>
+inline void normal(f32* out, const size_t count, const f32 mean, const f32 stddev, G& generator) noexcept
+{
+    const DistributionsDetail::NormalTables& tables{DistributionsDetail::normalTables()};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        u32 draws[ShapeSampling::blockSize];
+        DistributionsDetail::bits(generator, draws, size);
+
+        for (size_t i{0u}; i < size; ++i)
+            out[first + i] = mean + stddev * DistributionsDetail::normal(tables, draws[i], generator);
+    });
+}
+
+
+template<typename G>
+inline void exponential(f32* out, const size_t count, const f32 lambda, G& generator) noexcept
+{
+    const DistributionsDetail::ExponentialTables& tables{DistributionsDetail::exponentialTables()};
+    const f32                                      scale {1.f / lambda};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        u32 draws[ShapeSampling::blockSize];
+        DistributionsDetail::bits(generator, draws, size);
+
+        for (size_t i{0u}; i < size; ++i)
+            out[first + i] = scale * DistributionsDetail::exponential(tables, draws[i], generator);
+    });
+}
+
+
+template<typename G>
+inline void poisson(u32* out, const size_t count, const f32 mean, G& generator) noexcept
+{
+    const DistributionsDetail::PoissonParameters params{mean};
+
+    for (size_t i{0u}; i < count; ++i)
+        out[i] = DistributionsDetail::poisson(params, generator);
+}
+
+
+template<typename G>
+inline void cosineHemisphere(const Vec3& axis, Vec3* out, const size_t count, G& generator) noexcept
+{
+    Vec3 b1, b2;
+    ShapeSampling::basis(axis, b1, b2);
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize];
+        DistributionsDetail::cosineHemisphere(x, y, z, size, generator);
+
+        ShapeSampling::toWorld(Vec3::zero(), b1, b2, axis, x, y, z, out + first, size);
+    });
+}
+
+
+template<typename G>
+inline void cone(const Vec3& axis, const f32 halfAngle, Vec3* out, const size_t count, G& generator) noexcept
+{
+    Vec3      b1, b2;
+    const f32 cosHalfAngle{Math::cos(halfAngle)};
+    ShapeSampling::basis(axis, b1, b2);
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize];
+        DistributionsDetail::cone(cosHalfAngle, x, y, z, size, generator);
+
+        ShapeSampling::toWorld(Vec3::zero(), b1, b2, axis, x, y, z, out + first, size);
+    });
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Shape3D/AABB.hpp"
+
+namespace GPM
+{
+
+// Two proxies of a DynamicAABBTree whose fat bounds overlap, first < second
+struct DynamicAABBTreePair
+{
+    u32 first;
+    u32 second;
+
+    bool operator==(const DynamicAABBTreePair& other) const noexcept { return first == other.first && second == other.second; }
+    bool operator< (const DynamicAABBTreePair& other) const noexcept
+    {
+        return first < other.first || (first == other.first && second < other.second);
+    }
+};
+
+// Incremental AABB tree for moving objects (broadphase). Each proxy is a leaf
+// holding a fat box, the object box grown by a margin, so that small moves
+// don't touch the tree. Insertion descends to the sibling with the lowest
+// surface area cost and the ancestors are rebalanced by rotations, which keeps
+// the height logarithmic whatever the insertion order.
+//
+// Nodes live in a contiguous pool linked by indices, and a proxy is the index
+// of its leaf: it stays valid until remove().
+class DynamicAABBTree
+{
+protected:
+    struct Node
+    {
+        Vec3 min;
+        u32  parent;    // Next free node when unused
+        Vec3 max;
+        u32  height;    // 0 for leaves
+        u32  child1;
+        u32  child2;
+        u32  userData;
+
+        bool isLeaf() const noexcept { return child1 == nullNode; }
+    };
+
+    // Pair tracking state of a proxy
+    enum class EProxyState : u8
+    {
+        Unchanged,
+        Moved,
+        Removed
+    };
+
+    std::vector<Node>                m_nodes;
+    std::vector<EProxyState>         m_states;
+    std::vector<u32>                 m_moved;
+    std::vector<u32>                 m_removed;
+    std::vector<DynamicAABBTreePair> m_pairs;
+    std::vector<DynamicAABBTreePair> m_found;   // Scratch of updatePairs(), kept to reuse the memory
+    std::vector<DynamicAABBTreePair> m_kept;
+    std::vector<DynamicAABBTreePair> m_touched;
+    u32                              m_root    {nullNode};
+    u32                              m_freeList{nullNode};
+    size_t                           m_proxyCount{0u};
+    f32                              m_margin;
+
+    u32  allocateNode   ();
+    void freeNode       (const u32 node)                                        noexcept;
+    void insertLeaf     (const u32 leaf);
+    void removeLeaf     (const u32 leaf);
+    u32  balance        (const u32 node)                                        noexcept;
+    void refit          (const u32 node)                                        noexcept;
+    void markMoved      (const u32 proxy);
+
+    template<typename F>
+    void query          (const Vec3& min, const Vec3& max, F&& callback)        const;
+
+public:
+    static constexpr u32 nullNode{~0u};
+
+    // Predicted moves stretch the fat boxes by this many displacements
+    static constexpr f32 displacementMultiplier{2.f};
+
+    // A fat box that no longer fits in a fresh one grown by this many margins
+    // is rebuilt, as after a fast move followed by a stop
+    static constexpr f32 hugeMarginMultiplier{4.f};
+
+    // Constructors. margin is added to the half extents of the fat boxes.
+    explicit DynamicAABBTree(const f32 margin = 0.1f)                           noexcept : m_margin{margin} {}
+
+    // Adds a proxy for aabb and returns it, userData is kept for the user
+    u32         insert          (const AABB& aabb, const u32 userData = 0u);
+    void        remove          (const u32 proxy);
+
+    // Updates the box of a proxy. The tree is only touched when aabb leaves the
+    // fat box or the fat box got too large for it, and the fat box is then
+    // rebuilt around aabb and stretched along the displacement expected on the
+    // next frame: returns true in that case.
+    bool        move            (const u32 proxy, const AABB& aabb,
+                                 const Vec3& displacement = Vec3::zero());
+
+    // Pair finding: refreshes the pairs of overlapping fat boxes and reports
+    // the changes since the previous call, sorted. Only the proxies inserted,
+    // moved out of their fat box or removed since then are queried, and the
+    // pairs between other proxies are kept as they are. Removed proxies are
+    // recycled here, so that a new proxy can't take over the pairs of an old one.
+    void        updatePairs     (std::vector<DynamicAABBTreePair>& added,
+                                 std::vector<DynamicAABBTreePair>& lost);
+    const std::vector<DynamicAABBTreePair>& getPairs()                          const noexcept { return m_pairs; }
+
+    // Calls callback(proxy) for the proxies whose fat box overlaps aabb, until it
+    // returns false. The traversal follows the parent links: no stack is needed.
+    template<typename F>
+    void        query           (const AABB& aabb, F&& callback)                const;
+
+    // Getters
+    AABB        getFatAABB      (const u32 proxy)                               const noexcept;
+    u32         getUserData     (const u32 proxy)                               const noexcept { return m_nodes[proxy].userData; }
+    u32         getHeight       ()                                              const noexcept;
+    size_t      getProxyCount   ()                                              const noexcept { return m_proxyCount; }
+    f32         getMargin       ()                                              const noexcept { return m_margin; }
+};
+
+#include "DynamicAABBTree.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,431 @@
+/* =================== Helpers =================== */
+namespace DynamicAABBTreeDetail
+{
+
+inline f32 halfArea(const Vec3& min, const Vec3& max) noexcept
+{
+    const Vec3 size{max - min};
+    return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+
+inline f32 unionHalfArea(const Vec3& minA, const Vec3& maxA, const Vec3& minB, const Vec3& maxB) noexcept
+{
+    return halfArea({std::min(minA.x, minB.x), std::min(minA.y, minB.y), std::min(minA.z, minB.z)},
+                    {std::max(maxA.x, maxB.x), std::max(maxA.y, maxB.y), std::max(maxA.z, maxB.z)});
+}
+
+
+inline bool contains(const Vec3& outerMin, const Vec3& outerMax, const Vec3& min, const Vec3& max) noexcept
+{
+    return outerMin.x <= min.x && outerMin.y <= min.y && outerMin.z <= min.z &&
+           max.x <= outerMax.x && max.y <= outerMax.y && max.z <= outerMax.z;
+}
+
+
+inline bool overlaps(const Vec3& minA, const Vec3& maxA, const Vec3& minB, const Vec3& maxB) noexcept
+{
+    return minA.x <= maxB.x && maxA.x >= minB.x &&
+           minA.y <= maxB.y && maxA.y >= minB.y &&
+           minA.z <= maxB.z && maxA.z >= minB.z;
+}
+
+} // End of namespace DynamicAABBTreeDetail
+
+
+
+
+/* =================== Node pool =================== */
+inline u32 DynamicAABBTree::allocateNode()
+{
+    if (m_freeList == nullNode)
+    {
+        m_nodes.emplace_back();
+        m_states.push_back(EProxyState::Unchanged);
+        m_freeList = static_cast<u32>(m_nodes.size() - 1u);
+        m_nodes[m_freeList].parent = nullNode;
+    }
+
+    const u32 node{m_freeList};
+    m_freeList = m_nodes[node].parent;
+
+    m_nodes[node].parent   = nullNode;
+    m_nodes[node].child1   = nullNode;
+    m_nodes[node].child2   = nullNode;
+    m_nodes[node].height   = 0u;
+    m_nodes[node].userData = 0u;
+    m_states[node]         = EProxyState::Unchanged;
+
+    return node;
+}
+
+
+inline void DynamicAABBTree::freeNode(const u32 node) noexcept
+{
+    m_nodes[node].parent = m_freeList;
+    m_freeList           = node;
+}
+
+
+
+
+/* =================== Tree =================== */
+inline void DynamicAABBTree::refit(const u32 node) noexcept
+{
+    Node&       current{m_nodes[node]};
+    const Node& child1 {m_nodes[current.child1]};
+    const Node& child2 {m_nodes[current.child2]};
+
+    current.min    = {std::min(child1.min.x, child2.min.x), std::min(child1.min.y, child2.min.y), std::min(child1.min.z, child2.min.z)};
+    current.max    = {std::max(child1.max.x, child2.max.x), std::max(child1.max.y, child2.max.y), std::max(child1.max.z, child2.max.z)};
+    current.height = 1u + std::max(child1.height, child2.height);
+}
+
+
+// Rotates the taller child of node up when the heights of its children differ
+// by more than one, and returns the node now at its place
+inline u32 DynamicAABBTree::balance(const u32 a) noexcept
+{
+    if (m_nodes[a].isLeaf() || m_nodes[a].height < 2u)
+        return a;
+
+    const u32 b{m_nodes[a].child1};
+    const u32 c{m_nodes[a].child2};
+
+    // Rotates child up, its taller child replaces it under a
+    auto rotate = [this, a](const u32 child, const u32 other)
+    {
+        const u32 f{m_nodes[child].child1};
+        const u32 g{m_nodes[child].child2};
+
+        m_nodes[child].child1 = a;
+        m_nodes[child].parent = m_nodes[a].parent;
+        m_nodes[a].parent     = child;
+
+        if (m_nodes[child].parent == nullNode)
+            m_root = child;
+        else if (m_nodes[m_nodes[child].parent].child1 == a)
+            m_nodes[m_nodes[child].parent].child1 = child;
+        else
+            m_nodes[m_nodes[child].parent].child2 = child;
+
+        const u32 taller {m_nodes[f].height > m_nodes[g].height ? f : g};
+        const u32 shorter{taller == f ? g : f};
+
+        m_nodes[child].child2   = taller;
+        m_nodes[a].child1       = other;
+        m_nodes[a].child2       = shorter;
+        m_nodes[shorter].parent = a;
+
+        refit(a);
+        refit(child);
+
+        return child;
+    };
+
+    if (m_nodes[c].height > m_nodes[b].height + 1u)
+        return rotate(c, b);
+
+    if (m_nodes[b].height > m_nodes[c].height + 1u)
+        return rotate(b, c);
+
+    return a;
+}
+
+
+inline void DynamicAABBTree::insertLeaf(const u32 leaf)
+{
+    using namespace DynamicAABBTreeDetail;
+
+    if (m_root == nullNode)
+    {
+        m_root                = leaf;
+        m_nodes[leaf].parent  = nullNode;
+        return;
+    }
+
+    const Vec3 leafMin{m_nodes[leaf].min};
+    const Vec3 leafMax{m_nodes[leaf].max};
+
+    // Branch and bound on the surface area: pairing the leaf with a node costs
+    // the area of their union, plus the growth of all the ancestors
+    u32 sibling{m_root};
+    while (!m_nodes[sibling].isLeaf())
+    {
+        const Node& node{m_nodes[sibling]};
+
+        const f32 combined   {unionHalfArea(node.min, node.max, leafMin, leafMax)};
+        const f32 cost       {2.f * combined};
+        const f32 inheritance{2.f * (combined - halfArea(node.min, node.max))};
+
+        auto descentCost = [&](const u32 child)
+        {
+            const Node& childNode{m_nodes[child]};
+            const f32   area     {unionHalfArea(childNode.min, childNode.max, leafMin, leafMax)};
+
+            return (childNode.isLeaf() ? area : area - halfArea(childNode.min, childNode.max)) + inheritance;
+        };
+
+        const f32 cost1{descentCost(node.child1)};
+        const f32 cost2{descentCost(node.child2)};
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        sibling = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const u32 oldParent{m_nodes[sibling].parent};
+    const u32 newParent{allocateNode()};
+
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent   = newParent;
+    m_nodes[leaf].parent      = newParent;
+
+    if (oldParent == nullNode)
+        m_root = newParent;
+    else if (m_nodes[oldParent].child1 == sibling)
+        m_nodes[oldParent].child1 = newParent;
+    else
+        m_nodes[oldParent].child2 = newParent;
+
+    for (u32 node{newParent}; node != nullNode; node = m_nodes[node].parent)
+    {
+        node = balance(node);
+        refit(node);
+    }
+}
+
+
+inline void DynamicAABBTree::removeLeaf(const u32 leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = nullNode;
+        return;
+    }
+
+    const u32 parent     {m_nodes[leaf].parent};
+    const u32 grandParent{m_nodes[parent].parent};
+    const u32 sibling    {m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1};
+
+    m_nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    if (grandParent == nullNode)
+    {
+        m_root = sibling;
+        return;
+    }
+
+    if (m_nodes[grandParent].child1 == parent)
+        m_nodes[grandParent].child1 = sibling;
+    else
+        m_nodes[grandParent].child2 = sibling;
+
+    for (u32 node{grandParent}; node != nullNode; node = m_nodes[node].parent)
+    {
+        node = balance(node);
+        refit(node);
+    }
+}
+
+
+
+
+/* =================== Proxies =================== */
+inline void DynamicAABBTree::markMoved(const u32 proxy)
+{
+    if (m_states[proxy] == EProxyState::Unchanged)
+    {
+        m_states[proxy] = EProxyState::Moved;
+        m_moved.push_back(proxy);
+    }
+}
+
+
+inline u32 DynamicAABBTree::insert(const AABB& aabb, const u32 userData)
+{
+    const u32  proxy{allocateNode()};
+    const Vec3 fatExtents{aabb.extents + Vec3{m_margin}};
+
+    m_nodes[proxy].min      = aabb.center - fatExtents;
+    m_nodes[proxy].max      = aabb.center + fatExtents;
+    m_nodes[proxy].userData = userData;
+
+    insertLeaf(proxy);
+    markMoved(proxy);
+    ++m_proxyCount;
+
+    return proxy;
+}
+
+
+inline void DynamicAABBTree::remove(const u32 proxy)
+{
+    removeLeaf(proxy);
+    --m_proxyCount;
+
+    // Freed by updatePairs(), once its pairs are reported lost
+    if (m_states[proxy] == EProxyState::Unchanged)
+        m_moved.push_back(proxy);
+
+    m_states[proxy] = EProxyState::Removed;
+    m_removed.push_back(proxy);
+}
+
+
+inline bool DynamicAABBTree::move(const u32 proxy, const AABB& aabb, const Vec3& displacement)
+{
+    using namespace DynamicAABBTreeDetail;
+
+    const Vec3 min{aabb.center - aabb.extents};
+    const Vec3 max{aabb.center + aabb.extents};
+
+    Vec3 fatMin{min - Vec3{m_margin}};
+    Vec3 fatMax{max + Vec3{m_margin}};
+
+    const Vec3 stretch{displacement * displacementMultiplier};
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        if (stretch.e[axis] < .0f)
+            fatMin.e[axis] += stretch.e[axis];
+        else
+            fatMax.e[axis] += stretch.e[axis];
+    }
+
+    const Node& leaf   {m_nodes[proxy]};
+    const Vec3  hugeMin{fatMin - Vec3{hugeMarginMultiplier * m_margin}};
+    const Vec3  hugeMax{fatMax + Vec3{hugeMarginMultiplier * m_margin}};
+
+    if (contains(leaf.min, leaf.max, min, max) && contains(hugeMin, hugeMax, leaf.min, leaf.max))
+        return false;
+
+    removeLeaf(proxy);
+
+    m_nodes[proxy].min = fatMin;
+    m_nodes[proxy].max = fatMax;
+
+    insertLeaf(proxy);
+    markMoved(proxy);
+
+    return true;
+}
+
+
+
+
+/* =================== Queries =================== */
+template<typename F>
+inline void DynamicAABBTree::query(const AABB& aabb, F&& callback) const
+{
+    query(aabb.center - aabb.extents, aabb.center + aabb.extents, std::forward<F>(callback));
+}
+
+
+template<typename F>
+inline void DynamicAABBTree::query(const Vec3& min, const Vec3& max, F&& callback) const
+{
+    u32 node{m_root};
+    while (node != nullNode)
+    {
+        const Node& current{m_nodes[node]};
+
+        if (DynamicAABBTreeDetail::overlaps(current.min, current.max, min, max))
+        {
+            if (!current.isLeaf())
+            {
+                node = current.child1;
+                continue;
+            }
+
+            if (!callback(node))
+                return;
+        }
+
+        // Up to the first ancestor entered from its first child, then its second child
+        for (;;)
+        {
+            const u32 parent{m_nodes[node].parent};
+            if (parent == nullNode)
+                return;
+
+            if (m_nodes[parent].child1 == node)
+            {
+                node = m_nodes[parent].child2;
+                break;
+            }
+
+            node = parent;
+        }
+    }
+}
+
+
+inline void DynamicAABBTree::updatePairs(std::vector<DynamicAABBTreePair>& added, std::vector<DynamicAABBTreePair>& lost)
+{
+    added.clear();
+    lost.clear();
+
+    // Overlaps of the moved proxies, twice for two moved proxies
+    m_found.clear();
+    for (const u32 proxy : m_moved)
+    {
+        if (m_states[proxy] == EProxyState::Removed)
+            continue;
+
+        query(m_nodes[proxy].min, m_nodes[proxy].max, [&](const u32 other)
+        {
+            if (other != proxy)
+                m_found.push_back({std::min(proxy, other), std::max(proxy, other)});
+            return true;
+        });
+    }
+
+    std::sort(m_found.begin(), m_found.end());
+    m_found.erase(std::unique(m_found.begin(), m_found.end()), m_found.end());
+
+    // Pairs between unchanged proxies are kept, the others are compared with found
+    m_kept.clear();
+    m_touched.clear();
+
+    for (const DynamicAABBTreePair& pair : m_pairs)
+    {
+        if (m_states[pair.first] == EProxyState::Unchanged && m_states[pair.second] == EProxyState::Unchanged)
+            m_kept.push_back(pair);
+        else
+            m_touched.push_back(pair);
+    }
+
+    std::set_difference(m_found.begin(),   m_found.end(),   m_touched.begin(), m_touched.end(), std::back_inserter(added));
+    std::set_difference(m_touched.begin(), m_touched.end(), m_found.begin(),   m_found.end(),   std::back_inserter(lost));
+
+    m_pairs.clear();
+    std::merge(m_kept.begin(), m_kept.end(), m_found.begin(), m_found.end(), std::back_inserter(m_pairs));
+
+    for (const u32 proxy : m_moved)
+        m_states[proxy] = EProxyState::Unchanged;
+
+    for (const u32 proxy : m_removed)
+        freeNode(proxy);
+
+    m_moved.clear();
+    m_removed.clear();
+}
+
+
+
+
+/* =================== Getters =================== */
+inline AABB DynamicAABBTree::getFatAABB(const u32 proxy) const noexcept
+{
+    return {m_nodes[proxy].min, m_nodes[proxy].max};
+}
+
+
+inline u32 DynamicAABBTree::getHeight() const noexcept
+{
+    return m_root == nullNode ? 0u : m_nodes[m_root].height;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "Matrix4.hpp"
+#include "Transform.hpp"
+#include "Vector3SoA.hpp"
+#include "QuaternionSoA.hpp"
+#include "Calc.hpp"
+#include "SIMD.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Shape3D/Sphere.hpp"
+
+namespace GPM
+{
+
+enum class EFrustumPlane : u32
+{
+    Left,
+    Right,
+    Bottom,
+    Top,
+    Near,
+    Far
+};
+
+enum class EFrustumTest : u32
+{
+    Outside,
+    Intersecting,
+    Inside
+};
+
+// View frustum as six inward-facing planes {normal, d}: a point p is inside
+// when dot(normal, p) + d >= 0 for all of them, the same convention as
+// Plane::getSignedDistanceToPlane(). Normals are unit vectors, so the plane
+// equations give true distances.
+//
+// The tests are conservative: an object is culled when it lies entirely behind
+// one of the planes, so a few objects near the corners of the frustum are kept
+// although they are outside.
+class Frustum
+{
+protected:
+    Vec4 m_planes[6]{};
+
+public:
+    // Plane mask of Frustum::classify() with the six planes, bit i for EFrustumPlane i
+    static constexpr u32 allPlanes{0x3Fu};
+
+    // Constructors. The default frustum has null planes and culls nothing.
+    Frustum()                                                               = default;
+
+    // Planes of the clip volume -w <= x, y, z <= w of a view-projection matrix
+    // (Gribb and Hartmann), in the space the matrix transforms from: world
+    // space for projection * view, view space for a projection alone.
+    explicit Frustum(const Mat4& viewProjection)                            noexcept;
+
+    // Frustums of Transform::perspective() and Transform::orthographic(), placed
+    // in world space by the view matrix, the inverse of the camera transform,
+    // e.g. Transform::lookAt(eye, target).inversedAffine()
+    static Frustum perspective  (const f32 fovY,  const f32 aspect,
+                                 const f32 near_, const f32 far_,
+                                 const Mat4& view = Mat4::identity())       noexcept;
+    static Frustum orthographic (const f32 right, const f32 left,
+                                 const f32 top,   const f32 bottom,
+                                 const f32 near_, const f32 far_,
+                                 const Mat4& view = Mat4::identity())       noexcept;
+
+    // Getters
+    const Vec4&  getPlane       (const EFrustumPlane plane)                 const noexcept;
+    const Vec4*  getPlanes      ()                                          const noexcept { return m_planes; }
+
+    // Scalar tests, true when the shape may be visible
+    bool         isVisible      (const Vec3& point)                         const noexcept;
+    bool         isVisible      (const Sphere& sphere)                      const noexcept;
+    bool         isVisible      (const AABB& aabb)                          const noexcept;
+    bool         isVisible      (const OrientedBox& box)                    const noexcept;
+
+    // Test of a box against the planes of planeMask, for hierarchies: the planes
+    // the box is entirely in front of are removed from planeMask, so that its
+    // children only test the planes it straddles, and a box with an empty mask
+    // is Inside. lastPlane is tested first and receives the plane that rejects
+    // the box: objects culled by a plane are usually culled by the same plane
+    // on the next frame. It must be in [0, 5], e.g. 0 the first time.
+    EFrustumTest classify       (const AABB& aabb,
+                                 u32& planeMask, u8& lastPlane)             const noexcept;
+    EFrustumTest classify       (const Vec3& min, const Vec3& max,
+                                 u32& planeMask, u8& lastPlane)             const noexcept;
+
+    // Batched culling of SoA streams, GPM_SIMD_WIDTH objects against the six
+    // planes per iteration:
+    //  - spheres: centers and radii
+    //  - AABBs:   centers and half extents
+    //  - OBBs:    centers, half extents along the local axes and unit rotations
+    // Every stream must hold at least centers.size() elements.
+    //
+    // cull() sets bit i % 32 of bits[i / 32] when object i may be visible and
+    // clears it otherwise, bits must hold (centers.size() + 31) / 32 words.
+    void         cull           (const Vector3SoA& centers, const f32* radii,
+                                 u32* bits)                                 const noexcept;
+    void         cull           (const Vector3SoA& centers, const Vector3SoA& extents,
+                                 u32* bits)                                 const noexcept;
+    void         cull           (const Vector3SoA& centers, const Vector3SoA& extents,
+                                 const QuaternionSoA& rotations,
+                                 u32* bits)                                 const noexcept;
+
+    // cullIndices() writes the indices of the objects that may be visible to
+    // indices, in increasing order, and returns their count. indices must hold
+    // centers.size() elements.
+    size_t       cullIndices    (const Vector3SoA& centers, const f32* radii,
+                                 u32* indices)                              const noexcept;
+    size_t       cullIndices    (const Vector3SoA& centers, const Vector3SoA& extents,
+                                 u32* indices)                              const noexcept;
+    size_t       cullIndices    (const Vector3SoA& centers, const Vector3SoA& extents,
+                                 const QuaternionSoA& rotations,
+                                 u32* indices)                              const noexcept;
+};
+
+#include "Frustum.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,427 @@
+/* =================== Kernels =================== */
+// Every test is written once over the lane type, like the Math kernels: f32 for
+// the scalar methods and the tails, SIMD::f32v for whole registers.
+namespace FrustumCulling
+{
+
+using namespace Math::Kernel;
+
+inline u32 laneBits(const bool m) noexcept { return static_cast<u32>(m); }
+
+#if defined(GPM_USE_SSE)
+inline u32 laneBits(const SIMD::maskv m) noexcept { return SIMD::bits(m); }
+#endif
+
+
+template<typename V>
+inline V load(const f32* p) noexcept
+{
+    if constexpr (std::is_same_v<V, f32>)
+        return *p;
+    else
+        return SIMD::loadu(p);
+}
+
+
+// Plane equations with the absolute normals of the box tests, broadcast to the
+// lanes by the kernels
+struct Planes
+{
+    f32 x[6], y[6], z[6], d[6], absX[6], absY[6], absZ[6];
+
+    explicit Planes(const Vec4 (&planes)[6]) noexcept
+    {
+        for (u32 p{0u}; p < 6u; ++p)
+        {
+            x[p]    = planes[p].x;
+            y[p]    = planes[p].y;
+            z[p]    = planes[p].z;
+            d[p]    = planes[p].w;
+            absX[p] = fabsf(planes[p].x);
+            absY[p] = fabsf(planes[p].y);
+            absZ[p] = fabsf(planes[p].z);
+        }
+    }
+};
+
+
+template<typename V>
+inline V distance(const Planes& planes, const u32 p, const V x, const V y, const V z) noexcept
+{
+    return mulAdd(constant<V>(planes.x[p]), x, mulAdd(constant<V>(planes.y[p]), y,
+           mulAdd(constant<V>(planes.z[p]), z, constant<V>(planes.d[p]))));
+}
+
+
+// Visible while the center is at most radius behind every plane
+template<typename V>
+inline auto sphere(const Planes& planes, const V x, const V y, const V z, const V radius) noexcept
+{
+    const V minusRadius{negate(radius)};
+
+    auto visible{lessEqual(minusRadius, minusRadius)};
+    for (u32 p{0u}; p < 6u; ++p)
+        visible = maskAnd(visible, lessEqual(minusRadius, distance(planes, p, x, y, z)));
+
+    return visible;
+}
+
+
+// Same with the radius of the box projected on the normal, sum(extent * |normal|)
+template<typename V>
+inline auto aabb(const Planes& planes, const V x, const V y, const V z,
+                 const V ex, const V ey, const V ez) noexcept
+{
+    const V zero{constant<V>(.0f)};
+
+    auto visible{lessEqual(zero, zero)};
+    for (u32 p{0u}; p < 6u; ++p)
+    {
+        const V reach{mulAdd(constant<V>(planes.absX[p]), ex, mulAdd(constant<V>(planes.absY[p]), ey,
+                      mulAdd(constant<V>(planes.absZ[p]), ez, distance(planes, p, x, y, z))))};
+        visible = maskAnd(visible, lessEqual(zero, reach));
+    }
+
+    return visible;
+}
+
+
+// The local axes are the columns of the rotation matrix of the quaternion,
+// the projected radius is sum(extent_k * |dot(normal, axis_k)|)
+template<typename V>
+inline auto obb(const Planes& planes, const V x, const V y, const V z,
+                const V ex, const V ey, const V ez,
+                const V qx, const V qy, const V qz, const V qw) noexcept
+{
+    const V zero{constant<V>(.0f)}, one{constant<V>(1.f)}, two{constant<V>(2.f)};
+
+    const V x2{mul(qx, two)}, y2{mul(qy, two)}, z2{mul(qz, two)};
+    const V xx{mul(qx, x2)},  yy{mul(qy, y2)},  zz{mul(qz, z2)};
+    const V xy{mul(qx, y2)},  xz{mul(qx, z2)},  yz{mul(qy, z2)};
+    const V wx{mul(qw, x2)},  wy{mul(qw, y2)},  wz{mul(qw, z2)};
+
+    // Axes scaled by the extents
+    const V ix{mul(sub(one, add(yy, zz)), ex)}, iy{mul(add(xy, wz), ex)},           iz{mul(sub(xz, wy), ex)};
+    const V jx{mul(sub(xy, wz), ey)},           jy{mul(sub(one, add(xx, zz)), ey)}, jz{mul(add(yz, wx), ey)};
+    const V kx{mul(add(xz, wy), ez)},           ky{mul(sub(yz, wx), ez)},           kz{mul(sub(one, add(xx, yy)), ez)};
+
+    auto visible{lessEqual(zero, zero)};
+    for (u32 p{0u}; p < 6u; ++p)
+    {
+        const V nx{constant<V>(planes.x[p])}, ny{constant<V>(planes.y[p])}, nz{constant<V>(planes.z[p])};
+
+        const V ri{abs(mulAdd(nx, ix, mulAdd(ny, iy, mul(nz, iz))))};
+        const V rj{abs(mulAdd(nx, jx, mulAdd(ny, jy, mul(nz, jz))))};
+        const V rk{abs(mulAdd(nx, kx, mulAdd(ny, ky, mul(nz, kz))))};
+
+        visible = maskAnd(visible, lessEqual(zero, add(add(ri, rj), add(rk, distance(planes, p, x, y, z)))));
+    }
+
+    return visible;
+}
+
+
+// Box given by its center and half extents against the planes of mask, the
+// cached plane first
+inline EFrustumTest classify(const Vec4 (&planes)[6], const Vec3& center, const Vec3& extents,
+                             u32& mask, u8& lastPlane) noexcept
+{
+    const auto reach{[&](const u32 p, f32& distance)
+    {
+        const Vec4& plane{planes[p]};
+        distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        return fabsf(plane.x) * extents.x + fabsf(plane.y) * extents.y + fabsf(plane.z) * extents.z;
+    }};
+
+    f32 distance;
+    u32 remaining{mask};
+
+    if ((mask >> lastPlane) & 1u)
+    {
+        const f32 radius{reach(lastPlane, distance)};
+        if (distance + radius < .0f)
+            return EFrustumTest::Outside;
+
+        if (distance - radius >= .0f)
+            mask &= ~(1u << lastPlane);
+
+        remaining &= ~(1u << lastPlane);
+    }
+
+    for (u32 p{0u}; p < 6u; ++p)
+    {
+        if (((remaining >> p) & 1u) == 0u)
+            continue;
+
+        const f32 radius{reach(p, distance)};
+        if (distance + radius < .0f)
+        {
+            lastPlane = static_cast<u8>(p);
+            return EFrustumTest::Outside;
+        }
+
+        if (distance - radius >= .0f)
+            mask &= ~(1u << p);
+    }
+
+    return mask == 0u ? EFrustumTest::Inside : EFrustumTest::Intersecting;
+}
+
+
+// Drivers: test(V{}, i) returns the visibility of the objects i to i + lanes - 1.
+// Whole registers first, the last count % GPM_SIMD_WIDTH objects with V = f32.
+template<typename F>
+inline void toBits(const size_t count, u32* bits, F&& test) noexcept
+{
+    size_t i   {0u};
+    u32    word{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+    {
+        // GPM_SIMD_WIDTH divides 32, registers never straddle two words
+        word |= laneBits(test(SIMD::f32v{}, i)) << (i % 32u);
+
+        if ((i + GPM_SIMD_WIDTH) % 32u == 0u)
+        {
+            bits[i / 32u] = word;
+            word          = 0u;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        word |= laneBits(test(f32{}, i)) << (i % 32u);
+
+        if ((i + 1u) % 32u == 0u)
+        {
+            bits[i / 32u] = word;
+            word          = 0u;
+        }
+    }
+
+    if (count % 32u != 0u)
+        bits[count / 32u] = word;
+}
+
+
+template<typename F>
+inline size_t toIndices(const size_t count, u32* indices, F&& test) noexcept
+{
+    size_t i   {0u};
+    size_t size{0u};
+
+    // Branchless compaction: every lane writes its index, only the visible ones
+    // advance the output. size <= i + lane, so the writes stay in the array.
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+    {
+        const u32 lanes{laneBits(test(SIMD::f32v{}, i))};
+
+        for (u32 lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        {
+            indices[size] = static_cast<u32>(i + lane);
+            size         += (lanes >> lane) & 1u;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        indices[size] = static_cast<u32>(i);
+        size         += laneBits(test(f32{}, i));
+    }
+
+    return size;
+}
+
+
+// Visibility tests of the SoA streams, one generic lambda for both lane types
+inline auto sphereTest(const Vec4 (&planes)[6], const Vector3SoA& centers, const f32* radii) noexcept
+{
+    return [p = Planes{planes}, &centers, radii]
+           (const auto lane, const size_t i) noexcept
+    {
+        using V = std::decay_t<decltype(lane)>;
+        return sphere(p, load<V>(centers.x() + i), load<V>(centers.y() + i), load<V>(centers.z() + i), load<V>(radii + i));
+    };
+}
+
+
+inline auto aabbTest(const Vec4 (&planes)[6], const Vector3SoA& centers, const Vector3SoA& extents) noexcept
+{
+    return [p = Planes{planes}, &centers, &extents]
+           (const auto lane, const size_t i) noexcept
+    {
+        using V = std::decay_t<decltype(lane)>;
+        return aabb(p, load<V>(centers.x() + i), load<V>(centers.y() + i), load<V>(centers.z() + i),
+                       load<V>(extents.x() + i), load<V>(extents.y() + i), load<V>(extents.z() + i));
+    };
+}
+
+
+inline auto obbTest(const Vec4 (&planes)[6], const Vector3SoA& centers, const Vector3SoA& extents,
+                    const QuaternionSoA& rotations) noexcept
+{
+    return [p = Planes{planes}, &centers, &extents, &rotations]
+           (const auto lane, const size_t i) noexcept
+    {
+        using V = std::decay_t<decltype(lane)>;
+        return obb(p, load<V>(centers.x() + i),   load<V>(centers.y() + i),   load<V>(centers.z() + i),
+                      load<V>(extents.x() + i),   load<V>(extents.y() + i),   load<V>(extents.z() + i),
+                      load<V>(rotations.x() + i), load<V>(rotations.y() + i), load<V>(rotations.z() + i),
+                      load<V>(rotations.w() + i));
+    };
+}
+
+} // End of namespace FrustumCulling
+
+
+
+
+/* =================== Constructors =================== */
+inline Frustum::Frustum(const Mat4& viewProjection) noexcept
+{
+    // Rows of the matrix, which is stored by columns
+    Vec4 rows[4];
+    for (u32 r{0u}; r < 4u; ++r)
+        rows[r] = {viewProjection.e[r], viewProjection.e[4u + r], viewProjection.e[8u + r], viewProjection.e[12u + r]};
+
+    // -w <= x: row3 + row0 >= 0, x <= w: row3 - row0 >= 0, and so on
+    for (u32 p{0u}; p < 6u; ++p)
+    {
+        const Vec4& row {rows[p / 2u]};
+        const f32   sign{p % 2u == 0u ? 1.f : -1.f};
+
+        Vec4 plane{rows[3].x + sign * row.x, rows[3].y + sign * row.y,
+                   rows[3].z + sign * row.z, rows[3].w + sign * row.w};
+
+        const f32 length{sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z)};
+        if (length > .0f)
+        {
+            const f32 reciprocal{1.f / length};
+            plane = {plane.x * reciprocal, plane.y * reciprocal, plane.z * reciprocal, plane.w * reciprocal};
+        }
+
+        m_planes[p] = plane;
+    }
+}
+
+
+inline Frustum Frustum::perspective(const f32 fovY,  const f32 aspect,
+                                    const f32 near_, const f32 far_, const Mat4& view) noexcept
+{
+    return Frustum{Transform::perspective(fovY, aspect, near_, far_) * view};
+}
+
+
+inline Frustum Frustum::orthographic(const f32 right, const f32 left, const f32 top, const f32 bottom,
+                                     const f32 near_, const f32 far_, const Mat4& view) noexcept
+{
+    return Frustum{Transform::orthographic(right, left, top, bottom, near_, far_) * view};
+}
+
+
+
+
+/* =================== Getters =================== */
+inline const Vec4& Frustum::getPlane(const EFrustumPlane plane) const noexcept
+{
+    return m_planes[static_cast<u32>(plane)];
+}
+
+
+
+
+/* =================== Scalar tests =================== */
+inline bool Frustum::isVisible(const Vec3& point) const noexcept
+{
+    return FrustumCulling::sphere(FrustumCulling::Planes{m_planes}, point.x, point.y, point.z, .0f);
+}
+
+
+inline bool Frustum::isVisible(const Sphere& sphere) const noexcept
+{
+    const Vec3 center{sphere.getCenter()};
+
+    return FrustumCulling::sphere(FrustumCulling::Planes{m_planes}, center.x, center.y, center.z, sphere.getRadius());
+}
+
+
+inline bool Frustum::isVisible(const AABB& aabb) const noexcept
+{
+    return FrustumCulling::aabb(FrustumCulling::Planes{m_planes}, aabb.center.x, aabb.center.y, aabb.center.z,
+                                aabb.extents.x, aabb.extents.y, aabb.extents.z);
+}
+
+
+inline bool Frustum::isVisible(const OrientedBox& box) const noexcept
+{
+    const Referential referential{box.getReferential()};
+    const Vec3        axes[3]{referential.unitI * box.getExtI(),
+                              referential.unitJ * box.getExtJ(),
+                              referential.unitK * box.getExtK()};
+
+    for (const Vec4& plane : m_planes)
+    {
+        const Vec3 normal{plane.x, plane.y, plane.z};
+        const f32  reach {fabsf(normal.dot(axes[0])) + fabsf(normal.dot(axes[1])) + fabsf(normal.dot(axes[2])) +
+                          normal.dot(referential.origin) + plane.w};
+
+        if (reach < .0f)
+            return false;
+    }
+
+    return true;
+}
+
+
+inline EFrustumTest Frustum::classify(const AABB& aabb, u32& planeMask, u8& lastPlane) const noexcept
+{
+    return FrustumCulling::classify(m_planes, aabb.center, aabb.extents, planeMask, lastPlane);
+}
+
+
+inline EFrustumTest Frustum::classify(const Vec3& min, const Vec3& max, u32& planeMask, u8& lastPlane) const noexcept
+{
+    return FrustumCulling::classify(m_planes, (min + max) * .5f, (max - min) * .5f, planeMask, lastPlane);
+}
+
+
+
+
+/* =================== Batched culling =================== */
+inline void Frustum::cull(const Vector3SoA& centers, const f32* radii, u32* bits) const noexcept
+{
+    FrustumCulling::toBits(centers.size(), bits, FrustumCulling::sphereTest(m_planes, centers, radii));
+}
+
+
+inline void Frustum::cull(const Vector3SoA& centers, const Vector3SoA& extents, u32* bits) const noexcept
+{
+    FrustumCulling::toBits(centers.size(), bits, FrustumCulling::aabbTest(m_planes, centers, extents));
+}
+
+
+inline void Frustum::cull(const Vector3SoA& centers, const Vector3SoA& extents,
+                          const QuaternionSoA& rotations, u32* bits) const noexcept
+{
+    FrustumCulling::toBits(centers.size(), bits, FrustumCulling::obbTest(m_planes, centers, extents, rotations));
+}
+
+
+inline size_t Frustum::cullIndices(const Vector3SoA& centers, const f32* radii, u32* indices) const noexcept
+{
+    return FrustumCulling::toIndices(centers.size(), indices, FrustumCulling::sphereTest(m_planes, centers, radii));
+}
+
+
+inline size_t Frustum::cullIndices(const Vector3SoA& centers, const Vector3SoA& extents, u32* indices) const noexcept
+{
+    return FrustumCulling::toIndices(centers.size(), indices, FrustumCulling::aabbTest(m_planes, centers, extents));
+}
+
+
+inline size_t Frustum::cullIndices(const Vector3SoA& centers, const Vector3SoA& extents,
+                                   const QuaternionSoA& rotations, u32* indices) const noexcept
+{
+    return FrustumCulling::toIndices(centers.size(), indices,
+                                     FrustumCulling::obbTest(m_planes, centers, extents, rotations));
+}
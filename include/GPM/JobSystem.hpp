@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Types.hpp"
+
+namespace GPM
+{
+
+// Small work-stealing thread pool used by the parallel algorithms of GPM.
+// Every worker owns a queue: it pops its own jobs from the back and steals
+// from the front of the other queues when it runs out. Threads waiting on
+// a parallelFor() execute pending jobs instead of blocking, so parallelFor()
+// can be nested and called from any thread.
+// Jobs must not throw.
+class JobSystem
+{
+public:
+    struct Job
+    {
+        void              (*function)(void* context, u32 begin, u32 end) noexcept;
+        void*               context;
+        u32                 begin;
+        u32                 end;
+        std::atomic<u32>*   pending;
+    };
+
+protected:
+    struct Queue
+    {
+        std::mutex      mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread>            m_workers;
+
+    std::mutex                          m_sleepMutex;
+    std::condition_variable             m_wake;
+    std::atomic<u32>                    m_queuedCount{0u};
+    std::atomic<u32>                    m_nextQueue  {0u};
+    bool                                m_stop       {false};
+
+    static u32& threadQueueIndex() noexcept;
+
+    void push       (const Job& job);
+    bool tryPop     (const u32 queueIndex, Job& job);
+    bool trySteal   (const u32 thiefIndex, Job& job);
+    bool tryExecute (const u32 queueIndex);
+    void workerLoop (const u32 queueIndex);
+
+public:
+    // workerCount threads are spawned, the thread calling parallelFor() being the extra one
+    explicit JobSystem(const u32 workerCount = defaultWorkerCount());
+    JobSystem(const JobSystem& other)                   = delete;
+    JobSystem(JobSystem&& other)                        = delete;
+    ~JobSystem();
+    JobSystem& operator=(JobSystem const& other)        = delete;
+    JobSystem& operator=(JobSystem&& other)             = delete;
+
+    static u32        defaultWorkerCount()              noexcept;
+    static JobSystem& global            ();
+
+    u32               workerCount       ()              const noexcept { return static_cast<u32>(m_workers.size()); }
+
+    // Calls function(begin, end) over sub-ranges of [0, count) of at least
+    // minRangeSize elements, and returns once the whole range has been processed.
+    template<typename F>
+    void              parallelFor       (const u32 count, const u32 minRangeSize, F&& function);
+};
+
+#include "JobSystem.inl"
+
+} // End of namespace GPM
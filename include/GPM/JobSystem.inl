@@ -0,0 +1,192 @@
+/* =================== Constructors =================== */
+inline JobSystem::JobSystem(const u32 workerCount)
+{
+    // One queue per worker, plus one so that a pool without workers still has
+    // a queue. push() spreads the jobs of other threads over all of them.
+    m_queues.reserve(workerCount + 1u);
+    for (u32 i{0u}; i <= workerCount; ++i)
+        m_queues.push_back(std::make_unique<Queue>());
+
+    m_workers.reserve(workerCount);
+    for (u32 i{0u}; i < workerCount; ++i)
+        m_workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+
+inline JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_sleepMutex};
+        m_stop = true;
+    }
+
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers)
+        worker.join();
+}
+
+
+inline u32 JobSystem::defaultWorkerCount() noexcept
+{
+    const u32 hardwareThreads{std::thread::hardware_concurrency()};
+
+    return hardwareThreads > 1u ? hardwareThreads - 1u : 0u;
+}
+
+
+inline JobSystem& JobSystem::global()
+{
+    static JobSystem jobSystem;
+
+    return jobSystem;
+}
+
+
+
+
+/* =================== Scheduling =================== */
+// Queue owned by the calling thread, or ~0u for threads that are not workers
+inline u32& JobSystem::threadQueueIndex() noexcept
+{
+    thread_local u32 index{~0u};
+
+    return index;
+}
+
+
+inline void JobSystem::push(const Job& job)
+{
+    u32 queueIndex{threadQueueIndex()};
+
+    if (queueIndex >= m_queues.size())
+        queueIndex = m_nextQueue.fetch_add(1u, std::memory_order_relaxed) % static_cast<u32>(m_queues.size());
+
+    {
+        std::lock_guard<std::mutex> lock{m_queues[queueIndex]->mutex};
+        m_queues[queueIndex]->jobs.push_back(job);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{m_sleepMutex};
+        m_queuedCount.fetch_add(1u, std::memory_order_release);
+    }
+
+    m_wake.notify_one();
+}
+
+
+inline bool JobSystem::tryPop(const u32 queueIndex, Job& job)
+{
+    Queue& queue{*m_queues[queueIndex]};
+    std::lock_guard<std::mutex> lock{queue.mutex};
+
+    if (queue.jobs.empty())
+        return false;
+
+    job = queue.jobs.back();
+    queue.jobs.pop_back();
+    m_queuedCount.fetch_sub(1u, std::memory_order_relaxed);
+
+    return true;
+}
+
+
+inline bool JobSystem::trySteal(const u32 thiefIndex, Job& job)
+{
+    const u32 queueCount{static_cast<u32>(m_queues.size())};
+
+    for (u32 offset{1u}; offset <= queueCount; ++offset)
+    {
+        Queue& queue{*m_queues[(thiefIndex + offset) % queueCount]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+
+        if (queue.jobs.empty())
+            continue;
+
+        job = queue.jobs.front();
+        queue.jobs.pop_front();
+        m_queuedCount.fetch_sub(1u, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    return false;
+}
+
+
+inline bool JobSystem::tryExecute(const u32 queueIndex)
+{
+    Job job;
+
+    if (!(queueIndex < m_queues.size() && tryPop(queueIndex, job)) &&
+        !trySteal(queueIndex < m_queues.size() ? queueIndex : 0u, job))
+        return false;
+
+    job.function(job.context, job.begin, job.end);
+    job.pending->fetch_sub(1u, std::memory_order_acq_rel);
+
+    return true;
+}
+
+
+inline void JobSystem::workerLoop(const u32 queueIndex)
+{
+    threadQueueIndex() = queueIndex;
+
+    for (;;)
+    {
+        if (tryExecute(queueIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock{m_sleepMutex};
+        m_wake.wait(lock, [this] { return m_stop || m_queuedCount.load(std::memory_order_acquire) != 0u; });
+
+        if (m_stop)
+            return;
+    }
+}
+
+
+template<typename F>
+inline void JobSystem::parallelFor(const u32 count, const u32 minRangeSize, F&& function)
+{
+    if (count == 0u)
+        return;
+
+    // A few ranges per thread leaves room for stealing without flooding the queues
+    const u32 threadCount{workerCount() + 1u};
+    const u32 targetSize {(count + threadCount * 4u - 1u) / (threadCount * 4u)};
+    const u32 rangeSize  {targetSize > minRangeSize ? targetSize : (minRangeSize > 0u ? minRangeSize : 1u)};
+
+    if (m_workers.empty() || rangeSize >= count)
+    {
+        function(0u, count);
+        return;
+    }
+
+    using Function = std::remove_reference_t<F>;
+    const auto trampoline = [](void* context, const u32 begin, const u32 end) noexcept
+    {
+        (*static_cast<Function*>(context))(begin, end);
+    };
+
+    std::atomic<u32> pending{(count + rangeSize - 1u) / rangeSize};
+
+    // The calling thread keeps the first range for itself
+    for (u32 begin{rangeSize}; begin < count; begin += rangeSize)
+    {
+        const u32 end{begin + rangeSize < count ? begin + rangeSize : count};
+        push({trampoline, const_cast<void*>(static_cast<const void*>(&function)), begin, end, &pending});
+    }
+
+    function(0u, rangeSize);
+    pending.fetch_sub(1u, std::memory_order_acq_rel);
+
+    // Help instead of waiting: this also makes nested calls safe
+    while (pending.load(std::memory_order_acquire) != 0u)
+    {
+        if (!tryExecute(threadQueueIndex()))
+            std::this_thread::yield();
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "JobSystem.hpp"
+#include "NearestHeap.hpp"
+
+namespace GPM
+{
+
+// Static k-d tree over Vec3 or Vec2 points. The layout is implicit: the points
+// are reordered so that the root of the subtree [begin, end) is its median
+// (begin + end) / 2, with the left subtree before it and the right one after,
+// split along the axis of largest spread. Only the points, their input
+// indices and one split axis per point are stored.
+template<typename T>
+class KdTree
+{
+protected:
+    static constexpr u32 dimension{sizeof(T::e) / sizeof(f32)};
+
+    std::vector<T>   m_points;      // In tree order
+    std::vector<u32> m_indices;     // Input index of each point
+    std::vector<u8>  m_axes;        // Split axis of each subtree root
+
+    void   build         (const T* points, const size_t count, JobSystem* jobs);
+    void   buildSubtree  (const T* points, const u32 begin, const u32 end);
+    void   splitRange    (const T* points, const u32 begin, const u32 end);
+
+public:
+    static constexpr u32 nullIndex{~0u};
+
+    // Constructors
+    KdTree()                                                                = default;
+    KdTree(const T* points, const size_t count);
+    KdTree(const T* points, const size_t count, JobSystem& jobs);
+
+    // Builds the tree, in parallel with jobs: the median splits near the root
+    // are done in order, then the subtrees below them are built as jobs. Both
+    // give the same tree.
+    void   build         (const T* points, const size_t count);
+    void   build         (const T* points, const size_t count, JobSystem& jobs);
+
+    // k nearest points within maxDistance: writes their input indices to out
+    // and their squared distances to sqrDistances, nearest first, and returns
+    // their count. Both arrays must hold k elements.
+    // With epsilon > 0, the search is approximate: the points returned are
+    // at most 1 + epsilon times farther than the exact ones, and subtrees that
+    // can't beat that are skipped, which saves many visits in dense clouds.
+    size_t nearest       (const T& point, const u32 k, u32* out, f32* sqrDistances,
+                          const f32 epsilon     = .0f,
+                          const f32 maxDistance = std::numeric_limits<f32>::infinity()) const noexcept;
+
+    // Radius search: writes the first capacity indices of the points within
+    // radius of point to out, in no particular order, and returns their total count
+    size_t radius        (const T& point, const f32 radius,
+                          u32* out, const size_t capacity)                  const noexcept;
+
+    // Batched queries, one per point of points, in parallel with jobs. Query i
+    // writes to out + i * k and sqrDistances + i * k, or out + i * capacity,
+    // and its count to counts[i]. Unused slots of nearest() hold nullIndex.
+    void   nearest       (const T* points, const size_t count, const u32 k,
+                          u32* out, f32* sqrDistances, u32* counts,
+                          JobSystem& jobs, const f32 epsilon = .0f)         const;
+    void   radius        (const T* points, const size_t count, const f32 radius,
+                          u32* out, const size_t capacity, u32* counts,
+                          JobSystem& jobs)                                  const;
+
+    // Getters
+    size_t     size      ()                                                 const noexcept { return m_points.size(); }
+    bool       empty     ()                                                 const noexcept { return m_points.empty(); }
+    const T*   points    ()                                                 const noexcept { return m_points.data(); }
+    const u32* indices   ()                                                 const noexcept { return m_indices.data(); }
+};
+
+using KdTree3 = KdTree<Vec3>;
+using KdTree2 = KdTree<Vec2>;
+
+#include "KdTree.inl"
+
+} // End of namespace GPM
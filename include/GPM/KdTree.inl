@@ -0,0 +1,333 @@
+/* =================== Helpers =================== */
+namespace KdTreeDetail
+{
+
+// Subtrees of the parallel build are at least this large
+constexpr u32 minTaskSize{4096u};
+
+// Implicit trees of up to 2^32 points are less than 33 levels deep
+constexpr u32 stackSize{64u};
+
+
+template<typename T>
+inline f32 sqrDistance(const T& a, const T& b) noexcept
+{
+    f32 sum{.0f};
+    for (u32 axis{0u}; axis < sizeof(T::e) / sizeof(f32); ++axis)
+    {
+        const f32 offset{a.e[axis] - b.e[axis]};
+        sum += offset * offset;
+    }
+
+    return sum;
+}
+
+} // End of namespace KdTreeDetail
+
+
+
+
+/* =================== Constructors =================== */
+template<typename T>
+inline KdTree<T>::KdTree(const T* points, const size_t count)
+{
+    build(points, count, nullptr);
+}
+
+
+template<typename T>
+inline KdTree<T>::KdTree(const T* points, const size_t count, JobSystem& jobs)
+{
+    build(points, count, &jobs);
+}
+
+
+
+
+/* =================== Build =================== */
+template<typename T>
+inline void KdTree<T>::build(const T* points, const size_t count)
+{
+    build(points, count, nullptr);
+}
+
+
+template<typename T>
+inline void KdTree<T>::build(const T* points, const size_t count, JobSystem& jobs)
+{
+    build(points, count, &jobs);
+}
+
+
+template<typename T>
+inline void KdTree<T>::build(const T* points, const size_t count, JobSystem* jobs)
+{
+    m_indices.resize(count);
+    m_axes.assign(count, u8{0u});
+
+    for (size_t i{0u}; i < count; ++i)
+        m_indices[i] = static_cast<u32>(i);
+
+    if (jobs && jobs->workerCount() > 0u)
+    {
+        // Splits the ranges in order down to a few tasks per thread
+        const u32 taskSize{std::max(static_cast<u32>(count / (4u * (jobs->workerCount() + 1u))), KdTreeDetail::minTaskSize)};
+
+        struct Range
+        {
+            u32 begin;
+            u32 end;
+        };
+
+        std::vector<Range> pending{{0u, static_cast<u32>(count)}};
+        std::vector<Range> tasks;
+
+        while (!pending.empty())
+        {
+            const Range range{pending.back()};
+            pending.pop_back();
+
+            if (range.end - range.begin <= taskSize)
+            {
+                tasks.push_back(range);
+                continue;
+            }
+
+            splitRange(points, range.begin, range.end);
+
+            const u32 median{(range.begin + range.end) / 2u};
+            pending.push_back({median + 1u, range.end});
+            pending.push_back({range.begin, median});
+        }
+
+        jobs->parallelFor(static_cast<u32>(tasks.size()), 1u, [&](const u32 begin, const u32 end)
+        {
+            for (u32 task{begin}; task < end; ++task)
+                buildSubtree(points, tasks[task].begin, tasks[task].end);
+        });
+    }
+    else
+    {
+        buildSubtree(points, 0u, static_cast<u32>(count));
+    }
+
+    m_points.resize(count);
+    for (size_t i{0u}; i < count; ++i)
+        m_points[i] = points[m_indices[i]];
+}
+
+
+// Places the median of [begin, end) along the axis of largest spread at its middle
+template<typename T>
+inline void KdTree<T>::splitRange(const T* points, const u32 begin, const u32 end)
+{
+    T min{points[m_indices[begin]]};
+    T max{min};
+
+    for (u32 i{begin + 1u}; i < end; ++i)
+    {
+        const T& point{points[m_indices[i]]};
+        for (u32 axis{0u}; axis < dimension; ++axis)
+        {
+            min.e[axis] = std::min(min.e[axis], point.e[axis]);
+            max.e[axis] = std::max(max.e[axis], point.e[axis]);
+        }
+    }
+
+    u32 axis{0u};
+    for (u32 other{1u}; other < dimension; ++other)
+        if (max.e[other] - min.e[other] > max.e[axis] - min.e[axis])
+            axis = other;
+
+    const u32 median{(begin + end) / 2u};
+    std::nth_element(m_indices.begin() + begin, m_indices.begin() + median, m_indices.begin() + end,
+                     [points, axis](const u32 a, const u32 b) { return points[a].e[axis] < points[b].e[axis]; });
+
+    m_axes[median] = static_cast<u8>(axis);
+}
+
+
+template<typename T>
+inline void KdTree<T>::buildSubtree(const T* points, const u32 begin, const u32 end)
+{
+    if (end - begin < 2u)
+        return;
+
+    splitRange(points, begin, end);
+
+    const u32 median{(begin + end) / 2u};
+    buildSubtree(points, begin, median);
+    buildSubtree(points, median + 1u, end);
+}
+
+
+
+
+/* =================== Queries =================== */
+template<typename T>
+inline size_t KdTree<T>::nearest(const T& point, const u32 k, u32* out, f32* sqrDistances,
+                                 const f32 epsilon, const f32 maxDistance) const noexcept
+{
+    if (k == 0u || m_points.empty())
+        return 0u;
+
+    // Subtrees to visit with a lower bound of their squared distance, the near
+    // side of each split is followed first and the far one pushed
+    struct Entry
+    {
+        u32 begin;
+        u32 end;
+        f32 bound;
+    };
+
+    const f32 maxSqrDistance{maxDistance * maxDistance};
+    const f32 shrink        {1.f / ((1.f + epsilon) * (1.f + epsilon))};
+
+    Entry  stack[KdTreeDetail::stackSize];
+    u32    top  {0u};
+    size_t found{0u};
+
+    // Subtrees beyond this squared distance can't improve the result enough
+    auto threshold = [&]()
+    {
+        return found < k ? maxSqrDistance : sqrDistances[0] * shrink;
+    };
+
+    stack[top++] = {0u, static_cast<u32>(m_points.size()), .0f};
+
+    while (top > 0u)
+    {
+        Entry entry{stack[--top]};
+
+        if (entry.bound > threshold())
+            continue;
+
+        while (entry.begin < entry.end)
+        {
+            const u32 median     {(entry.begin + entry.end) / 2u};
+            const f32 sqrDistance{KdTreeDetail::sqrDistance(point, m_points[median])};
+
+            if (found < k)
+            {
+                if (sqrDistance <= maxSqrDistance)
+                {
+                    out[found]          = m_indices[median];
+                    sqrDistances[found] = sqrDistance;
+                    NearestHeap::siftUp(sqrDistances, out, found++);
+                }
+            }
+            else if (sqrDistance < sqrDistances[0])
+            {
+                out[0]          = m_indices[median];
+                sqrDistances[0] = sqrDistance;
+                NearestHeap::siftDown(sqrDistances, out, k, 0u);
+            }
+
+            const u32 axis  {m_axes[median]};
+            const f32 offset{point.e[axis] - m_points[median].e[axis]};
+            const f32 bound {std::max(entry.bound, offset * offset)};
+
+            const Entry left {entry.begin, median, entry.bound};
+            const Entry right{median + 1u, entry.end, entry.bound};
+
+            const Entry& near{offset < .0f ? left : right};
+            const Entry& far {offset < .0f ? right : left};
+
+            if (far.begin < far.end && bound <= threshold())
+                stack[top++] = {far.begin, far.end, bound};
+
+            entry = near;
+        }
+    }
+
+    NearestHeap::sort(sqrDistances, out, found);
+
+    return found;
+}
+
+
+template<typename T>
+inline size_t KdTree<T>::radius(const T& point, const f32 radius, u32* out, const size_t capacity) const noexcept
+{
+    struct Entry
+    {
+        u32 begin;
+        u32 end;
+    };
+
+    const f32 sqrRadius{radius * radius};
+
+    Entry  stack[KdTreeDetail::stackSize];
+    u32    top  {0u};
+    size_t count{0u};
+
+    stack[top++] = {0u, static_cast<u32>(m_points.size())};
+
+    while (top > 0u)
+    {
+        Entry entry{stack[--top]};
+
+        while (entry.begin < entry.end)
+        {
+            const u32 median{(entry.begin + entry.end) / 2u};
+
+            if (KdTreeDetail::sqrDistance(point, m_points[median]) <= sqrRadius)
+            {
+                if (count < capacity)
+                    out[count] = m_indices[median];
+                ++count;
+            }
+
+            const u32 axis  {m_axes[median]};
+            const f32 offset{point.e[axis] - m_points[median].e[axis]};
+
+            const Entry left {entry.begin, median};
+            const Entry right{median + 1u, entry.end};
+
+            const Entry& near{offset < .0f ? left : right};
+            const Entry& far {offset < .0f ? right : left};
+
+            if (far.begin < far.end && offset * offset <= sqrRadius)
+                stack[top++] = far;
+
+            entry = near;
+        }
+    }
+
+    return count;
+}
+
+
+template<typename T>
+inline void KdTree<T>::nearest(const T* points, const size_t count, const u32 k, u32* out, f32* sqrDistances,
+                               u32* counts, JobSystem& jobs, const f32 epsilon) const
+{
+    jobs.parallelFor(static_cast<u32>(count), 64u, [&](const u32 begin, const u32 end)
+    {
+        for (u32 i{begin}; i < end; ++i)
+        {
+            u32* queryOut      {out + static_cast<size_t>(i) * k};
+            f32* queryDistances{sqrDistances + static_cast<size_t>(i) * k};
+
+            counts[i] = static_cast<u32>(nearest(points[i], k, queryOut, queryDistances, epsilon));
+
+            for (u32 slot{counts[i]}; slot < k; ++slot)
+            {
+                queryOut[slot]       = nullIndex;
+                queryDistances[slot] = std::numeric_limits<f32>::infinity();
+            }
+        }
+    });
+}
+
+
+template<typename T>
+inline void KdTree<T>::radius(const T* points, const size_t count, const f32 radius, u32* out, const size_t capacity,
+                              u32* counts, JobSystem& jobs) const
+{
+    jobs.parallelFor(static_cast<u32>(count), 64u, [&](const u32 begin, const u32 end)
+    {
+        for (u32 i{begin}; i < end; ++i)
+            counts[i] = static_cast<u32>(this->radius(points[i], radius, out + static_cast<size_t>(i) * capacity, capacity));
+    });
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Frustum.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Shape3D/Sphere.hpp"
+
+namespace GPM
+{
+
+// User data of an object and parameter of the point origin + t * direction
+// where the ray enters its bounds, 0 when the origin is inside
+struct LooseOctreeHit
+{
+    u32 userData;
+    f32 t;
+};
+
+// Loose octree (Ulrich 2000) over a cubic world: the bounds of a node are its
+// cube scaled by 2 around its center, so that an object fits in any node of
+// half size at least its largest half extent whose cube contains its center.
+// Objects therefore go straight down the path of their Morton code, to the
+// depth of their size, with no straddling at the cube boundaries.
+//
+// Subdivision is lazy: an object stops at the deepest existing node of its
+// path until that node holds more than splitThreshold objects, which then
+// moves the ones small enough down to new children. Empty nodes are released.
+// Nodes and objects live in pools with free lists, and an object handle stays
+// valid until remove().
+//
+// Spheres and oriented boxes are stored as their enclosing AABB, the queries
+// test these bounds. Objects must lie within the world cube.
+class LooseOctree
+{
+protected:
+    struct Node
+    {
+        Vec3 center;
+        f32  halfSize;
+        u64  code;          // Locational code: 1 followed by the 3-bit child indices from the root
+        u32  parent;
+        u32  depth;
+        u32  children[8];
+        u32  firstObject;
+        u32  objectCount;
+        bool subdivided;    // Split once, new objects create the children they need
+    };
+
+    struct Object
+    {
+        Vec3 min;
+        u32  node;          // nullIndex when free
+        Vec3 max;
+        u32  next;          // Next object of the node, or next free object
+        u32  previous;
+        u32  userData;
+        u32  fitDepth;      // Deepest level whose nodes can hold it
+        u64  morton;        // Interleaved cell of the center at maxDepth
+    };
+
+    std::vector<Node>   m_nodes;
+    std::vector<Object> m_objects;
+    u32                 m_freeNodes  {nullIndex};
+    u32                 m_freeObjects{nullIndex};
+    size_t              m_objectCount{0u};
+    size_t              m_nodeCount  {0u};
+    Vec3                m_min;
+    f32                 m_halfSize;
+    u32                 m_maxDepth;
+
+    u32  allocateNode   (const u32 parent, const u32 child);
+    void releaseEmpty   (u32 node)                                              noexcept;
+    void place          (const u32 object, const Vec3& min, const Vec3& max)    noexcept;
+    void link           (const u32 object, const u32 node)                      noexcept;
+    void unlink         (const u32 object)                                      noexcept;
+    void descend        (const u32 object);
+    void split          (const u32 node);
+    u32  childIndex     (const u32 object, const u32 depth)                     const noexcept;
+    bool isOnPath       (const u32 object, const u32 node)                      const noexcept;
+    bool looseContains  (const u32 node, const Vec3& min, const Vec3& max)      const noexcept;
+    void looseBounds    (const u32 node, Vec3& min, Vec3& max)                  const noexcept;
+    void appendSubtree  (const u32 node, u32* out, const size_t capacity,
+                         size_t& count)                                         const noexcept;
+
+    // Calls visit(object) for every object whose bounds and the loose bounds of
+    // its ancestors pass overlaps(min, max)
+    template<typename O, typename F>
+    void traverse       (O&& overlaps, F&& visit)                               const noexcept;
+
+public:
+    static constexpr u32 nullIndex      {~0u};
+    static constexpr u32 maxDepthLimit  {21u};      // 63 bits of Morton code
+    static constexpr u32 splitThreshold {8u};
+
+    // Constructors. The world is the cube center +/- halfSize, down to maxDepth
+    // levels below the root (at most maxDepthLimit), e.g. 16 km with 16 levels
+    // gives nodes of 0.25 m.
+    LooseOctree(const Vec3& center, const f32 halfSize, const u32 maxDepth = 16u);
+
+    // Insertion returns the handle of the object, userData is reported by the queries
+    u32         insert          (const AABB& aabb, const u32 userData);
+    u32         insert          (const Sphere& sphere, const u32 userData);
+    u32         insert          (const OrientedBox& box, const u32 userData);
+    void        remove          (const u32 handle);
+
+    // Updates the bounds of an object. When they stay within the loose bounds
+    // of its node, which small moves usually do, only the object is touched;
+    // otherwise it is moved to another node: returns true in that case.
+    bool        relocate        (const u32 handle, const AABB& aabb);
+    bool        relocate        (const u32 handle, const Sphere& sphere);
+    bool        relocate        (const u32 handle, const OrientedBox& box);
+
+    // Queries: the first capacity results are written to out or hits, in no
+    // particular order, and the total count is returned. Nothing is allocated.
+    // cull() skips the tests below the nodes entirely inside the frustum.
+    size_t      cull            (const Frustum& frustum, u32* out,
+                                 const size_t capacity)                         const noexcept;
+    size_t      overlap         (const AABB& aabb, u32* out,
+                                 const size_t capacity)                         const noexcept;
+    size_t      overlap         (const Sphere& sphere, u32* out,
+                                 const size_t capacity)                         const noexcept;
+    size_t      raycast         (const Vec3& origin, const Vec3& direction,
+                                 const f32 tMax, LooseOctreeHit* hits,
+                                 const size_t capacity)                         const noexcept;
+
+    // Closest object along origin + t * direction, t in [0, tMax], nodes front
+    // to back. Returns false when nothing is hit.
+    bool        raycast         (const Vec3& origin, const Vec3& direction,
+                                 const f32 tMax, LooseOctreeHit& hit)           const noexcept;
+
+    // Getters
+    AABB        getBounds       (const u32 handle)                              const noexcept;
+    u32         getUserData     (const u32 handle)                              const noexcept { return m_objects[handle].userData; }
+    u32         getDepth        (const u32 handle)                              const noexcept { return m_nodes[m_objects[handle].node].depth; }
+    size_t      getObjectCount  ()                                              const noexcept { return m_objectCount; }
+    size_t      getNodeCount    ()                                              const noexcept { return m_nodeCount; }
+};
+
+#include "LooseOctree.inl"
+
+} // End of namespace GPM
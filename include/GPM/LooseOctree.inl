@@ -0,0 +1,631 @@
+/* =================== Helpers =================== */
+namespace LooseOctreeDetail
+{
+
+// Spreads the 21 low bits of v three bits apart
+inline u64 spreadBits(u64 v) noexcept
+{
+    v &= 0x1FFFFFu;
+    v = (v | (v << 32u)) & 0x1F00000000FFFFu;
+    v = (v | (v << 16u)) & 0x1F0000FF0000FFu;
+    v = (v | (v << 8u))  & 0x100F00F00F00F00Fu;
+    v = (v | (v << 4u))  & 0x10C30C30C30C30C3u;
+    v = (v | (v << 2u))  & 0x1249249249249249u;
+    return v;
+}
+
+
+// Slab test of the ray origin + t * direction, t in [0, tMax], against a box:
+// entry receives the parameter where the ray enters it
+inline bool slab(const Vec3& min, const Vec3& max, const Vec3& origin, const Vec3& inverseDirection,
+                 const f32 tMax, f32& entry) noexcept
+{
+    f32 tNear{.0f}, tFar{tMax};
+
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        const f32 t0{(min.e[axis] - origin.e[axis]) * inverseDirection.e[axis]};
+        const f32 t1{(max.e[axis] - origin.e[axis]) * inverseDirection.e[axis]};
+
+        // Written so that the NaN of a ray parallel to a face that starts on it is ignored
+        tNear = t0 < t1 ? (t0 > tNear ? t0 : tNear) : (t1 > tNear ? t1 : tNear);
+        tFar  = t0 < t1 ? (t1 < tFar  ? t1 : tFar)  : (t0 < tFar  ? t0 : tFar);
+    }
+
+    entry = tNear;
+    return tNear <= tFar;
+}
+
+
+inline bool overlaps(const Vec3& minA, const Vec3& maxA, const Vec3& minB, const Vec3& maxB) noexcept
+{
+    return minA.x <= maxB.x && maxA.x >= minB.x &&
+           minA.y <= maxB.y && maxA.y >= minB.y &&
+           minA.z <= maxB.z && maxA.z >= minB.z;
+}
+
+} // End of namespace LooseOctreeDetail
+
+
+
+
+/* =================== Constructors =================== */
+inline LooseOctree::LooseOctree(const Vec3& center, const f32 halfSize, const u32 maxDepth)
+    : m_min{center - Vec3{halfSize}}, m_halfSize{halfSize}, m_maxDepth{std::min(maxDepth, maxDepthLimit)}
+{
+    Node root;
+    root.center      = center;
+    root.halfSize    = halfSize;
+    root.code        = 1u;
+    root.parent      = nullIndex;
+    root.depth       = 0u;
+    root.firstObject = nullIndex;
+    root.objectCount = 0u;
+    root.subdivided  = false;
+    std::fill(std::begin(root.children), std::end(root.children), nullIndex);
+
+    m_nodes.push_back(root);
+    m_nodeCount = 1u;
+}
+
+
+
+
+/* =================== Pools =================== */
+inline u32 LooseOctree::allocateNode(const u32 parent, const u32 child)
+{
+    u32 node{m_freeNodes};
+    if (node == nullIndex)
+    {
+        node = static_cast<u32>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+    else
+    {
+        m_freeNodes = m_nodes[node].parent;
+    }
+
+    const Node& parentNode{m_nodes[parent]};
+    const f32   quarter   {parentNode.halfSize * .5f};
+    Node&       created   {m_nodes[node]};
+
+    created.center      = {parentNode.center.x + ((child & 1u) ? quarter : -quarter),
+                           parentNode.center.y + ((child & 2u) ? quarter : -quarter),
+                           parentNode.center.z + ((child & 4u) ? quarter : -quarter)};
+    created.halfSize    = quarter;
+    created.code        = (parentNode.code << 3u) | child;
+    created.parent      = parent;
+    created.depth       = parentNode.depth + 1u;
+    created.firstObject = nullIndex;
+    created.objectCount = 0u;
+    created.subdivided  = false;
+    std::fill(std::begin(created.children), std::end(created.children), nullIndex);
+
+    m_nodes[parent].children[child] = node;
+    ++m_nodeCount;
+
+    return node;
+}
+
+
+// Releases node and its ancestors while they hold nothing
+inline void LooseOctree::releaseEmpty(u32 node) noexcept
+{
+    auto hasChildren = [this](const u32 index)
+    {
+        return std::any_of(std::begin(m_nodes[index].children), std::end(m_nodes[index].children),
+                           [](const u32 child) { return child != nullIndex; });
+    };
+
+    while (node != 0u && m_nodes[node].objectCount == 0u && !hasChildren(node))
+    {
+        const u32 parent{m_nodes[node].parent};
+
+        m_nodes[parent].children[m_nodes[node].code & 7u] = nullIndex;
+        m_nodes[node].parent = m_freeNodes;
+        m_freeNodes          = node;
+        --m_nodeCount;
+
+        node = parent;
+    }
+
+    // A node left without children gathers objects again until it splits anew
+    if (!hasChildren(node) && m_nodes[node].objectCount <= splitThreshold)
+        m_nodes[node].subdivided = false;
+}
+
+
+
+
+/* =================== Placement =================== */
+inline void LooseOctree::place(const u32 object, const Vec3& min, const Vec3& max) noexcept
+{
+    Object& current{m_objects[object]};
+    current.min = min;
+    current.max = max;
+
+    // Half sizes halve with depth: the deepest one above the largest half extent
+    const f32 reach{std::max({max.x - min.x, max.y - min.y, max.z - min.z}) * .5f};
+    f32       halfSize{m_halfSize};
+
+    current.fitDepth = 0u;
+    while (current.fitDepth < m_maxDepth && halfSize * .5f >= reach)
+    {
+        halfSize *= .5f;
+        ++current.fitDepth;
+    }
+
+    // Cell of the center at maxDepth, in double for the precision of large worlds
+    const f64 cells{static_cast<f64>(1u << m_maxDepth)};
+    u64       cell[3];
+
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        const f64 center  {(static_cast<f64>(min.e[axis]) + static_cast<f64>(max.e[axis])) * .5};
+        const f64 position{(center - m_min.e[axis]) / (2. * m_halfSize) * cells};
+
+        cell[axis] = static_cast<u64>(std::min(std::max(position, .0), cells - 1.));
+    }
+
+    current.morton = LooseOctreeDetail::spreadBits(cell[0]) | (LooseOctreeDetail::spreadBits(cell[1]) << 1u) |
+                     (LooseOctreeDetail::spreadBits(cell[2]) << 2u);
+}
+
+
+inline u32 LooseOctree::childIndex(const u32 object, const u32 depth) const noexcept
+{
+    return static_cast<u32>(m_objects[object].morton >> (3u * (m_maxDepth - depth - 1u))) & 7u;
+}
+
+
+// Relocated objects may stay in a node that doesn't contain their center,
+// their Morton code doesn't lead to its children then
+inline bool LooseOctree::isOnPath(const u32 object, const u32 node) const noexcept
+{
+    const u32 depth{m_nodes[node].depth};
+    return (m_objects[object].morton >> (3u * (m_maxDepth - depth))) == (m_nodes[node].code ^ (u64{1u} << (3u * depth)));
+}
+
+
+inline void LooseOctree::link(const u32 object, const u32 node) noexcept
+{
+    Object& current{m_objects[object]};
+    current.node     = node;
+    current.previous = nullIndex;
+    current.next     = m_nodes[node].firstObject;
+
+    if (current.next != nullIndex)
+        m_objects[current.next].previous = object;
+
+    m_nodes[node].firstObject = object;
+    ++m_nodes[node].objectCount;
+}
+
+
+inline void LooseOctree::unlink(const u32 object) noexcept
+{
+    const Object& current{m_objects[object]};
+
+    if (current.previous != nullIndex)
+        m_objects[current.previous].next = current.next;
+    else
+        m_nodes[current.node].firstObject = current.next;
+
+    if (current.next != nullIndex)
+        m_objects[current.next].previous = current.previous;
+
+    --m_nodes[current.node].objectCount;
+}
+
+
+// Down the Morton path of the object while the nodes exist, or may be created
+inline void LooseOctree::descend(const u32 object)
+{
+    u32 node{0u};
+
+    while (m_nodes[node].depth < m_objects[object].fitDepth)
+    {
+        const u32 child{childIndex(object, m_nodes[node].depth)};
+
+        if (m_nodes[node].children[child] != nullIndex)
+            node = m_nodes[node].children[child];
+        else if (m_nodes[node].subdivided)
+            node = allocateNode(node, child);
+        else
+            break;
+    }
+
+    link(object, node);
+
+    if (!m_nodes[node].subdivided && m_nodes[node].objectCount > splitThreshold && m_nodes[node].depth < m_maxDepth)
+        split(node);
+}
+
+
+inline void LooseOctree::split(const u32 node)
+{
+    m_nodes[node].subdivided = true;
+
+    for (u32 object{m_nodes[node].firstObject}; object != nullIndex;)
+    {
+        const u32 next{m_objects[object].next};
+
+        if (m_objects[object].fitDepth > m_nodes[node].depth && isOnPath(object, node))
+        {
+            const u32 child{childIndex(object, m_nodes[node].depth)};
+
+            unlink(object);
+            link(object, m_nodes[node].children[child] != nullIndex ? m_nodes[node].children[child] : allocateNode(node, child));
+        }
+
+        object = next;
+    }
+
+    for (u32 child{0u}; child < 8u; ++child)
+    {
+        const u32 index{m_nodes[node].children[child]};
+
+        if (index != nullIndex && !m_nodes[index].subdivided &&
+            m_nodes[index].objectCount > splitThreshold && m_nodes[index].depth < m_maxDepth)
+            split(index);
+    }
+}
+
+
+
+
+/* =================== Objects =================== */
+inline u32 LooseOctree::insert(const AABB& aabb, const u32 userData)
+{
+    u32 object{m_freeObjects};
+    if (object == nullIndex)
+    {
+        object = static_cast<u32>(m_objects.size());
+        m_objects.emplace_back();
+    }
+    else
+    {
+        m_freeObjects = m_objects[object].next;
+    }
+
+    m_objects[object].userData = userData;
+    place(object, aabb.center - aabb.extents, aabb.center + aabb.extents);
+    descend(object);
+    ++m_objectCount;
+
+    return object;
+}
+
+
+inline u32 LooseOctree::insert(const Sphere& sphere, const u32 userData)
+{
+    return insert(AABB{sphere.getCenter(), sphere.getRadius(), sphere.getRadius(), sphere.getRadius()}, userData);
+}
+
+
+inline u32 LooseOctree::insert(const OrientedBox& box, const u32 userData)
+{
+    return insert(box.getAABB(), userData);
+}
+
+
+inline void LooseOctree::remove(const u32 handle)
+{
+    const u32 node{m_objects[handle].node};
+
+    unlink(handle);
+    m_objects[handle].node = nullIndex;
+    m_objects[handle].next = m_freeObjects;
+    m_freeObjects          = handle;
+    --m_objectCount;
+
+    releaseEmpty(node);
+}
+
+
+inline bool LooseOctree::relocate(const u32 handle, const AABB& aabb)
+{
+    const Vec3 min{aabb.center - aabb.extents};
+    const Vec3 max{aabb.center + aabb.extents};
+    const u32  node{m_objects[handle].node};
+
+    if (looseContains(node, min, max))
+    {
+        place(handle, min, max);
+        return false;
+    }
+
+    unlink(handle);
+    releaseEmpty(node);
+
+    place(handle, min, max);
+    descend(handle);
+
+    return true;
+}
+
+
+inline bool LooseOctree::relocate(const u32 handle, const Sphere& sphere)
+{
+    return relocate(handle, AABB{sphere.getCenter(), sphere.getRadius(), sphere.getRadius(), sphere.getRadius()});
+}
+
+
+inline bool LooseOctree::relocate(const u32 handle, const OrientedBox& box)
+{
+    return relocate(handle, box.getAABB());
+}
+
+
+
+
+/* =================== Queries =================== */
+inline void LooseOctree::looseBounds(const u32 node, Vec3& min, Vec3& max) const noexcept
+{
+    const Vec3 reach{2.f * m_nodes[node].halfSize};
+
+    min = m_nodes[node].center - reach;
+    max = m_nodes[node].center + reach;
+}
+
+
+inline bool LooseOctree::looseContains(const u32 node, const Vec3& min, const Vec3& max) const noexcept
+{
+    Vec3 looseMin, looseMax;
+    looseBounds(node, looseMin, looseMax);
+
+    return looseMin.x <= min.x && looseMin.y <= min.y && looseMin.z <= min.z &&
+           max.x <= looseMax.x && max.y <= looseMax.y && max.z <= looseMax.z;
+}
+
+
+inline void LooseOctree::appendSubtree(const u32 node, u32* out, const size_t capacity, size_t& count) const noexcept
+{
+    for (u32 object{m_nodes[node].firstObject}; object != nullIndex; object = m_objects[object].next)
+    {
+        if (count < capacity)
+            out[count] = m_objects[object].userData;
+        ++count;
+    }
+
+    for (const u32 child : m_nodes[node].children)
+        if (child != nullIndex)
+            appendSubtree(child, out, capacity, count);
+}
+
+
+template<typename O, typename F>
+inline void LooseOctree::traverse(O&& overlaps, F&& visit) const noexcept
+{
+    // Every pop pushes at most 8 children: 7 per level stay behind
+    u32 stack[8u * (maxDepthLimit + 1u)];
+    u32 top{0u};
+
+    stack[top++] = 0u;
+
+    while (top > 0u)
+    {
+        const u32 node{stack[--top]};
+
+        Vec3 looseMin, looseMax;
+        looseBounds(node, looseMin, looseMax);
+
+        if (!overlaps(looseMin, looseMax))
+            continue;
+
+        for (u32 object{m_nodes[node].firstObject}; object != nullIndex; object = m_objects[object].next)
+            if (overlaps(m_objects[object].min, m_objects[object].max))
+                visit(object);
+
+        for (const u32 child : m_nodes[node].children)
+            if (child != nullIndex)
+                stack[top++] = child;
+    }
+}
+
+
+inline size_t LooseOctree::cull(const Frustum& frustum, u32* out, const size_t capacity) const noexcept
+{
+    // Nodes to visit with the planes they may straddle
+    struct Entry
+    {
+        u32 node;
+        u32 planeMask;
+    };
+
+    Entry  stack[8u * (maxDepthLimit + 1u)];
+    u32    top  {0u};
+    size_t count{0u};
+
+    stack[top++] = {0u, Frustum::allPlanes};
+
+    while (top > 0u)
+    {
+        Entry entry{stack[--top]};
+
+        Vec3 looseMin, looseMax;
+        looseBounds(entry.node, looseMin, looseMax);
+
+        u8 lastPlane{0u};
+        if (frustum.classify(looseMin, looseMax, entry.planeMask, lastPlane) == EFrustumTest::Outside)
+            continue;
+
+        if (entry.planeMask == 0u)
+        {
+            appendSubtree(entry.node, out, capacity, count);
+            continue;
+        }
+
+        for (u32 object{m_nodes[entry.node].firstObject}; object != nullIndex; object = m_objects[object].next)
+        {
+            u32 planeMask{entry.planeMask};
+            if (frustum.classify(m_objects[object].min, m_objects[object].max, planeMask, lastPlane) != EFrustumTest::Outside)
+            {
+                if (count < capacity)
+                    out[count] = m_objects[object].userData;
+                ++count;
+            }
+        }
+
+        for (const u32 child : m_nodes[entry.node].children)
+            if (child != nullIndex)
+                stack[top++] = {child, entry.planeMask};
+    }
+
+    return count;
+}
+
+
+inline size_t LooseOctree::overlap(const AABB& aabb, u32* out, const size_t capacity) const noexcept
+{
+    const Vec3 queryMin{aabb.center - aabb.extents};
+    const Vec3 queryMax{aabb.center + aabb.extents};
+    size_t     count{0u};
+
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        return LooseOctreeDetail::overlaps(min, max, queryMin, queryMax);
+    },
+    [&](const u32 object)
+    {
+        if (count < capacity)
+            out[count] = m_objects[object].userData;
+        ++count;
+    });
+
+    return count;
+}
+
+
+inline size_t LooseOctree::overlap(const Sphere& sphere, u32* out, const size_t capacity) const noexcept
+{
+    const Vec3 center       {sphere.getCenter()};
+    const f32  squaredRadius{sphere.getRadius() * sphere.getRadius()};
+    size_t     count{0u};
+
+    // Squared distance from the center to the closest point of the box
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        f32 squaredDistance{.0f};
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            const f32 offset{std::max(min.e[axis] - center.e[axis], .0f) + std::max(center.e[axis] - max.e[axis], .0f)};
+            squaredDistance += offset * offset;
+        }
+
+        return squaredDistance <= squaredRadius;
+    },
+    [&](const u32 object)
+    {
+        if (count < capacity)
+            out[count] = m_objects[object].userData;
+        ++count;
+    });
+
+    return count;
+}
+
+
+inline size_t LooseOctree::raycast(const Vec3& origin, const Vec3& direction, const f32 tMax,
+                                   LooseOctreeHit* hits, const size_t capacity) const noexcept
+{
+    const Vec3 inverseDirection{1.f / direction.x, 1.f / direction.y, 1.f / direction.z};
+    size_t     count{0u};
+    f32        t;
+
+    traverse([&](const Vec3& min, const Vec3& max)
+    {
+        return LooseOctreeDetail::slab(min, max, origin, inverseDirection, tMax, t);
+    },
+    [&](const u32 object)
+    {
+        if (count < capacity)
+            hits[count] = {m_objects[object].userData, t};
+        ++count;
+    });
+
+    return count;
+}
+
+
+inline bool LooseOctree::raycast(const Vec3& origin, const Vec3& direction, const f32 tMax, LooseOctreeHit& hit) const noexcept
+{
+    const Vec3 inverseDirection{1.f / direction.x, 1.f / direction.y, 1.f / direction.z};
+
+    // Nodes to visit and the parameter where the ray enters them, the nearest on top
+    struct Entry
+    {
+        u32 node;
+        f32 t;
+    };
+
+    Entry stack[8u * (maxDepthLimit + 1u)];
+    u32   top    {0u};
+    f32   closest{tMax};
+    bool  found  {false};
+    f32   t;
+
+    Vec3 looseMin, looseMax;
+    looseBounds(0u, looseMin, looseMax);
+
+    if (!LooseOctreeDetail::slab(looseMin, looseMax, origin, inverseDirection, closest, t))
+        return false;
+
+    stack[top++] = {0u, t};
+
+    while (top > 0u)
+    {
+        const Entry entry{stack[--top]};
+
+        // Hits found since the node was pushed may be closer than its bounds
+        if (entry.t > closest)
+            continue;
+
+        const Node& node{m_nodes[entry.node]};
+
+        for (u32 object{node.firstObject}; object != nullIndex; object = m_objects[object].next)
+        {
+            if (LooseOctreeDetail::slab(m_objects[object].min, m_objects[object].max, origin, inverseDirection, closest, t) &&
+                (!found || t < closest))
+            {
+                closest = t;
+                hit     = {m_objects[object].userData, t};
+                found   = true;
+            }
+        }
+
+        // Children hit, pushed farthest first
+        Entry children[8];
+        u32   childCount{0u};
+
+        for (const u32 child : node.children)
+        {
+            if (child == nullIndex)
+                continue;
+
+            looseBounds(child, looseMin, looseMax);
+            if (!LooseOctreeDetail::slab(looseMin, looseMax, origin, inverseDirection, closest, t))
+                continue;
+
+            u32 i{childCount++};
+            for (; i > 0u && children[i - 1u].t < t; --i)
+                children[i] = children[i - 1u];
+
+            children[i] = {child, t};
+        }
+
+        for (u32 i{0u}; i < childCount; ++i)
+            stack[top++] = children[i];
+    }
+
+    return found;
+}
+
+
+
+
+/* =================== Getters =================== */
+inline AABB LooseOctree::getBounds(const u32 handle) const noexcept
+{
+    return {m_objects[handle].min, m_objects[handle].max};
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "Types.hpp"
+#include "Vector.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+
+namespace GPM
+{
+
+// Column-major matrix of any size and element type, laid out like Matrix3 and
+// Matrix4: e[column * R + row], aliased by the columns c. Matrix<3u, 3u, f32>
+// and Matrix<4u, 4u, f32> are specialised by Matrix3 and Matrix4. Square matrices of floating point elements
+// can be inverted; translation() and scaling() build homogeneous transforms
+// for (N + 1) x (N + 1) matrices, so that Matrix<4, 4, f64> keeps
+// large-world positions in double precision.
+template<size_t R, size_t C, typename T>
+struct Matrix
+{
+    static_assert(R > 0u && C > 0u, "A matrix needs at least one coefficient");
+
+    using Column = Vector<R, T>;
+    using Row    = Vector<C, T>;
+
+    union
+    {
+        T      e[R * C];
+        Column c[C];
+    };
+
+    // Constructors. The default constructor leaves the coefficients uninitialized,
+    // Matrix{} zeroes them.
+    Matrix()                                                                = default;
+    template<typename... Args, typename = std::enable_if_t<(R * C > 1u) && sizeof...(Args) == R * C>>
+    constexpr Matrix(const Args... coefs)                                   noexcept;
+
+    // Static methods (pseudo-constructors)
+    static constexpr Matrix zero        ()                                  noexcept;
+    static constexpr Matrix identity    ()                                  noexcept;
+    static constexpr Matrix translation (const Vector<R - 1u, T>& t)        noexcept;
+    static constexpr Matrix scaling     (const Vector<R - 1u, T>& s)        noexcept;
+
+    // Coefficient access
+    constexpr T&        operator()      (const size_t row, const size_t col)        noexcept       { return e[col * R + row]; }
+    constexpr const T&  operator()      (const size_t row, const size_t col)        const noexcept { return e[col * R + row]; }
+    constexpr Column    column          (const size_t col)                  const noexcept;
+    constexpr Row       row             (const size_t row)                  const noexcept;
+    constexpr void      setColumn       (const size_t col, const Column& c) noexcept;
+
+    // Methods
+    template<typename U>
+    constexpr Matrix<R, C, U> cast      ()                                  const noexcept;
+    constexpr Matrix<C, R, T> transposed()                                  const noexcept;
+    constexpr T         trace           ()                                  const noexcept;
+    constexpr T         det             ()                                  const noexcept;
+    constexpr Matrix    inversed        ()                                  const noexcept;
+    bool                isEqualTo       (const Matrix& m,
+                                         const T eps = T(1e-6))             const noexcept;
+
+    // Homogeneous transforms, the matrix is assumed affine so the result isn't divided by w
+    constexpr Vector<R - 1u, T> transformPoint    (const Vector<R - 1u, T>& p) const noexcept;
+    constexpr Vector<R - 1u, T> transformDirection(const Vector<R - 1u, T>& d) const noexcept;
+
+    // Operator overloads
+    constexpr bool      operator==      (const Matrix& m)                   const noexcept;
+    constexpr bool      operator!=      (const Matrix& m)                   const noexcept;
+    constexpr Matrix&   operator+=      (const Matrix& m)                   noexcept;
+    constexpr Matrix&   operator-=      (const Matrix& m)                   noexcept;
+    constexpr Matrix&   operator*=      (const T k)                         noexcept;
+    constexpr Matrix&   operator/=      (const T k)                         noexcept;
+    constexpr Matrix&   operator*=      (const Matrix& m)                   noexcept;
+    constexpr Matrix    operator+       (const Matrix& m)                   const noexcept;
+    constexpr Matrix    operator-       (const Matrix& m)                   const noexcept;
+    constexpr Matrix    operator*       (const T k)                         const noexcept;
+    constexpr Matrix    operator/       (const T k)                         const noexcept;
+    template<size_t K>
+    constexpr Matrix<R, K, T> operator* (const Matrix<C, K, T>& m)          const noexcept;
+    constexpr Column    operator*       (const Row& v)                      const noexcept;
+};
+
+
+// Mat<4u, 4u, f32> is Matrix4, see Vec
+template<size_t R, size_t C, typename T>
+using Mat = Matrix<R, C, T>;
+
+using Mat3d = Mat<3u, 3u, f64>;
+using Mat4d = Mat<4u, 4u, f64>;
+
+#include "Matrix.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,444 @@
+/* =================== Constructors =================== */
+template<size_t R, size_t C, typename T>
+template<typename... Args, typename>
+inline constexpr Matrix<R, C, T>::Matrix(const Args... coefs) noexcept
+    : e{static_cast<T>(coefs)...}
+{}
+
+
+
+
+/* =================== Static methods =================== */
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::zero() noexcept
+{
+    return Matrix{};
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::identity() noexcept
+{
+    Matrix res{};
+    for (size_t i{0u}; i < (R < C ? R : C); ++i)
+        res(i, i) = T(1);
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::translation(const Vector<R - 1u, T>& t) noexcept
+{
+    static_assert(R == C && R > 1u, "translation() builds square homogeneous matrices");
+
+    Matrix res{identity()};
+    for (size_t i{0u}; i < R - 1u; ++i)
+        res(i, C - 1u) = t.e[i];
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::scaling(const Vector<R - 1u, T>& s) noexcept
+{
+    static_assert(R == C && R > 1u, "scaling() builds square homogeneous matrices");
+
+    Matrix res{identity()};
+    for (size_t i{0u}; i < R - 1u; ++i)
+        res(i, i) = s.e[i];
+
+    return res;
+}
+
+
+
+
+/* =================== Coefficient access =================== */
+template<size_t R, size_t C, typename T>
+inline constexpr typename Matrix<R, C, T>::Column Matrix<R, C, T>::column(const size_t col) const noexcept
+{
+    Column res{};
+    for (size_t i{0u}; i < R; ++i)
+        res.e[i] = e[col * R + i];
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr typename Matrix<R, C, T>::Row Matrix<R, C, T>::row(const size_t row) const noexcept
+{
+    Row res{};
+    for (size_t i{0u}; i < C; ++i)
+        res.e[i] = e[i * R + row];
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr void Matrix<R, C, T>::setColumn(const size_t col, const Column& c) noexcept
+{
+    for (size_t i{0u}; i < R; ++i)
+        e[col * R + i] = c.e[i];
+}
+
+
+
+
+/* =================== Methods =================== */
+template<size_t R, size_t C, typename T>
+template<typename U>
+inline constexpr Matrix<R, C, U> Matrix<R, C, T>::cast() const noexcept
+{
+    Matrix<R, C, U> res{};
+    for (size_t i{0u}; i < R * C; ++i)
+        res.e[i] = static_cast<U>(e[i]);
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<C, R, T> Matrix<R, C, T>::transposed() const noexcept
+{
+    Matrix<C, R, T> res{};
+    for (size_t col{0u}; col < C; ++col)
+    {
+        for (size_t row{0u}; row < R; ++row)
+            res.e[row * C + col] = (*this)(row, col);
+    }
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr T Matrix<R, C, T>::trace() const noexcept
+{
+    static_assert(R == C, "The trace is only defined for square matrices");
+
+    T res{0};
+    for (size_t i{0u}; i < R; ++i)
+        res += (*this)(i, i);
+
+    return res;
+}
+
+
+// Closed forms up to 3x3, which also work on integers, and
+// Gaussian elimination with partial pivoting above
+template<size_t R, size_t C, typename T>
+inline constexpr T Matrix<R, C, T>::det() const noexcept
+{
+    static_assert(R == C, "The determinant is only defined for square matrices");
+
+    if constexpr (R == 1u)
+    {
+        return e[0];
+    }
+    else if constexpr (R == 2u)
+    {
+        return e[0] * e[3] - e[2] * e[1];
+    }
+    else if constexpr (R == 3u)
+    {
+        return   e[0] * (e[4] * e[8] - e[7] * e[5])
+               - e[3] * (e[1] * e[8] - e[7] * e[2])
+               + e[6] * (e[1] * e[5] - e[4] * e[2]);
+    }
+    else
+    {
+        static_assert(std::is_floating_point_v<T>, "det() above 3x3 needs floating point coefficients");
+
+        Matrix m  {*this};
+        T      res{1};
+
+        for (size_t col{0u}; col < C; ++col)
+        {
+            size_t pivot{col};
+            for (size_t row{col + 1u}; row < R; ++row)
+            {
+                const T candidate{m(row, col) < T(0) ? -m(row, col) : m(row, col)};
+                const T best     {m(pivot, col) < T(0) ? -m(pivot, col) : m(pivot, col)};
+                if (candidate > best)
+                    pivot = row;
+            }
+
+            if (m(pivot, col) == T(0))
+                return T(0);
+
+            if (pivot != col)
+            {
+                res = -res;
+                for (size_t i{col}; i < C; ++i)
+                {
+                    const T tmp{m(col, i)};
+                    m(col, i)   = m(pivot, i);
+                    m(pivot, i) = tmp;
+                }
+            }
+
+            res *= m(col, col);
+
+            for (size_t row{col + 1u}; row < R; ++row)
+            {
+                const T factor{m(row, col) / m(col, col)};
+                for (size_t i{col + 1u}; i < C; ++i)
+                    m(row, i) -= factor * m(col, i);
+            }
+        }
+
+        return res;
+    }
+}
+
+
+// Gauss-Jordan elimination with partial pivoting. Singular matrices return zero().
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::inversed() const noexcept
+{
+    static_assert(R == C, "Only square matrices can be inverted");
+    static_assert(std::is_floating_point_v<T>, "inversed() needs floating point coefficients");
+
+    Matrix m  {*this};
+    Matrix res{identity()};
+
+    for (size_t col{0u}; col < C; ++col)
+    {
+        size_t pivot{col};
+        for (size_t row{col + 1u}; row < R; ++row)
+        {
+            const T candidate{m(row, col) < T(0) ? -m(row, col) : m(row, col)};
+            const T best     {m(pivot, col) < T(0) ? -m(pivot, col) : m(pivot, col)};
+            if (candidate > best)
+                pivot = row;
+        }
+
+        if (m(pivot, col) == T(0))
+            return zero();
+
+        if (pivot != col)
+        {
+            for (size_t i{0u}; i < C; ++i)
+            {
+                const T tmp  {m(col, i)};
+                m(col, i)    = m(pivot, i);
+                m(pivot, i)  = tmp;
+
+                const T tmpRes{res(col, i)};
+                res(col, i)   = res(pivot, i);
+                res(pivot, i) = tmpRes;
+            }
+        }
+
+        const T reciprocal{T(1) / m(col, col)};
+        for (size_t i{0u}; i < C; ++i)
+        {
+            m(col, i)   *= reciprocal;
+            res(col, i) *= reciprocal;
+        }
+
+        for (size_t row{0u}; row < R; ++row)
+        {
+            if (row == col)
+                continue;
+
+            const T factor{m(row, col)};
+            for (size_t i{0u}; i < C; ++i)
+            {
+                m(row, i)   -= factor * m(col, i);
+                res(row, i) -= factor * res(col, i);
+            }
+        }
+    }
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline bool Matrix<R, C, T>::isEqualTo(const Matrix& m, const T eps) const noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+    {
+        if (std::abs(e[i] - m.e[i]) > eps)
+            return false;
+    }
+
+    return true;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Vector<R - 1u, T> Matrix<R, C, T>::transformPoint(const Vector<R - 1u, T>& p) const noexcept
+{
+    static_assert(R == C && R > 1u, "transformPoint() needs a square homogeneous matrix");
+
+    Vector<R - 1u, T> res{};
+    for (size_t row{0u}; row < R - 1u; ++row)
+    {
+        T sum{(*this)(row, C - 1u)};
+        for (size_t col{0u}; col < C - 1u; ++col)
+            sum += (*this)(row, col) * p.e[col];
+
+        res.e[row] = sum;
+    }
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Vector<R - 1u, T> Matrix<R, C, T>::transformDirection(const Vector<R - 1u, T>& d) const noexcept
+{
+    static_assert(R == C && R > 1u, "transformDirection() needs a square homogeneous matrix");
+
+    Vector<R - 1u, T> res{};
+    for (size_t row{0u}; row < R - 1u; ++row)
+    {
+        T sum{0};
+        for (size_t col{0u}; col < C - 1u; ++col)
+            sum += (*this)(row, col) * d.e[col];
+
+        res.e[row] = sum;
+    }
+
+    return res;
+}
+
+
+
+
+/* =================== Operator overloads =================== */
+template<size_t R, size_t C, typename T>
+inline constexpr bool Matrix<R, C, T>::operator==(const Matrix& m) const noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+    {
+        if (e[i] != m.e[i])
+            return false;
+    }
+
+    return true;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr bool Matrix<R, C, T>::operator!=(const Matrix& m) const noexcept
+{
+    return !(*this == m);
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator+=(const Matrix& m) noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+        e[i] += m.e[i];
+
+    return *this;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator-=(const Matrix& m) noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+        e[i] -= m.e[i];
+
+    return *this;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator*=(const T k) noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+        e[i] *= k;
+
+    return *this;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator/=(const T k) noexcept
+{
+    for (size_t i{0u}; i < R * C; ++i)
+        e[i] /= k;
+
+    return *this;
+}
+
+
+// Like Matrix3 and Matrix4, this actually does m * *this
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator*=(const Matrix& m) noexcept
+{
+    static_assert(R == C, "In-place products need square matrices");
+
+    return *this = m * *this;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator+(const Matrix& m) const noexcept
+{
+    return Matrix{*this} += m;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator-(const Matrix& m) const noexcept
+{
+    return Matrix{*this} -= m;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator*(const T k) const noexcept
+{
+    return Matrix{*this} *= k;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator/(const T k) const noexcept
+{
+    return Matrix{*this} /= k;
+}
+
+
+template<size_t R, size_t C, typename T>
+template<size_t K>
+inline constexpr Matrix<R, K, T> Matrix<R, C, T>::operator*(const Matrix<C, K, T>& m) const noexcept
+{
+    Matrix<R, K, T> res{};
+    for (size_t col{0u}; col < K; ++col)
+    {
+        for (size_t i{0u}; i < C; ++i)
+        {
+            const T coef{m(i, col)};
+            for (size_t row{0u}; row < R; ++row)
+                res.e[col * R + row] += (*this)(row, i) * coef;
+        }
+    }
+
+    return res;
+}
+
+
+template<size_t R, size_t C, typename T>
+inline constexpr typename Matrix<R, C, T>::Column Matrix<R, C, T>::operator*(const Row& v) const noexcept
+{
+    Column res{};
+    for (size_t col{0u}; col < C; ++col)
+    {
+        for (size_t row{0u}; row < R; ++row)
+            res.e[row] += (*this)(row, col) * v.e[col];
+    }
+
+    return res;
+}
@@ -14,13 +14,19 @@ namespace GPM
 #define MAT3_COL  3u
 #define MAT3_COEF 9u
 
-union Matrix3
+using Matrix3 = Matrix<3u, 3u, f32>;
+
+template<>
+struct Matrix<3u, 3u, f32>
 {
     // Data members. The following data members can be accessed publicly:
     // - f32  e[9], which is the same as {c[0].x, c[0].y, c[0].z, c[1].x, ...}
     // - Vec4 c[3], which is the same as {Vec3{e[0], e[1], e[2]}, Vec3{e[3], ...}, ...}
-    f32  e[MAT3_COEF];
-    Vec3 c[MAT3_COL];
+    union
+    {
+        f32  e[MAT3_COEF];
+        Vec3 c[MAT3_COL];
+    };
 
     // Static methods, pseudo-constructors
     static constexpr Matrix3 zero       ()                  noexcept;
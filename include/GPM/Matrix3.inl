@@ -73,17 +73,7 @@ inline constexpr f32 Matrix3::trace() const noexcept
 // This actually does m * *this
 inline constexpr Matrix3& Matrix3::operator*=(const Matrix3& m) noexcept
 {
-    e[0] = (m.e[0] * e[0]) + (m.e[3] * e[1]) + (m.e[6] * e[2]);
-    e[1] = (m.e[0] * e[3]) + (m.e[3] * e[4]) + (m.e[6] * e[5]);
-    e[2] = (m.e[0] * e[6]) + (m.e[3] * e[7]) + (m.e[6] * e[8]);
-    e[3] = (m.e[0] * e[0]) + (m.e[3] * e[1]) + (m.e[6] * e[2]);
-    e[4] = (m.e[0] * e[3]) + (m.e[3] * e[4]) + (m.e[6] * e[5]);
-    e[5] = (m.e[0] * e[6]) + (m.e[3] * e[7]) + (m.e[6] * e[8]);
-    e[6] = (m.e[0] * e[0]) + (m.e[3] * e[1]) + (m.e[6] * e[2]);
-    e[7] = (m.e[0] * e[3]) + (m.e[3] * e[4]) + (m.e[6] * e[5]);
-    e[8] = (m.e[0] * e[6]) + (m.e[3] * e[7]) + (m.e[6] * e[8]);
-
-    return *this;
+    return *this = m * *this;
 }
 
 
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Vector4.hpp"
 #include "Types.hpp"
+#include "SIMD.hpp"
 
 namespace GPM
 {
@@ -15,22 +18,28 @@ namespace GPM
 #define MAT4_COL 4u
 #define MAT4_COEF 16u
 
-// Aligned to 16 to enable auto-vectorization
-union alignas(16) Matrix4
+using Matrix4 = Matrix<4u, 4u, f32>;
+
+// Aligned to 16 so that columns can be loaded straight into SSE registers
+template<>
+struct alignas(16) Matrix<4u, 4u, f32>
 {
     // Data members. The following data members can be accessed publicly:
     // - f32  e[16], which is the same as {c[0].x, c[0].y, c[0].z, c[0].w, c[1].x, ...}
     // - Vec4 c[4], which is the same as {{e[0], e[1], e[2], e[3]}, {...}}
-    f32  e[MAT4_COEF];
-    Vec4 c[MAT4_COL];
+    union
+    {
+        f32  e[MAT4_COEF];
+        Vec4 c[MAT4_COL];
+    };
 
     // Constructors
-    Matrix4() noexcept = default;
-    constexpr Matrix4(const f32 e0,  const f32 e1,  const f32 e2,  const f32 e3,
-                      const f32 e4,  const f32 e5,  const f32 e6,  const f32 e7,
-                      const f32 e8,  const f32 e9,  const f32 e10, const f32 e11,
-                      const f32 e12, const f32 e13, const f32 e14, const f32 e15)     noexcept;
-    constexpr Matrix4(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3) noexcept;
+    Matrix() noexcept = default;
+    constexpr Matrix(const f32 e0,  const f32 e1,  const f32 e2,  const f32 e3,
+                     const f32 e4,  const f32 e5,  const f32 e6,  const f32 e7,
+                     const f32 e8,  const f32 e9,  const f32 e10, const f32 e11,
+                     const f32 e12, const f32 e13, const f32 e14, const f32 e15)      noexcept;
+    constexpr Matrix(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3)  noexcept;
 
     // Static methods, pseudo-constructors
     static constexpr Matrix4 zero      ()                     noexcept;
@@ -46,6 +55,12 @@ union alignas(16) Matrix4
     bool                     isEqualTo (const Matrix4& m,
                                         const f32 eps = 1e-6) const noexcept;
 
+    // Affine specialisations: the bottom row is assumed to be {0, 0, 0, 1}
+    constexpr bool           isAffine      ()                 const noexcept;
+    constexpr Matrix4        cofactorAffine()                 const noexcept;
+    constexpr Matrix4        inversedAffine()                 const noexcept;
+    constexpr Matrix4        multiplyAffine(const Matrix4& m) const noexcept;
+
     // Operator overloads
     constexpr bool           operator== (const Matrix4& m)    const noexcept;
     constexpr Matrix4&       operator*= (const Matrix4& m)    noexcept;
@@ -58,6 +73,15 @@ union alignas(16) Matrix4
 using Mat4 = Matrix4;
 using mat4 = Matrix4;
 
+// Batched version of Matrix4::operator*(const Vec4& v): out[i] = m * in[i].
+// in and out may point to the same array.
+void transform          (const Matrix4& m, const Vec4* in, Vec4* out, const size_t count) noexcept;
+
+// Batched point (w = 1) and direction (w = 0) transforms, the matrix is assumed
+// affine so the result isn't divided by w. in and out may point to the same array.
+void transformPoints    (const Matrix4& m, const Vec3* in, Vec3* out, const size_t count) noexcept;
+void transformDirections(const Matrix4& m, const Vec3* in, Vec3* out, const size_t count) noexcept;
+
 #include "Matrix4.inl"
 
 } // End of namespace GPM
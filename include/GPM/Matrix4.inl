@@ -1,3 +1,275 @@
+/* ==================== SIMD backend ==================== */
+#ifdef GPM_USE_SSE
+namespace SIMD
+{
+
+// Linear combination of the columns c0..c3 weighted by the lanes of v
+inline __m128 combineColumns(const __m128 c0, const __m128 c1,
+                             const __m128 c2, const __m128 c3, const __m128 v) noexcept
+{
+    const __m128 x{_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))},
+                 y{_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))},
+                 z{_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))},
+                 w{_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))};
+
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)),
+                      _mm_add_ps(_mm_mul_ps(c2, z), _mm_mul_ps(c3, w)));
+}
+
+
+// out[i] = m * in[i], columns are broadcast once for the whole batch
+inline void transform(const Matrix4& m, const Vec4* in, Vec4* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_AVX
+    {
+        // Two Vec4 per iteration, each 128-bit half holds a copy of the columns
+        const __m256 c0{_mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.c[0].e))},
+                     c1{_mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.c[1].e))},
+                     c2{_mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.c[2].e))},
+                     c3{_mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.c[3].e))};
+
+        for (; i + 1u < count; i += 2u)
+        {
+            const __m256 v{_mm256_loadu_ps(in[i].e)};
+
+            const __m256 r{_mm256_add_ps(
+                _mm256_add_ps(_mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00)),
+                              _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55))),
+                _mm256_add_ps(_mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA)),
+                              _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF))))};
+
+            _mm256_storeu_ps(out[i].e, r);
+        }
+    }
+#endif
+
+    const __m128 c0{_mm_load_ps(m.c[0].e)}, c1{_mm_load_ps(m.c[1].e)},
+                 c2{_mm_load_ps(m.c[2].e)}, c3{_mm_load_ps(m.c[3].e)};
+
+    for (; i < count; ++i)
+    {
+        _mm_store_ps(out[i].e, combineColumns(c0, c1, c2, c3, _mm_load_ps(in[i].e)));
+    }
+}
+
+
+inline Vec4 transform(const Matrix4& m, const Vec4& v) noexcept
+{
+    Vec4 result;
+    _mm_store_ps(result.e,
+                 combineColumns(_mm_load_ps(m.c[0].e), _mm_load_ps(m.c[1].e),
+                                _mm_load_ps(m.c[2].e), _mm_load_ps(m.c[3].e),
+                                _mm_load_ps(v.e)));
+    return result;
+}
+
+
+// Each column of the product is a column of b transformed by a
+inline Matrix4 multiply(const Matrix4& a, const Matrix4& b) noexcept
+{
+    Matrix4 result;
+    SIMD::transform(a, b.c, result.c, MAT4_COL);
+    return result;
+}
+
+
+// Loads 4 packed Vec3 {x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3} as {x0..x3}, {y0..y3}, {z0..z3}
+inline void loadTransposed(const Vec3* in, __m128& x, __m128& y, __m128& z) noexcept
+{
+    const f32*   p{in->e};
+    const __m128 a{_mm_loadu_ps(p)}, b{_mm_loadu_ps(p + 4)}, c{_mm_loadu_ps(p + 8)};
+
+    const __m128 z0x1y1z1{_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 3, 2))},
+                 x2y2z2x3{_mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2))};
+
+    x = _mm_shuffle_ps(a, x2y2z2x3, _MM_SHUFFLE(3, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(z0x1y1z1, c, _MM_SHUFFLE(3, 0, 3, 0));
+}
+
+
+// Inverse of loadTransposed
+inline void storeTransposed(Vec3* out, const __m128 x, const __m128 y, const __m128 z) noexcept
+{
+    const __m128 x0y0x1y1{_mm_unpacklo_ps(x, y)}, x2y2x3y3{_mm_unpackhi_ps(x, y)};
+
+    const __m128 a{_mm_shuffle_ps(x0y0x1y1, _mm_shuffle_ps(z, x0y0x1y1, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0))},
+                 b{_mm_shuffle_ps(_mm_shuffle_ps(x0y0x1y1, z, _MM_SHUFFLE(1, 1, 3, 3)), x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0))},
+                 c{_mm_shuffle_ps(_mm_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(2, 2, 2, 2)),
+                                  _mm_shuffle_ps(x2y2x3y3, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))};
+
+    f32* p{out->e};
+    _mm_storeu_ps(p,     a);
+    _mm_storeu_ps(p + 4, b);
+    _mm_storeu_ps(p + 8, c);
+}
+
+
+// Four Vec3 per iteration, transposed to x/y/z registers so that every lane is
+// used, with the 9 (or 12 with translation) coefficients broadcast once per batch
+template<bool IsPoint>
+inline void transform(const Matrix4& m, const Vec3* in, Vec3* out, const size_t count) noexcept
+{
+    const __m128 m0{_mm_set1_ps(m.e[0])}, m1{_mm_set1_ps(m.e[1])}, m2 {_mm_set1_ps(m.e[2])},
+                 m4{_mm_set1_ps(m.e[4])}, m5{_mm_set1_ps(m.e[5])}, m6 {_mm_set1_ps(m.e[6])},
+                 m8{_mm_set1_ps(m.e[8])}, m9{_mm_set1_ps(m.e[9])}, m10{_mm_set1_ps(m.e[10])},
+                 tx{_mm_set1_ps(IsPoint ? m.e[12] : .0f)},
+                 ty{_mm_set1_ps(IsPoint ? m.e[13] : .0f)},
+                 tz{_mm_set1_ps(IsPoint ? m.e[14] : .0f)};
+
+    size_t i{0u};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        __m128 x, y, z;
+        loadTransposed(in + i, x, y, z);
+
+        storeTransposed(out + i,
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_add_ps(_mm_mul_ps(m8,  z), tx)),
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_add_ps(_mm_mul_ps(m9,  z), ty)),
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_add_ps(_mm_mul_ps(m10, z), tz)));
+    }
+
+    for (; i < count; ++i)
+    {
+        out[i] = (m * Vec4{in[i], IsPoint ? 1.f : .0f}).xyz;
+    }
+}
+
+
+// {det(r2, r3), det(r2, r3), det(r0, r1), det(r0, r1)},
+// det(u, v) being the 2x2 determinant made of the components I and J of u and v
+template<int I, int J>
+inline __m128 pairDeterminants(const __m128 r0, const __m128 r1,
+                               const __m128 r2, const __m128 r3) noexcept
+{
+    const __m128 ui{_mm_shuffle_ps(r2, r0, _MM_SHUFFLE(I, I, I, I))},
+                 uj{_mm_shuffle_ps(r2, r0, _MM_SHUFFLE(J, J, J, J))},
+                 vi{_mm_shuffle_ps(r3, r1, _MM_SHUFFLE(I, I, I, I))},
+                 vj{_mm_shuffle_ps(r3, r1, _MM_SHUFFLE(J, J, J, J))};
+
+    return _mm_sub_ps(_mm_mul_ps(ui, vj), _mm_mul_ps(vi, uj));
+}
+
+
+// Cramer's rule: the 2x2 determinants of the first two and last two columns
+// are computed side by side, then each column of the adjugate is three
+// multiply-adds of those determinants with the transposed input.
+inline Matrix4 inversed(const Matrix4& m) noexcept
+{
+    const __m128 r0{_mm_load_ps(m.c[0].e)}, r1{_mm_load_ps(m.c[1].e)},
+                 r2{_mm_load_ps(m.c[2].e)}, r3{_mm_load_ps(m.c[3].e)};
+
+    const __m128 d01{pairDeterminants<0, 1>(r0, r1, r2, r3)},
+                 d02{pairDeterminants<0, 2>(r0, r1, r2, r3)},
+                 d03{pairDeterminants<0, 3>(r0, r1, r2, r3)},
+                 d12{pairDeterminants<1, 2>(r0, r1, r2, r3)},
+                 d13{pairDeterminants<1, 3>(r0, r1, r2, r3)},
+                 d23{pairDeterminants<2, 3>(r0, r1, r2, r3)};
+
+    // ax = {r1.x, r0.x, r3.x, r2.x}, and so on for ay, az, aw
+    __m128 ax{r1}, ay{r0}, az{r3}, aw{r2};
+    _MM_TRANSPOSE4_PS(ax, ay, az, aw);
+
+    const __m128 signPNPN{_mm_setr_ps(.0f, -.0f, .0f, -.0f)},
+                 signNPNP{_mm_setr_ps(-.0f, .0f, -.0f, .0f)};
+
+    const __m128 adj0{_mm_xor_ps(signPNPN, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(ay, d23), _mm_mul_ps(az, d13)), _mm_mul_ps(aw, d12)))},
+                 adj1{_mm_xor_ps(signNPNP, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(ax, d23), _mm_mul_ps(az, d03)), _mm_mul_ps(aw, d02)))},
+                 adj2{_mm_xor_ps(signPNPN, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(ax, d13), _mm_mul_ps(ay, d03)), _mm_mul_ps(aw, d01)))},
+                 adj3{_mm_xor_ps(signNPNP, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(ax, d12), _mm_mul_ps(ay, d02)), _mm_mul_ps(az, d01)))};
+
+    // det = dot(r0, {adj0.x, adj1.x, adj2.x, adj3.x})
+    const __m128 firstCol{_mm_movelh_ps(_mm_unpacklo_ps(adj0, adj1), _mm_unpacklo_ps(adj2, adj3))};
+    __m128 det{_mm_mul_ps(r0, firstCol)};
+    det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+    det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    const __m128 reciprocal{_mm_div_ps(_mm_set1_ps(1.f), det)};
+
+    Matrix4 result;
+    _mm_store_ps(result.c[0].e, _mm_mul_ps(adj0, reciprocal));
+    _mm_store_ps(result.c[1].e, _mm_mul_ps(adj1, reciprocal));
+    _mm_store_ps(result.c[2].e, _mm_mul_ps(adj2, reciprocal));
+    _mm_store_ps(result.c[3].e, _mm_mul_ps(adj3, reciprocal));
+    return result;
+}
+
+
+// Inverse of the 3x3 block from cross products of its columns, then the
+// translation is back-substituted. Columns are expected to have w = 0.
+inline Matrix4 inversedAffine(const Matrix4& m) noexcept
+{
+    const __m128 a0{_mm_load_ps(m.c[0].e)}, a1{_mm_load_ps(m.c[1].e)},
+                 a2{_mm_load_ps(m.c[2].e)}, t {_mm_load_ps(m.c[3].e)};
+
+    const auto cross = [](const __m128 u, const __m128 v) noexcept
+    {
+        const __m128 uYZX{_mm_shuffle_ps(u, u, _MM_SHUFFLE(3, 0, 2, 1))}, vYZX{_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1))},
+                     uZXY{_mm_shuffle_ps(u, u, _MM_SHUFFLE(3, 1, 0, 2))}, vZXY{_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2))};
+
+        return _mm_sub_ps(_mm_mul_ps(uYZX, vZXY), _mm_mul_ps(uZXY, vYZX));
+    };
+
+    // Rows of the adjugate of the 3x3 block
+    __m128 r0{cross(a1, a2)}, r1{cross(a2, a0)}, r2{cross(a0, a1)},
+           r3{_mm_setr_ps(.0f, .0f, .0f, 1.f)};
+
+    __m128 det{_mm_mul_ps(a0, r0)};
+    det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+    det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    const __m128 reciprocal{_mm_div_ps(_mm_set1_ps(1.f), det)};
+    r0 = _mm_mul_ps(r0, reciprocal);
+    r1 = _mm_mul_ps(r1, reciprocal);
+    r2 = _mm_mul_ps(r2, reciprocal);
+
+    // Rows to columns, r3 becomes {0, 0, 0, 1}
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    const __m128 tx{_mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0))},
+                 ty{_mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1))},
+                 tz{_mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2))};
+
+    Matrix4 result;
+    _mm_store_ps(result.c[0].e, r0);
+    _mm_store_ps(result.c[1].e, r1);
+    _mm_store_ps(result.c[2].e, r2);
+    _mm_store_ps(result.c[3].e, _mm_sub_ps(r3, _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, tx), _mm_mul_ps(r1, ty)),
+                                                          _mm_mul_ps(r2, tz))));
+    return result;
+}
+
+
+// Product of two affine matrices, the bottom rows are never read
+inline Matrix4 multiplyAffine(const Matrix4& a, const Matrix4& b) noexcept
+{
+    const __m128 a0{_mm_load_ps(a.c[0].e)}, a1{_mm_load_ps(a.c[1].e)},
+                 a2{_mm_load_ps(a.c[2].e)}, a3{_mm_load_ps(a.c[3].e)};
+
+    Matrix4 result;
+
+    for (u8 j{0u}; j < MAT4_COL; ++j)
+    {
+        const __m128 col{_mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(b.c[j].x)),
+                                               _mm_mul_ps(a1, _mm_set1_ps(b.c[j].y))),
+                                    _mm_mul_ps(a2, _mm_set1_ps(b.c[j].z)))};
+
+        _mm_store_ps(result.c[j].e, j == 3u ? _mm_add_ps(col, a3) : col);
+    }
+
+    return result;
+}
+
+} // End of namespace SIMD
+#endif
+
+
+
+
 /* ======== Static methods, pseudo-constructors ======== */
 inline constexpr Matrix4 Matrix4::zero() noexcept
 {
@@ -26,16 +298,16 @@ inline constexpr Matrix4 Matrix4::identity() noexcept
 
 
 /* =================== Constructors =================== */
-inline constexpr Matrix4::Matrix4(const f32 e0,  const f32 e1,  const f32 e2,  const f32 e3,
-                                  const f32 e4,  const f32 e5,  const f32 e6,  const f32 e7,
-                                  const f32 e8,  const f32 e9,  const f32 e10, const f32 e11,
-                                  const f32 e12, const f32 e13, const f32 e14, const f32 e15) noexcept
+inline constexpr Matrix4::Matrix(const f32 e0,  const f32 e1,  const f32 e2,  const f32 e3,
+                                 const f32 e4,  const f32 e5,  const f32 e6,  const f32 e7,
+                                 const f32 e8,  const f32 e9,  const f32 e10, const f32 e11,
+                                 const f32 e12, const f32 e13, const f32 e14, const f32 e15) noexcept
     : e{e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15}
 {}
 
 
-inline constexpr Matrix4::Matrix4(const Vec4& c0, const Vec4& c1,
-                                  const Vec4& c2, const Vec4& c3) noexcept
+inline constexpr Matrix4::Matrix(const Vec4& c0, const Vec4& c1,
+                                 const Vec4& c2, const Vec4& c3) noexcept
     : c{c0, c1, c2, c3}
 {}
 
@@ -128,7 +400,14 @@ inline constexpr f32 Matrix4::det() const noexcept
 
 
 inline constexpr Matrix4 Matrix4::inversed() const noexcept
-{ return adjugate() / det(); }
+{
+#ifdef GPM_USE_SSE
+    if (!GPM_IS_CONSTANT_EVALUATED())
+        return SIMD::inversed(*this);
+#endif
+
+    return adjugate() / det();
+}
 
 
 inline constexpr f32 Matrix4::trace() const noexcept
@@ -142,6 +421,87 @@ inline bool Matrix4::isEqualTo(const Matrix4& m, const f32 eps) const noexcept
 }
 
 
+inline constexpr bool Matrix4::isAffine() const noexcept
+{ return e[3] == .0f && e[7] == .0f && e[11] == .0f && e[15] == 1.f; }
+
+
+// Same result as cofactor() for an affine matrix {A, t}, which is
+// det(A) * {A^-T, 0 ; -(A^-1 * t)^T, 1}: the columns of the cofactor
+// matrix of A are cross products of the columns of A.
+inline constexpr Matrix4 Matrix4::cofactorAffine() const noexcept
+{
+    const Vec3 r0{(e[5] * e[10]) - (e[6] * e[9]), (e[6] * e[8]) - (e[4] * e[10]), (e[4] * e[9]) - (e[5] * e[8])},
+               r1{(e[9] * e[2])  - (e[10] * e[1]), (e[10] * e[0]) - (e[8] * e[2]), (e[8] * e[1]) - (e[9] * e[0])},
+               r2{(e[1] * e[6])  - (e[2] * e[5]), (e[2] * e[4]) - (e[0] * e[6]), (e[0] * e[5]) - (e[1] * e[4])},
+               t {e[12], e[13], e[14]};
+
+    return
+    {
+        r0.x, r0.y, r0.z, -r0.dot(t),
+        r1.x, r1.y, r1.z, -r1.dot(t),
+        r2.x, r2.y, r2.z, -r2.dot(t),
+        .0f,  .0f,  .0f,  (e[0] * r0.x) + (e[1] * r0.y) + (e[2] * r0.z)
+    };
+}
+
+
+// About 50 flops instead of 200 for inversed(): only the 3x3 block is
+// inverted, then the translation is back-substituted
+inline constexpr Matrix4 Matrix4::inversedAffine() const noexcept
+{
+#ifdef GPM_USE_SSE
+    if (!GPM_IS_CONSTANT_EVALUATED())
+        return SIMD::inversedAffine(*this);
+#endif
+
+    // Rows of the adjugate of the 3x3 block, i.e. cross products of its columns
+    const Vec3 r0{(e[5] * e[10]) - (e[6] * e[9]), (e[6] * e[8]) - (e[4] * e[10]), (e[4] * e[9]) - (e[5] * e[8])},
+               r1{(e[9] * e[2])  - (e[10] * e[1]), (e[10] * e[0]) - (e[8] * e[2]), (e[8] * e[1]) - (e[9] * e[0])},
+               r2{(e[1] * e[6])  - (e[2] * e[5]), (e[2] * e[4]) - (e[0] * e[6]), (e[0] * e[5]) - (e[1] * e[4])},
+               t {e[12], e[13], e[14]};
+
+    const f32 reciprocal{1.f / ((e[0] * r0.x) + (e[1] * r0.y) + (e[2] * r0.z))};
+
+    return
+    {
+        r0.x * reciprocal,       r1.x * reciprocal,       r2.x * reciprocal,       .0f,
+        r0.y * reciprocal,       r1.y * reciprocal,       r2.y * reciprocal,       .0f,
+        r0.z * reciprocal,       r1.z * reciprocal,       r2.z * reciprocal,       .0f,
+        -r0.dot(t) * reciprocal, -r1.dot(t) * reciprocal, -r2.dot(t) * reciprocal, 1.f
+    };
+}
+
+
+// *this * m, skipping the bottom row of both matrices
+inline constexpr Matrix4 Matrix4::multiplyAffine(const Matrix4& m) const noexcept
+{
+#ifdef GPM_USE_SSE
+    if (!GPM_IS_CONSTANT_EVALUATED())
+        return SIMD::multiplyAffine(*this, m);
+#endif
+
+    return
+    {
+        (e[0] * m.e[0])  + (e[4] * m.e[1])  + (e[8]  * m.e[2]),
+        (e[1] * m.e[0])  + (e[5] * m.e[1])  + (e[9]  * m.e[2]),
+        (e[2] * m.e[0])  + (e[6] * m.e[1])  + (e[10] * m.e[2]),
+        .0f,
+        (e[0] * m.e[4])  + (e[4] * m.e[5])  + (e[8]  * m.e[6]),
+        (e[1] * m.e[4])  + (e[5] * m.e[5])  + (e[9]  * m.e[6]),
+        (e[2] * m.e[4])  + (e[6] * m.e[5])  + (e[10] * m.e[6]),
+        .0f,
+        (e[0] * m.e[8])  + (e[4] * m.e[9])  + (e[8]  * m.e[10]),
+        (e[1] * m.e[8])  + (e[5] * m.e[9])  + (e[9]  * m.e[10]),
+        (e[2] * m.e[8])  + (e[6] * m.e[9])  + (e[10] * m.e[10]),
+        .0f,
+        (e[0] * m.e[12]) + (e[4] * m.e[13]) + (e[8]  * m.e[14]) + e[12],
+        (e[1] * m.e[12]) + (e[5] * m.e[13]) + (e[9]  * m.e[14]) + e[13],
+        (e[2] * m.e[12]) + (e[6] * m.e[13]) + (e[10] * m.e[14]) + e[14],
+        1.f
+    };
+}
+
+
 
 
 /* ================ Operator overloads ================= */
@@ -155,24 +515,7 @@ inline constexpr bool Matrix4::operator==(const Matrix4& m) const noexcept
 // This actually does m * *this
 inline constexpr Matrix4& Matrix4::operator*=(const Matrix4& m) noexcept
 {
-    e[0]  = (e[0] * m.e[0]) + (e[4] * m.e[4]) + (e[8]  * m.e[8])  + (e[12] * m.e[12]);
-    e[1]  = (e[1] * m.e[0]) + (e[5] * m.e[4]) + (e[9]  * m.e[8])  + (e[13] * m.e[12]);
-    e[2]  = (e[2] * m.e[0]) + (e[6] * m.e[4]) + (e[10] * m.e[8])  + (e[14] * m.e[12]);
-    e[3]  = (e[3] * m.e[0]) + (e[7] * m.e[4]) + (e[11] * m.e[8])  + (e[15] * m.e[12]);
-    e[4]  = (e[0] * m.e[1]) + (e[4] * m.e[5]) + (e[8]  * m.e[9])  + (e[12] * m.e[13]);
-    e[5]  = (e[1] * m.e[1]) + (e[5] * m.e[5]) + (e[9]  * m.e[9])  + (e[13] * m.e[13]);
-    e[6]  = (e[2] * m.e[1]) + (e[6] * m.e[5]) + (e[10] * m.e[9])  + (e[14] * m.e[13]);
-    e[7]  = (e[3] * m.e[1]) + (e[7] * m.e[5]) + (e[11] * m.e[9])  + (e[15] * m.e[13]);
-    e[8]  = (e[0] * m.e[2]) + (e[4] * m.e[6]) + (e[8]  * m.e[10]) + (e[12] * m.e[14]);
-    e[9]  = (e[1] * m.e[2]) + (e[5] * m.e[6]) + (e[9]  * m.e[10]) + (e[13] * m.e[14]);
-    e[10] = (e[2] * m.e[2]) + (e[6] * m.e[6]) + (e[10] * m.e[10]) + (e[14] * m.e[14]);
-    e[11] = (e[3] * m.e[2]) + (e[7] * m.e[6]) + (e[11] * m.e[10]) + (e[15] * m.e[14]);
-    e[12] = (e[0] * m.e[3]) + (e[4] * m.e[7]) + (e[8]  * m.e[11]) + (e[12] * m.e[15]);
-    e[13] = (e[1] * m.e[3]) + (e[5] * m.e[7]) + (e[9]  * m.e[11]) + (e[13] * m.e[15]);
-    e[14] = (e[2] * m.e[3]) + (e[6] * m.e[7]) + (e[10] * m.e[11]) + (e[14] * m.e[15]);
-    e[15] = (e[3] * m.e[3]) + (e[7] * m.e[7]) + (e[11] * m.e[11]) + (e[15] * m.e[15]);
-
-    return *this;
+    return *this = m * *this;
 }
 
 
@@ -191,6 +534,11 @@ inline constexpr Matrix4& Matrix4::operator/=(const f32 k) noexcept
 
 inline constexpr Vec4 Matrix4::operator*(const Vec4& v) const noexcept
 {
+#ifdef GPM_USE_SSE
+    if (!GPM_IS_CONSTANT_EVALUATED())
+        return SIMD::transform(*this, v);
+#endif
+
     return
     {
         (e[0] * v.xyz.x) + (e[4] * v.xyz.y) + (e[8] * v.xyz.z) + (e[12] * v.w),
@@ -203,6 +551,11 @@ inline constexpr Vec4 Matrix4::operator*(const Vec4& v) const noexcept
 
 inline constexpr Matrix4 Matrix4::operator*(const Matrix4& m) const noexcept
 {
+#ifdef GPM_USE_SSE
+    if (!GPM_IS_CONSTANT_EVALUATED())
+        return SIMD::multiply(*this, m);
+#endif
+
     return
     {
         (e[0] * m.e[0])  + (e[4] * m.e[1])  + (e[8]  * m.e[2])  + (e[12] * m.e[3]),
@@ -236,4 +589,46 @@ inline constexpr Matrix4 Matrix4::operator/(const f32 k) const noexcept
         e[8]  * reciprocal, e[9]  * reciprocal, e[10] * reciprocal, e[11] * reciprocal,
         e[12] * reciprocal, e[13] * reciprocal, e[14] * reciprocal, e[15] * reciprocal,
     };
+}
+
+
+
+
+/* ================ Batched transforms ================= */
+inline void transform(const Matrix4& m, const Vec4* in, Vec4* out, const size_t count) noexcept
+{
+#ifdef GPM_USE_SSE
+    SIMD::transform(m, in, out, count);
+#else
+    for (size_t i{0u}; i < count; ++i)
+    {
+        out[i] = m * in[i];
+    }
+#endif
+}
+
+
+inline void transformPoints(const Matrix4& m, const Vec3* in, Vec3* out, const size_t count) noexcept
+{
+#ifdef GPM_USE_SSE
+    SIMD::transform<true>(m, in, out, count);
+#else
+    for (size_t i{0u}; i < count; ++i)
+    {
+        out[i] = (m * Vec4{in[i], 1.f}).xyz;
+    }
+#endif
+}
+
+
+inline void transformDirections(const Matrix4& m, const Vec3* in, Vec3* out, const size_t count) noexcept
+{
+#ifdef GPM_USE_SSE
+    SIMD::transform<false>(m, in, out, count);
+#else
+    for (size_t i{0u}; i < count; ++i)
+    {
+        out[i] = (m * Vec4{in[i], .0f}).xyz;
+    }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "Types.hpp"
+
+namespace GPM
+{
+
+// Candidates of the k nearest neighbour queries of KdTree and SpatialHashGrid:
+// a max-heap stored in the output arrays, squared distances and indices side by
+// side, with the farthest candidate at 0 so that it is the one replaced
+namespace NearestHeap
+{
+
+// Restores the heap below i, after distances[i] decreased
+void siftDown   (f32* distances, u32* indices, const size_t size, size_t i)    noexcept;
+
+// Restores the heap above i, after a candidate was appended at i
+void siftUp     (f32* distances, u32* indices, size_t i)                        noexcept;
+
+// Turns the heap into candidates of increasing distances
+void sort       (f32* distances, u32* indices, const size_t size)              noexcept;
+
+} // End of namespace NearestHeap
+
+#include "NearestHeap.inl"
+
+} // End of namespace GPM
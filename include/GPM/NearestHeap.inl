@@ -0,0 +1,47 @@
+inline void NearestHeap::siftDown(f32* distances, u32* indices, const size_t size, size_t i) noexcept
+{
+    for (;;)
+    {
+        const size_t left   {2u * i + 1u};
+        const size_t right  {left + 1u};
+        size_t       largest{i};
+
+        if (left < size && distances[left] > distances[largest])
+            largest = left;
+        if (right < size && distances[right] > distances[largest])
+            largest = right;
+
+        if (largest == i)
+            return;
+
+        std::swap(distances[i], distances[largest]);
+        std::swap(indices[i],   indices[largest]);
+        i = largest;
+    }
+}
+
+
+inline void NearestHeap::siftUp(f32* distances, u32* indices, size_t i) noexcept
+{
+    while (i > 0u)
+    {
+        const size_t parent{(i - 1u) / 2u};
+        if (distances[parent] >= distances[i])
+            return;
+
+        std::swap(distances[i], distances[parent]);
+        std::swap(indices[i],   indices[parent]);
+        i = parent;
+    }
+}
+
+
+inline void NearestHeap::sort(f32* distances, u32* indices, const size_t size) noexcept
+{
+    for (size_t end{size}; end > 1u; --end)
+    {
+        std::swap(distances[0], distances[end - 1u]);
+        std::swap(indices[0],   indices[end - 1u]);
+        siftDown(distances, indices, end - 1u, 0u);
+    }
+}
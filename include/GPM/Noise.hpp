@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Types.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "Calc.hpp"
+#include "SIMD.hpp"
+
+#if defined(GPM_USE_SSE) && !defined(GPM_USE_AVX) && defined(__SSE4_1__)
+#   include <smmintrin.h>
+#endif
+
+namespace GPM
+{
+
+// Coherent noise functions, with values in [-1, 1]:
+//
+//  type     dimensions   notes
+//  Value    1 to 4       smoothly interpolated random values on the integer lattice
+//  Perlin   1 to 4       improved gradient noise (Perlin 2002), quintic fade
+//  Simplex  2 to 4       gradient noise on the simplex grid: D + 1 corners instead of 2^D
+//
+// Lattice points are hashed in 32-bit integer arithmetic: the integer coordinates,
+// multiplied by one constant per axis, are combined with the seed and mixed by two
+// multiply-xorshift rounds. The results are the same on every SIMD backend: AVX2
+// hashes 8 lanes at once, AVX without AVX2 goes through two SSE4.1 halves and SSE2
+// emulates the 32-bit products. The noise doesn't repeat over the valid inputs,
+// which must stay below 2^22 in magnitude.
+//
+// Any u32 is a valid seed, e.g. drawn from a Random::Generator, and octaves of a
+// fractal use seeds derived from it.
+//
+// Cost: a 512 x 512 fractalGrid() tile of one octave takes about 0.6 ms of value
+// noise, but 1.6 to 1.8 ms of Perlin or simplex noise, on one AVX2 core
+// (tests/benchmark.cpp). Only value noise fits a sub-millisecond budget per tile,
+// and every octave adds the same cost again.
+enum class ENoise
+{
+    Value,
+    Perlin,
+    Simplex
+};
+
+// How the octaves of a fractal are combined. Results are in [-1, 1].
+//  FBm:    sum of octaves weighted by gain^octave (fractional Brownian motion)
+//  Billow: same with 2 |noise| - 1, for rounded hills and clouds
+//  Ridged: (1 - |noise|)^2 with each octave weighted by the previous one (Musgrave)
+enum class ELayering
+{
+    FBm,
+    Billow,
+    Ridged
+};
+
+struct Fractal
+{
+    ELayering layering  {ELayering::FBm};
+    u32       octaves   {5u};
+    f32       frequency {1.f};
+    f32       lacunarity{2.f};
+    f32       gain      {.5f};
+};
+
+namespace Noise
+{
+
+/* =================== Scalar evaluation =================== */
+// Simplex noise starts at 2 dimensions, the 1D overloads default to Perlin noise
+template<ENoise N = ENoise::Perlin>  f32 evaluate(const f32 x,   const u32 seed = 0u)  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec2& p, const u32 seed = 0u)  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec3& p, const u32 seed = 0u)  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec4& p, const u32 seed = 0u)  noexcept;
+
+// Value and analytic gradient (derivative in 1D), e.g. for terrain normals
+template<ENoise N = ENoise::Perlin>  f32 evaluate(const f32 x,   f32& derivative,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec2& p, Vec2& gradient,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec3& p, Vec3& gradient,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 evaluate(const Vec4& p, Vec4& gradient,
+                                                  const u32 seed = 0u)                  noexcept;
+
+template<ENoise N = ENoise::Perlin>  f32 fractal (const f32 x,   const Fractal& settings,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 fractal (const Vec2& p, const Fractal& settings,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 fractal (const Vec3& p, const Fractal& settings,
+                                                  const u32 seed = 0u)                  noexcept;
+template<ENoise N = ENoise::Simplex> f32 fractal (const Vec4& p, const Fractal& settings,
+                                                  const u32 seed = 0u)                  noexcept;
+
+
+/* =================== Batched evaluation =================== */
+// GPM_SIMD_WIDTH points per iteration
+template<ENoise N = ENoise::Perlin>
+void evaluate   (const f32*  in, f32* out, const size_t count, const u32 seed = 0u)    noexcept;
+template<ENoise N = ENoise::Simplex>
+void evaluate   (const Vec2* in, f32* out, const size_t count, const u32 seed = 0u)    noexcept;
+template<ENoise N = ENoise::Simplex>
+void evaluate   (const Vec3* in, f32* out, const size_t count, const u32 seed = 0u)    noexcept;
+template<ENoise N = ENoise::Simplex>
+void evaluate   (const Vec4* in, f32* out, const size_t count, const u32 seed = 0u)    noexcept;
+
+template<ENoise N = ENoise::Perlin>
+void fractal    (const f32*  in, f32* out, const size_t count,
+                 const Fractal& settings, const u32 seed = 0u)                          noexcept;
+template<ENoise N = ENoise::Simplex>
+void fractal    (const Vec2* in, f32* out, const size_t count,
+                 const Fractal& settings, const u32 seed = 0u)                          noexcept;
+template<ENoise N = ENoise::Simplex>
+void fractal    (const Vec3* in, f32* out, const size_t count,
+                 const Fractal& settings, const u32 seed = 0u)                          noexcept;
+template<ENoise N = ENoise::Simplex>
+void fractal    (const Vec4* in, f32* out, const size_t count,
+                 const Fractal& settings, const u32 seed = 0u)                          noexcept;
+
+// width * height samples at origin + (x * step.x, y * step.y), row by row, e.g. a heightmap tile
+template<ENoise N = ENoise::Simplex>
+void fractalGrid(const Vec2& origin, const Vec2& step, const u32 width, const u32 height,
+                 f32* out, const Fractal& settings, const u32 seed = 0u)                noexcept;
+
+} // End of namespace Noise
+
+#include "Noise.inl"
+
+} // End of namespace GPM
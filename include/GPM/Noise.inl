@@ -0,0 +1,765 @@
+namespace Noise::Kernel
+{
+
+using namespace Math::Kernel;
+
+template<typename V>
+inline V    floor       (const V x)                                   noexcept
+{
+    const V r{roundNearest(x)};
+    return select(lessThan(x, r), sub(r, constant<V>(1.f)), r);
+}
+
+
+/* Lattice keys: the integer coordinates of the cells, hashed in 32-bit integer
+ * arithmetic. Every axis multiplies its coordinate by its own odd constant, the
+ * products of the corners are combined with the seed, and the finalizer of
+ * lowbias32 (Wellons) mixes them, of which the top 8 bits are kept. */
+constexpr u32 axisKeys[4]{0x8DA6B343u, 0xD8163841u, 0xCB1AB31Fu, 0x165667B1u};
+
+// Integer value of a float holding an integer
+inline u32  toKey       (const f32 a)                                 noexcept { return static_cast<u32>(static_cast<s32>(a)); }
+inline u32  keyAdd      (const u32 a, const u32 b)                    noexcept { return a + b; }
+inline u32  keyXor      (const u32 a, const u32 b)                    noexcept { return a ^ b; }
+inline u32  keyMul      (const u32 a, const u32 k)                    noexcept { return a * k; }
+inline u32  keyShiftXor (const u32 a, const s32 shift)                noexcept { return a ^ (a >> shift); }
+inline u32  keyIf       (const bool m, const u32 k)                   noexcept { return m ? k : 0u; }
+inline f32  keyTop      (const u32 a)                                 noexcept { return static_cast<f32>(a >> 24u); }
+
+#if defined(GPM_USE_AVX)
+
+inline __m256i toKey    (const f32v a)                                noexcept { return _mm256_cvtps_epi32(a); }
+inline __m256i keyXor   (const __m256i a, const __m256i b)            noexcept
+{
+    return _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+}
+inline __m256i keyIf    (const maskv m, const u32 k)                  noexcept
+{
+    return _mm256_castps_si256(_mm256_and_ps(m, _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<s32>(k)))));
+}
+
+#if defined(__AVX2__)
+
+inline __m256i keyAdd   (const __m256i a, const __m256i b)            noexcept { return _mm256_add_epi32(a, b); }
+inline __m256i keyMul   (const __m256i a, const u32 k)                noexcept { return _mm256_mullo_epi32(a, _mm256_set1_epi32(static_cast<s32>(k))); }
+inline __m256i keyShiftXor(const __m256i a, const s32 shift)          noexcept { return _mm256_xor_si256(a, _mm256_srli_epi32(a, shift)); }
+inline f32v    keyTop   (const __m256i a)                             noexcept { return _mm256_cvtepi32_ps(_mm256_srli_epi32(a, 24)); }
+
+#else
+
+// AVX without AVX2 has no 256-bit integer arithmetic: each half goes through SSE4.1
+template<typename F>
+inline __m256i perHalf  (const __m256i a, F&& function)               noexcept
+{
+    const __m128i low {function(_mm256_castsi256_si128(a))};
+    const __m128i high{function(_mm256_extractf128_si256(a, 1))};
+    return _mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+inline __m256i keyAdd   (const __m256i a, const __m256i b)            noexcept
+{
+    const __m128i high{_mm_add_epi32(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1))};
+    return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_add_epi32(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b))), high, 1);
+}
+inline __m256i keyMul   (const __m256i a, const u32 k)                noexcept
+{
+    return perHalf(a, [k](const __m128i half) { return _mm_mullo_epi32(half, _mm_set1_epi32(static_cast<s32>(k))); });
+}
+inline __m256i keyShiftXor(const __m256i a, const s32 shift)          noexcept
+{
+    return perHalf(a, [shift](const __m128i half) { return _mm_xor_si128(half, _mm_srli_epi32(half, shift)); });
+}
+inline f32v    keyTop   (const __m256i a)                             noexcept
+{
+    return _mm256_cvtepi32_ps(perHalf(a, [](const __m128i half) { return _mm_srli_epi32(half, 24); }));
+}
+
+#endif
+
+#elif defined(GPM_USE_SSE)
+
+inline __m128i toKey    (const f32v a)                                noexcept { return _mm_cvtps_epi32(a); }
+inline __m128i keyAdd   (const __m128i a, const __m128i b)            noexcept { return _mm_add_epi32(a, b); }
+inline __m128i keyXor   (const __m128i a, const __m128i b)            noexcept { return _mm_xor_si128(a, b); }
+inline __m128i keyShiftXor(const __m128i a, const s32 shift)          noexcept { return _mm_xor_si128(a, _mm_srli_epi32(a, shift)); }
+inline __m128i keyIf    (const maskv m, const u32 k)                  noexcept { return _mm_and_si128(_mm_castps_si128(m), _mm_set1_epi32(static_cast<s32>(k))); }
+inline f32v    keyTop   (const __m128i a)                             noexcept { return _mm_cvtepi32_ps(_mm_srli_epi32(a, 24)); }
+
+inline __m128i keyMul   (const __m128i a, const u32 k)                noexcept
+{
+    const __m128i m{_mm_set1_epi32(static_cast<s32>(k))};
+#if defined(__SSE4_1__)
+    return _mm_mullo_epi32(a, m);
+#else
+    // Low halves of the even and odd products, interleaved back
+    const __m128i even{_mm_shuffle_epi32(_mm_mul_epu32(a, m), _MM_SHUFFLE(0, 0, 2, 0))};
+    const __m128i odd {_mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(a, 32), m), _MM_SHUFFLE(0, 0, 2, 0))};
+    return _mm_unpacklo_epi32(even, odd);
+#endif
+}
+
+#endif
+
+template<typename V>
+using Key = decltype(toKey(V{}));
+
+
+template<typename V>
+inline Key<V> keyConstant(const u32 k)                                noexcept
+{
+    if constexpr (std::is_same_v<V, f32>)
+        return k;
+#if defined(GPM_USE_AVX)
+    else
+        return _mm256_set1_epi32(static_cast<s32>(k));
+#elif defined(GPM_USE_SSE)
+    else
+        return _mm_set1_epi32(static_cast<s32>(k));
+#endif
+}
+
+
+// Hashes in [0, 256) to [-1, 1]: 2 / 255 rounded down, so that 255 doesn't map
+// above 1, with or without FMA
+constexpr f32 hashScale{0x1.0101p-7f};
+
+
+// Hash in [0, 256) of a combined key
+template<typename K>
+inline auto hashKey     (K key)                                       noexcept
+{
+    key = keyMul(keyShiftXor(key, 16), 0x7FEB352Du);
+    key = keyMul(keyShiftXor(key, 15), 0x846CA68Bu);
+    return keyTop(key);
+}
+
+
+// Gradient of a lattice point from its hash in [0, 256):
+//  1D: uniform in [-1, 1]
+//  2D: the 8 unit vectors at 45 degree steps
+//  3D: the 12 edges of the cube, 4 of them twice (Perlin 2002)
+//  4D: the 32 edges of the tesseract
+template<size_t D, typename V>
+inline void gradient    (const V h, V (&g)[D])                        noexcept
+{
+    const V zero{constant<V>(.0f)}, one{constant<V>(1.f)}, minusOne{constant<V>(-1.f)};
+
+    if constexpr (D == 1u)
+    {
+        g[0] = mulAdd(h, constant<V>(hashScale), minusOne);
+    }
+    else if constexpr (D == 2u)
+    {
+        const auto b0{hasBit(h, 1)}, b1{hasBit(h, 2)}, b2{hasBit(h, 4)};
+        const V    diagonal{constant<V>(.707106781f)}, minusDiagonal{constant<V>(-.707106781f)};
+        const V    sign{select(b0, minusOne, one)};
+
+        g[0] = select(b2, select(b0, minusDiagonal, diagonal), select(b1, zero, sign));
+        g[1] = select(b2, select(b1, minusDiagonal, diagonal), select(b1, sign, zero));
+    }
+    else if constexpr (D == 3u)
+    {
+        const auto b0{hasBit(h, 1)}, b1{hasBit(h, 2)}, b2{hasBit(h, 4)}, b3{hasBit(h, 8)};
+        const V    u {select(b0, minusOne, one)};
+        const V    v {select(b1, minusOne, one)};
+
+        // u is on x below 8 and on y above; v is on y below 4, on x for 12 and 14, on z otherwise
+        const V vx{select(maskAnd(b3, b2), select(b0, zero, v), zero)};
+        const V vy{select(maskOr(b3, b2), zero, v)};
+
+        g[0] = add(select(b3, zero, u), vx);
+        g[1] = add(select(b3, u, zero), vy);
+        g[2] = sub(sub(v, vx), vy);
+    }
+    else
+    {
+        static_assert(D == 4u, "Noise is defined in 1 to 4 dimensions");
+
+        // Bits 3 and 4 give the zero coordinate, bits 0 to 2 the signs of the others
+        const auto b0{hasBit(h, 1)}, b1{hasBit(h, 2)}, b2{hasBit(h, 4)}, b3{hasBit(h, 8)}, b4{hasBit(h, 16)};
+        const V    s0{select(b0, minusOne, one)};
+        const V    s1{select(b1, minusOne, one)};
+        const V    s2{select(b2, minusOne, one)};
+
+        g[0] = select(maskOr(b3, b4), s0, zero);
+        g[1] = select(b4, s1, select(b3, zero, s0));
+        g[2] = select(b4, select(b3, s2, zero), s1);
+        g[3] = select(maskAnd(b3, b4), zero, s2);
+    }
+}
+
+
+// Key of a seed, combined with those of the lattice points
+inline u32 seedKey(const u32 seed) noexcept
+{
+    u32 z{seed + 0x9E3779B9u};
+    z = (z ^ (z >> 16u)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13u)) * 0xC2B2AE35u;
+    return z ^ (z >> 16u);
+}
+
+
+inline u32 octaveSeed(const u32 seed, const u32 octave) noexcept
+{
+    return seed + octave * 0x68E31DA4u;
+}
+
+
+// Value and Perlin noise: the 2^D corners of the cell are hashed as a tree, one axis
+// after the other, then blended with the quintic fade one axis after the other,
+// carrying the gradient along when requested
+template<ENoise N, size_t D, bool Gradient, typename V>
+inline V lattice(const V (&p)[D], const u32 seed, V (&gradientOut)[D]) noexcept
+{
+    constexpr size_t corners{size_t{1u} << D};
+
+    const V zero{constant<V>(.0f)}, one{constant<V>(1.f)};
+
+    V      t[D], fade[D], fadeDerivative[D];
+    Key<V> cell[D][2];
+    for (size_t d{0u}; d < D; ++d)
+    {
+        const V base{floor(p[d])};
+        t[d]       = sub(p[d], base);
+        cell[d][0] = keyMul(toKey(base), axisKeys[d]);
+        cell[d][1] = keyAdd(cell[d][0], keyConstant<V>(axisKeys[d]));
+
+        // 6 t^5 - 15 t^4 + 10 t^3 and its derivative 30 t^2 (t - 1)^2
+        const V t2{mul(t[d], t[d])};
+        fade[d] = mul(mul(t2, t[d]), mulAdd(t[d], mulAdd(t[d], constant<V>(6.f), constant<V>(-15.f)), constant<V>(10.f)));
+
+        if constexpr (Gradient)
+        {
+            const V tMinusOne{sub(t[d], one)};
+            fadeDerivative[d] = mul(mul(constant<V>(30.f), t2), mul(tMinusOne, tMinusOne));
+        }
+    }
+
+    // Corner k has bit d set when it is on the far side of axis d
+    Key<V> key[corners];
+    key[0] = keyXor(cell[D - 1u][0], keyConstant<V>(seed));
+    key[1] = keyXor(cell[D - 1u][1], keyConstant<V>(seed));
+
+    for (size_t d{D - 1u}; d-- > 0u;)
+    {
+        for (size_t j{size_t{1u} << (D - 1u - d)}; j-- > 0u;)
+        {
+            key[2u * j + 1u] = keyXor(key[j], cell[d][1]);
+            key[2u * j]      = keyXor(key[j], cell[d][0]);
+        }
+    }
+
+    V hash[corners];
+    for (size_t k{0u}; k < corners; ++k)
+        hash[k] = hashKey(key[k]);
+
+    V value[corners];
+    V slope[corners][D];
+
+    for (size_t k{0u}; k < corners; ++k)
+    {
+        if constexpr (N == ENoise::Value)
+        {
+            value[k] = mulAdd(hash[k], constant<V>(hashScale), constant<V>(-1.f));
+
+            for (size_t d{0u}; d < D; ++d)
+                slope[k][d] = zero;
+        }
+        else
+        {
+            V g[D];
+            gradient<D>(hash[k], g);
+
+            value[k] = zero;
+            for (size_t d{0u}; d < D; ++d)
+            {
+                value[k]    = mulAdd(g[d], ((k >> d) & 1u) ? sub(t[d], one) : t[d], value[k]);
+                slope[k][d] = g[d];
+            }
+        }
+    }
+
+    // Blending along axis d halves the corners: pairs (2j, 2j + 1) differ by that axis
+    for (size_t d{0u}; d < D; ++d)
+    {
+        for (size_t j{0u}; j < (corners >> (d + 1u)); ++j)
+        {
+            const V a{value[2u * j]}, b{value[2u * j + 1u]};
+            const V delta{sub(b, a)};
+
+            if constexpr (Gradient)
+            {
+                for (size_t e{0u}; e < D; ++e)
+                    slope[j][e] = mulAdd(fade[d], sub(slope[2u * j + 1u][e], slope[2u * j][e]), slope[2u * j][e]);
+
+                slope[j][d] = mulAdd(fadeDerivative[d], delta, slope[j][d]);
+            }
+
+            value[j] = mulAdd(fade[d], delta, a);
+        }
+    }
+
+    // Perlin noise peaks at sqrt(D) / 2 times the gradient length
+    f32 scale{1.f};
+    if constexpr (N == ENoise::Perlin)
+    {
+        constexpr f32 scales[4]{2.f, 1.41421356f, .816496581f, .577350269f};
+        scale = scales[D - 1u];
+    }
+
+    if constexpr (Gradient)
+    {
+        for (size_t d{0u}; d < D; ++d)
+            gradientOut[d] = mul(slope[0][d], constant<V>(scale));
+    }
+
+    return mul(value[0], constant<V>(scale));
+}
+
+
+// Simplex noise: the point is skewed onto the grid of hypercubes, the simplex is
+// found by ranking its coordinates in the cell (Gustavson 2005), and each of the
+// D + 1 corners contributes (0.5 - r^2)^4 times its gradient ramp
+template<size_t D, bool Gradient, typename V>
+inline V simplex(const V (&p)[D], const u32 seed, V (&gradientOut)[D]) noexcept
+{
+    static_assert(D >= 2u && D <= 4u, "Simplex noise is defined in 2 to 4 dimensions");
+
+    constexpr f32 skews  [5]{.0f, .0f, .366025404f, 1.f / 3.f, .309016994f};
+    constexpr f32 unskews[5]{.0f, .0f, .211324865f, 1.f / 6.f, .138196601f};
+    constexpr f32 scales [5]{.0f, .0f, 99.2f, 76.0638046f, 62.7976337f};
+    constexpr f32 skew  {skews[D]};
+    constexpr f32 unskew{unskews[D]};
+
+    const V zero{constant<V>(.0f)}, one{constant<V>(1.f)};
+
+    V sum{zero};
+    for (size_t d{0u}; d < D; ++d)
+        sum = add(sum, p[d]);
+
+    const V skewed{mul(sum, constant<V>(skew))};
+
+    V      base[D], origin[D];
+    Key<V> cell[D];
+    V      baseSum{zero};
+    for (size_t d{0u}; d < D; ++d)
+    {
+        base[d] = floor(add(p[d], skewed));
+        cell[d] = keyMul(toKey(base[d]), axisKeys[d]);
+        baseSum = add(baseSum, base[d]);
+    }
+
+    const V unskewed{mul(baseSum, constant<V>(unskew))};
+
+    for (size_t d{0u}; d < D; ++d)
+        origin[d] = add(sub(p[d], base[d]), unskewed);
+
+    // rank[d] counts the coordinates smaller than origin[d]
+    V rank[D];
+    for (size_t d{0u}; d < D; ++d)
+        rank[d] = zero;
+
+    for (size_t d{0u}; d < D; ++d)
+    {
+        for (size_t e{d + 1u}; e < D; ++e)
+        {
+            const auto greater{lessThan(origin[e], origin[d])};
+            rank[d] = add(rank[d], select(greater, one, zero));
+            rank[e] = add(rank[e], select(greater, zero, one));
+        }
+    }
+
+    V res{zero};
+    V slope[D];
+    for (size_t d{0u}; d < D; ++d)
+        slope[d] = zero;
+
+    for (size_t k{0u}; k <= D; ++k)
+    {
+        // Corner k moves by one along the k largest coordinates
+        V      x[D];
+        V      sqrLength{zero};
+        Key<V> key      {keyConstant<V>(seed)};
+
+        for (size_t d{0u}; d < D; ++d)
+        {
+            if (k == 0u)
+            {
+                x[d] = origin[d];
+                key  = keyXor(key, cell[d]);
+            }
+            else
+            {
+                const auto moved{lessEqual(constant<V>(static_cast<f32>(D - k)), rank[d])};
+                x[d] = add(sub(origin[d], select(moved, one, zero)), constant<V>(static_cast<f32>(k) * unskew));
+                key  = keyXor(key, keyAdd(cell[d], keyIf(moved, axisKeys[d])));
+            }
+
+            sqrLength = mulAdd(x[d], x[d], sqrLength);
+        }
+
+        V g[D];
+        gradient<D>(hashKey(key), g);
+
+        V ramp{zero};
+        for (size_t d{0u}; d < D; ++d)
+            ramp = mulAdd(g[d], x[d], ramp);
+
+        const V falloff {max(sub(constant<V>(.5f), sqrLength), zero)};
+        const V falloff2{mul(falloff, falloff)};
+        const V falloff4{mul(falloff2, falloff2)};
+
+        res = mulAdd(falloff4, ramp, res);
+
+        // d/dx (f^4 ramp) = f^4 g - 8 f^3 ramp x
+        if constexpr (Gradient)
+        {
+            const V factor{mul(constant<V>(-8.f), mul(mul(falloff2, falloff), ramp))};
+            for (size_t d{0u}; d < D; ++d)
+                slope[d] = mulAdd(factor, x[d], mulAdd(falloff4, g[d], slope[d]));
+        }
+    }
+
+    if constexpr (Gradient)
+    {
+        for (size_t d{0u}; d < D; ++d)
+            gradientOut[d] = mul(slope[d], constant<V>(scales[D]));
+    }
+
+    return mul(res, constant<V>(scales[D]));
+}
+
+
+template<ENoise N, size_t D, bool Gradient, typename V>
+inline V sample(const V (&p)[D], const u32 seed, V (&gradientOut)[D]) noexcept
+{
+    if constexpr (N == ENoise::Simplex)
+        return simplex<D, Gradient>(p, seed, gradientOut);
+    else
+        return lattice<N, D, Gradient>(p, seed, gradientOut);
+}
+
+
+template<ENoise N, size_t D, typename V>
+inline V fractal(const V (&p)[D], const Fractal& settings, const u32 seed) noexcept
+{
+    const V zero{constant<V>(.0f)}, one{constant<V>(1.f)};
+
+    V   res      {zero};
+    V   weight   {one};
+    f32 amplitude{1.f};
+    f32 total    {.0f};
+    f32 frequency{settings.frequency};
+
+    for (u32 octave{0u}; octave < settings.octaves; ++octave)
+    {
+        V q[D], unused[D];
+        for (size_t d{0u}; d < D; ++d)
+            q[d] = mul(p[d], constant<V>(frequency));
+
+        const V n{sample<N, D, false>(q, seedKey(octaveSeed(seed, octave)), unused)};
+
+        switch (settings.layering)
+        {
+            case ELayering::FBm:
+                res = mulAdd(n, constant<V>(amplitude), res);
+                break;
+
+            case ELayering::Billow:
+                res = mulAdd(mulAdd(abs(n), constant<V>(2.f), constant<V>(-1.f)), constant<V>(amplitude), res);
+                break;
+
+            case ELayering::Ridged:
+            {
+                const V ridge {sub(one, abs(n))};
+                const V signal{mul(mul(ridge, ridge), weight)};
+                weight = min(max(mul(signal, constant<V>(2.f)), zero), one);
+                res    = mulAdd(signal, constant<V>(amplitude), res);
+                break;
+            }
+        }
+
+        total     += amplitude;
+        amplitude *= settings.gain;
+        frequency *= settings.lacunarity;
+    }
+
+    if (!(total > .0f))
+        return zero;
+
+    // The normalization rounds, hence the clamp when all octaves peak
+    const V minusOne{constant<V>(-1.f)};
+    if (settings.layering == ELayering::Ridged)
+        return min(max(mulAdd(res, constant<V>(2.f / total), minusOne), minusOne), one);
+
+    return min(max(mul(res, constant<V>(1.f / total)), minusOne), one);
+}
+
+
+// Batched driver: points are transposed GPM_SIMD_WIDTH at a time, the tail is
+// padded with the last point
+template<size_t D, typename P, typename F>
+inline void forEachPoint(const P* in, f32* out, const size_t count, F&& kernel) noexcept
+{
+    alignas(GPM_SIMD_ALIGNMENT) f32 lanes[D][GPM_SIMD_WIDTH];
+    alignas(GPM_SIMD_ALIGNMENT) f32 res[GPM_SIMD_WIDTH];
+
+    for (size_t first{0u}; first < count; first += GPM_SIMD_WIDTH)
+    {
+        const size_t size{count - first < GPM_SIMD_WIDTH ? count - first : GPM_SIMD_WIDTH};
+
+        for (size_t lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        {
+            const P& point{in[first + (lane < size ? lane : size - 1u)]};
+
+            if constexpr (std::is_same_v<P, f32>)
+                lanes[0][lane] = point;
+            else
+                for (size_t d{0u}; d < D; ++d)
+                    lanes[d][lane] = point.e[d];
+        }
+
+        SIMD::f32v p[D];
+        for (size_t d{0u}; d < D; ++d)
+            p[d] = SIMD::load(lanes[d]);
+
+        SIMD::store(res, kernel(p));
+
+        for (size_t lane{0u}; lane < size; ++lane)
+            out[first + lane] = res[lane];
+    }
+}
+
+
+// Scalar entry point, with the gradient written to gradientOut when it is not null
+template<ENoise N, size_t D>
+inline f32 evaluate(const f32 (&p)[D], f32* gradientOut, const u32 seed) noexcept
+{
+    f32 g[D];
+    if (!gradientOut)
+        return sample<N, D, false>(p, seedKey(seed), g);
+
+    const f32 res{sample<N, D, true>(p, seedKey(seed), g)};
+    for (size_t d{0u}; d < D; ++d)
+        gradientOut[d] = g[d];
+
+    return res;
+}
+
+
+template<ENoise N, size_t D, typename P>
+inline void evaluate(const P* in, f32* out, const size_t count, const u32 seed) noexcept
+{
+    const u32 key{seedKey(seed)};
+
+    forEachPoint<D>(in, out, count, [&](const SIMD::f32v (&p)[D])
+    {
+        SIMD::f32v unused[D];
+        return sample<N, D, false>(p, key, unused);
+    });
+}
+
+
+template<ENoise N, size_t D, typename P>
+inline void fractal(const P* in, f32* out, const size_t count, const Fractal& settings, const u32 seed) noexcept
+{
+    forEachPoint<D>(in, out, count, [&](const SIMD::f32v (&p)[D])
+    {
+        return fractal<N, D>(p, settings, seed);
+    });
+}
+
+} // End of namespace Noise::Kernel
+
+
+
+
+/* =================== Scalar evaluation =================== */
+template<ENoise N>
+inline f32 Noise::evaluate(const f32 x, const u32 seed) noexcept
+{
+    static_assert(N != ENoise::Simplex, "Simplex noise is defined in 2 to 4 dimensions");
+    const f32 p[1]{x};
+    return Kernel::evaluate<N, 1u>(p, nullptr, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec2& p, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 2u>(p.e, nullptr, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec3& p, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 3u>(p.e, nullptr, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec4& p, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 4u>(p.e, nullptr, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const f32 x, f32& derivative, const u32 seed) noexcept
+{
+    static_assert(N != ENoise::Simplex, "Simplex noise is defined in 2 to 4 dimensions");
+    const f32 p[1]{x};
+    return Kernel::evaluate<N, 1u>(p, &derivative, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec2& p, Vec2& gradient, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 2u>(p.e, gradient.e, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec3& p, Vec3& gradient, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 3u>(p.e, gradient.e, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::evaluate(const Vec4& p, Vec4& gradient, const u32 seed) noexcept
+{
+    return Kernel::evaluate<N, 4u>(p.e, gradient.e, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::fractal(const f32 x, const Fractal& settings, const u32 seed) noexcept
+{
+    static_assert(N != ENoise::Simplex, "Simplex noise is defined in 2 to 4 dimensions");
+    const f32 p[1]{x};
+    return Kernel::fractal<N, 1u>(p, settings, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::fractal(const Vec2& p, const Fractal& settings, const u32 seed) noexcept
+{
+    return Kernel::fractal<N, 2u>(p.e, settings, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::fractal(const Vec3& p, const Fractal& settings, const u32 seed) noexcept
+{
+    return Kernel::fractal<N, 3u>(p.e, settings, seed);
+}
+
+
+template<ENoise N>
+inline f32 Noise::fractal(const Vec4& p, const Fractal& settings, const u32 seed) noexcept
+{
+    return Kernel::fractal<N, 4u>(p.e, settings, seed);
+}
+
+
+
+
+/* =================== Batched evaluation =================== */
+template<ENoise N>
+inline void Noise::evaluate(const f32* in, f32* out, const size_t count, const u32 seed) noexcept
+{
+    static_assert(N != ENoise::Simplex, "Simplex noise is defined in 2 to 4 dimensions");
+    Kernel::evaluate<N, 1u>(in, out, count, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::evaluate(const Vec2* in, f32* out, const size_t count, const u32 seed) noexcept
+{
+    Kernel::evaluate<N, 2u>(in, out, count, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::evaluate(const Vec3* in, f32* out, const size_t count, const u32 seed) noexcept
+{
+    Kernel::evaluate<N, 3u>(in, out, count, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::evaluate(const Vec4* in, f32* out, const size_t count, const u32 seed) noexcept
+{
+    Kernel::evaluate<N, 4u>(in, out, count, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::fractal(const f32* in, f32* out, const size_t count, const Fractal& settings, const u32 seed) noexcept
+{
+    static_assert(N != ENoise::Simplex, "Simplex noise is defined in 2 to 4 dimensions");
+    Kernel::fractal<N, 1u>(in, out, count, settings, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::fractal(const Vec2* in, f32* out, const size_t count, const Fractal& settings, const u32 seed) noexcept
+{
+    Kernel::fractal<N, 2u>(in, out, count, settings, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::fractal(const Vec3* in, f32* out, const size_t count, const Fractal& settings, const u32 seed) noexcept
+{
+    Kernel::fractal<N, 3u>(in, out, count, settings, seed);
+}
+
+
+template<ENoise N>
+inline void Noise::fractal(const Vec4* in, f32* out, const size_t count, const Fractal& settings, const u32 seed) noexcept
+{
+    Kernel::fractal<N, 4u>(in, out, count, settings, seed);
+}
+
+
+// Rows are generated in registers: x advances by GPM_SIMD_WIDTH steps, y is constant
+template<ENoise N>
+inline void Noise::fractalGrid(const Vec2& origin, const Vec2& step, const u32 width, const u32 height,
+                               f32* out, const Fractal& settings, const u32 seed) noexcept
+{
+    alignas(GPM_SIMD_ALIGNMENT) f32 ramp[GPM_SIMD_WIDTH];
+    alignas(GPM_SIMD_ALIGNMENT) f32 res [GPM_SIMD_WIDTH];
+
+    for (u32 lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        ramp[lane] = static_cast<f32>(lane) * step.x;
+
+    const SIMD::f32v offsets{SIMD::load(ramp)};
+
+    for (u32 y{0u}; y < height; ++y)
+    {
+        f32* row{out + static_cast<size_t>(y) * width};
+
+        const SIMD::f32v py{SIMD::set1(origin.y + static_cast<f32>(y) * step.y)};
+
+        for (u32 x{0u}; x < width; x += GPM_SIMD_WIDTH)
+        {
+            const SIMD::f32v p[2]{SIMD::add(SIMD::set1(origin.x + static_cast<f32>(x) * step.x), offsets), py};
+            const SIMD::f32v n{Kernel::fractal<N, 2u>(p, settings, seed)};
+
+            if (x + GPM_SIMD_WIDTH <= width)
+            {
+                SIMD::storeu(row + x, n);
+            }
+            else
+            {
+                SIMD::store(res, n);
+                for (u32 lane{0u}; x + lane < width; ++lane)
+                    row[x + lane] = res[lane];
+            }
+        }
+    }
+}
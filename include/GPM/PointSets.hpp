@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Random.hpp"
+
+namespace GPM::Random
+{
+
+/* =================== Poisson-disk and blue noise =================== */
+// Poisson-disk point sets (Bridson 2007): no two points closer than radius, and no
+// room left for another one after attempts failed candidates around every point.
+// A background grid of cells of size radius / sqrt(dimension) holds at most one
+// point each, so the generation runs in time linear in the point count.
+// Points are appended to out, in the box [min, max].
+void poissonDisk    (const Vec2& min, const Vec2& max, const f32 radius,
+                     std::vector<Vec2>& out,
+                     Generator& generator = defaultGenerator(),
+                     const u32 attempts = 30u);
+void poissonDisk    (const Vec3& min, const Vec3& max, const f32 radius,
+                     std::vector<Vec3>& out,
+                     Generator& generator = defaultGenerator(),
+                     const u32 attempts = 30u);
+
+// Blue-noise tile over [0, 1)^2: a Poisson-disk set whose distances wrap around
+// the edges, so copies placed side by side keep the minimum distance across seams.
+// Typical tiles are generated once and scaled, e.g. for vegetation scattering.
+void blueNoiseTile  (const f32 radius, std::vector<Vec2>& out,
+                     Generator& generator = defaultGenerator(),
+                     const u32 attempts = 30u);
+
+
+/* =================== Stratified =================== */
+// One jittered point per cell of an nx * ny (* nz) grid over [0, 1)^2 (or ^3),
+// out receives nx * ny (* nz) points, x varying fastest
+void stratified     (Vec2* out, const u32 nx, const u32 ny,
+                     Generator& generator = defaultGenerator())                 noexcept;
+void stratified     (Vec3* out, const u32 nx, const u32 ny, const u32 nz,
+                     Generator& generator = defaultGenerator())                 noexcept;
+
+
+/* =================== Low-discrepancy sequences =================== */
+// Points first to first + count - 1 of deterministic sequences over [0, 1)^2 (or ^3),
+// that fill the square more evenly than random points: estimates converge in about
+// O(1 / N) instead of O(1 / sqrt(N)) for smooth integrands such as AO or soft shadows.
+// Any prefix of them is well spread, so the sample count can change progressively.
+
+// Halton: radical inverses in bases 2, 3 (and 5)
+void halton         (Vec2* out, const size_t count, const u32 first = 0u)       noexcept;
+void halton         (Vec3* out, const size_t count, const u32 first = 0u)       noexcept;
+
+// Sobol, with the direction numbers of Joe and Kuo: the first 2^m points form a
+// (0, m, 2)-net in 2D. A non-zero seed applies a random digital shift (XOR) per
+// dimension, which keeps these properties and decorrelates several sets, e.g. per pixel.
+void sobol          (Vec2* out, const size_t count, const u32 first = 0u,
+                     const u32 seed = 0u)                                       noexcept;
+void sobol          (Vec3* out, const size_t count, const u32 first = 0u,
+                     const u32 seed = 0u)                                       noexcept;
+
+// R2 / R3 additive recurrences (Roberts 2018): frac(1/2 + n * alpha) where alpha
+// holds the powers of 1 / phi_d, phi_d the generalized golden ratio. The cheapest
+// of the three, with no visible structure in any dimension pair.
+void roberts        (Vec2* out, const size_t count, const u32 first = 0u)       noexcept;
+void roberts        (Vec3* out, const size_t count, const u32 first = 0u)       noexcept;
+
+#include "PointSets.inl"
+
+} // End of namespace GPM::Random
@@ -0,0 +1,519 @@
+/* =================== Helpers =================== */
+namespace PointSetsDetail
+{
+
+// Largest float below 1
+constexpr f32 oneMinusEpsilon{0x1.fffffep-1f};
+
+inline f32 toUnitFloat(const u32 bits) noexcept
+{
+    return static_cast<f32>(bits >> 8u) * 0x1.0p-24f;
+}
+
+
+inline f32 toUnitFloat(const u64 bits) noexcept
+{
+    return static_cast<f32>(bits >> 40u) * 0x1.0p-24f;
+}
+
+
+inline u32 reverseBits(u32 x) noexcept
+{
+    x = ((x & 0x55555555u) << 1u) | ((x >> 1u) & 0x55555555u);
+    x = ((x & 0x33333333u) << 2u) | ((x >> 2u) & 0x33333333u);
+    x = ((x & 0x0F0F0F0Fu) << 4u) | ((x >> 4u) & 0x0F0F0F0Fu);
+    x = ((x & 0x00FF00FFu) << 8u) | ((x >> 8u) & 0x00FF00FFu);
+    return (x << 16u) | (x >> 16u);
+}
+
+
+inline f32 radicalInverse(const u32 base, u32 index) noexcept
+{
+    const f64 invBase{1.0 / base};
+    f64       digit  {invBase};
+    f64       res    {.0};
+
+    for (; index; index /= base, digit *= invBase)
+        res += static_cast<f64>(index % base) * digit;
+
+    return std::min(static_cast<f32>(res), oneMinusEpsilon);
+}
+
+
+// Sobol direction numbers: v[dim][k] = m_k << (31 - k), where m_k follows the
+// recurrence of the primitive polynomial of degree s and coefficients a.
+// Dimension 0 is the van der Corput sequence, 1 and 2 come from new-joe-kuo-6.21201.
+struct SobolDirections
+{
+    u32 v[3][32];
+};
+
+constexpr SobolDirections makeSobolDirections() noexcept
+{
+    SobolDirections res{};
+
+    constexpr u32 degrees     [3]{0u, 1u, 2u};
+    constexpr u32 coefficients[3]{0u, 0u, 1u};
+    constexpr u32 initial     [3][2]{{0u, 0u}, {1u, 0u}, {1u, 3u}};
+
+    for (u32 k{0u}; k < 32u; ++k)
+        res.v[0][k] = 1u << (31u - k);
+
+    for (u32 dim{1u}; dim < 3u; ++dim)
+    {
+        const u32 s{degrees[dim]};
+        u32       m[32]{};
+
+        for (u32 k{0u}; k < 32u; ++k)
+        {
+            if (k < s)
+            {
+                m[k] = initial[dim][k];
+            }
+            else
+            {
+                m[k] = m[k - s] ^ (m[k - s] << s);
+                for (u32 j{1u}; j < s; ++j)
+                {
+                    if ((coefficients[dim] >> (s - 1u - j)) & 1u)
+                        m[k] ^= m[k - j] << j;
+                }
+            }
+
+            res.v[dim][k] = m[k] << (31u - k);
+        }
+    }
+
+    return res;
+}
+
+constexpr SobolDirections sobolDirections{makeSobolDirections()};
+
+
+// Gray code order: point n + 1 differs from point n by the direction of the lowest
+// set bit of n + 1. out receives the dimensions values of every point, interleaved.
+inline void sobol(f32* out, const u32 dimensions, const size_t count, const u32 first, const u32 seed) noexcept
+{
+    u32 x[3]{};
+
+    // Digital shifts, hashed from the seed so that neighbouring seeds are unrelated
+    u32 hash{seed};
+    for (u32 dim{0u}; dim < dimensions; ++dim)
+    {
+        if (seed == 0u)
+            break;
+
+        hash += 0x9E3779B9u;
+        u32 z{hash};
+        z = (z ^ (z >> 16u)) * 0x85EBCA6Bu;
+        z = (z ^ (z >> 13u)) * 0xC2B2AE35u;
+        x[dim] = z ^ (z >> 16u);
+    }
+
+    const u32 gray{first ^ (first >> 1u)};
+    for (u32 bit{0u}; bit < 32u; ++bit)
+    {
+        if ((gray >> bit) & 1u)
+        {
+            for (u32 dim{0u}; dim < dimensions; ++dim)
+                x[dim] ^= sobolDirections.v[dim][bit];
+        }
+    }
+
+    u32 index{first};
+    for (size_t i{0u}; i < count; ++i)
+    {
+        for (u32 dim{0u}; dim < dimensions; ++dim)
+            out[i * dimensions + dim] = toUnitFloat(x[dim]);
+
+        u32 bit{0u};
+        for (u32 next{++index}; next && !(next & 1u); next >>= 1u)
+            ++bit;
+
+        for (u32 dim{0u}; dim < dimensions; ++dim)
+            x[dim] ^= sobolDirections.v[dim][bit & 31u];
+    }
+}
+
+
+// Bridson's algorithm in D dimensions over [0, extent). Candidates are drawn in the
+// annulus [radius, 2 radius] around a random active point, by rejection from the cube.
+// With wrap, coordinates and distances are toroidal.
+template<size_t D, typename F>
+inline void poissonDisk(const f32 (&extent)[D], const f32 radius, const bool wrap,
+                        Generator& generator, const u32 attempts, F&& emit)
+{
+    if (!(radius > .0f))
+        return;
+
+    // At most one point per cell
+    f32    cellSize[D];
+    f32    invCellSize[D];
+    s32    cells   [D];
+    s32    reach   [D];
+    size_t strides [D];
+    size_t cellCount{1u};
+
+    for (size_t d{0u}; d < D; ++d)
+    {
+        if (!(extent[d] > .0f))
+            return;
+
+        cells[d]    = std::max(1, static_cast<s32>(std::ceil(extent[d] * std::sqrt(static_cast<f32>(D)) / radius)));
+        cellSize[d] = extent[d] / static_cast<f32>(cells[d]);
+        invCellSize[d] = static_cast<f32>(cells[d]) / extent[d];
+        reach[d]    = std::min(static_cast<s32>(std::ceil(radius / cellSize[d])), cells[d]);
+        strides[d]  = cellCount;
+        cellCount  *= static_cast<size_t>(cells[d]);
+    }
+
+    const f32 sqrRadius{radius * radius};
+
+    // Neighbouring cells that may hold a point closer than radius. Most candidates
+    // are rejected, by a close point: the nearest cells are tested first.
+    std::vector<s32>       neighbours;
+    std::vector<ptrdiff_t> linearNeighbours;
+    {
+        std::vector<std::pair<f32, size_t>> order;
+        std::vector<s32>                    offsets;
+        s32                                 offset[D];
+
+        for (size_t d{0u}; d < D; ++d)
+            offset[d] = -reach[d];
+
+        for (size_t d{0u}; d < D;)
+        {
+            f32 sqrGap{.0f};
+            for (size_t k{0u}; k < D; ++k)
+            {
+                const f32 gap{static_cast<f32>(std::max(std::abs(offset[k]) - 1, 0)) * cellSize[k]};
+                sqrGap += gap * gap;
+            }
+
+            if (sqrGap < sqrRadius)
+            {
+                order.emplace_back(sqrGap, offsets.size());
+                offsets.insert(offsets.end(), offset, offset + D);
+            }
+
+            for (d = 0u; d < D && ++offset[d] > reach[d]; ++d)
+                offset[d] = -reach[d];
+        }
+
+        std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (const auto& [sqrGap, first] : order)
+        {
+            neighbours.insert(neighbours.end(), offsets.begin() + first, offsets.begin() + first + D);
+
+            ptrdiff_t linear{0};
+            for (size_t d{0u}; d < D; ++d)
+                linear += offsets[first + d] * static_cast<ptrdiff_t>(strides[d]);
+
+            linearNeighbours.push_back(linear * static_cast<ptrdiff_t>(D));
+        }
+    }
+
+    // The grid holds the coordinates of the point of every cell. Empty cells hold
+    // infinities, which are never closer than radius, so the test needs no branch.
+    std::vector<f32> grid(cellCount * D, std::numeric_limits<f32>::infinity());
+    std::vector<u32> active;
+
+    auto cellOf = [&](const f32* p, s32 (&cell)[D])
+    {
+        for (size_t d{0u}; d < D; ++d)
+            cell[d] = std::min(static_cast<s32>(p[d] * invCellSize[d]), cells[d] - 1);
+    };
+
+    auto cellIndex = [&](const s32 (&cell)[D])
+    {
+        size_t index{0u};
+        for (size_t d{D}; d-- > 0u;)
+            index = index * static_cast<size_t>(cells[d]) + static_cast<size_t>(cell[d]);
+
+        return index;
+    };
+
+    auto add = [&](const f32* p)
+    {
+        s32 cell[D];
+        cellOf(p, cell);
+
+        const size_t index{cellIndex(cell)};
+        std::copy(p, p + D, &grid[index * D]);
+        active.push_back(static_cast<u32>(index));
+        emit(p);
+    };
+
+    auto isFree = [&](const f32* p)
+    {
+        s32 cell[D];
+        cellOf(p, cell);
+
+        bool interior{!wrap};
+        for (size_t d{0u}; d < D; ++d)
+            interior = interior && cell[d] >= reach[d] && cell[d] < cells[d] - reach[d];
+
+        // Away from the borders the neighbours are at fixed offsets in the grid
+        if (interior)
+        {
+            const f32* base{&grid[cellIndex(cell) * D]};
+            for (const ptrdiff_t linear : linearNeighbours)
+            {
+                const f32* other{base + linear};
+                f32        sqrDistance{.0f};
+                for (size_t d{0u}; d < D; ++d)
+                    sqrDistance += (p[d] - other[d]) * (p[d] - other[d]);
+
+                if (sqrDistance < sqrRadius)
+                    return false;
+            }
+
+            return true;
+        }
+
+        for (size_t n{0u}; n < neighbours.size(); n += D)
+        {
+            s32  neighbour[D];
+            bool inside{true};
+
+            for (size_t d{0u}; d < D; ++d)
+            {
+                neighbour[d] = cell[d] + neighbours[n + d];
+                if (wrap)
+                    neighbour[d] = neighbour[d] < 0 ? neighbour[d] + cells[d] : (neighbour[d] >= cells[d] ? neighbour[d] - cells[d] : neighbour[d]);
+                else
+                    inside = inside && neighbour[d] >= 0 && neighbour[d] < cells[d];
+            }
+
+            if (!inside)
+                continue;
+
+            const f32* other{&grid[cellIndex(neighbour) * D]};
+            f32        sqrDistance{.0f};
+            for (size_t d{0u}; d < D; ++d)
+            {
+                f32 delta{std::abs(p[d] - other[d])};
+                if (wrap)
+                    delta = std::min(delta, extent[d] - delta);
+
+                sqrDistance += delta * delta;
+            }
+
+            if (sqrDistance < sqrRadius)
+                return false;
+        }
+
+        return true;
+    };
+
+    f32 candidate[D];
+    for (size_t d{0u}; d < D; ++d)
+        candidate[d] = std::min(generator.nextFloat() * extent[d], extent[d] * oneMinusEpsilon);
+
+    add(candidate);
+
+    while (!active.empty())
+    {
+        const u32 slot{generator.nextBelow(static_cast<u32>(active.size()))};
+        f32       center[D];
+        std::copy(&grid[active[slot] * D], &grid[active[slot] * D] + D, center);
+
+        bool found{false};
+        for (u32 attempt{0u}; attempt < attempts && !found; ++attempt)
+        {
+            f32 sqrLength;
+            do
+            {
+                sqrLength = .0f;
+                for (size_t d{0u}; d < D; ++d)
+                {
+                    candidate[d] = (generator.nextFloat() * 4.f - 2.f) * radius;
+                    sqrLength   += candidate[d] * candidate[d];
+                }
+            } while (sqrLength < sqrRadius || sqrLength > 4.f * sqrRadius);
+
+            bool inside{true};
+            for (size_t d{0u}; d < D; ++d)
+            {
+                candidate[d] += center[d];
+
+                if (wrap)
+                {
+                    candidate[d] -= std::floor(candidate[d] / extent[d]) * extent[d];
+                    candidate[d]  = std::min(candidate[d], extent[d] * oneMinusEpsilon);
+                }
+                else
+                {
+                    inside = inside && candidate[d] >= .0f && candidate[d] < extent[d];
+                }
+            }
+
+            if (inside && isFree(candidate))
+            {
+                add(candidate);
+                found = true;
+            }
+        }
+
+        // Points that failed every attempt are surrounded and leave the active list
+        if (!found)
+        {
+            active[slot] = active.back();
+            active.pop_back();
+        }
+    }
+}
+
+} // End of namespace PointSetsDetail
+
+
+
+
+/* =================== Poisson-disk and blue noise =================== */
+inline void poissonDisk(const Vec2& min, const Vec2& max, const f32 radius,
+                        std::vector<Vec2>& out, Generator& generator, const u32 attempts)
+{
+    const f32 extent[2]{max.x - min.x, max.y - min.y};
+
+    PointSetsDetail::poissonDisk(extent, radius, false, generator, attempts, [&](const f32* p)
+    {
+        out.push_back(Vec2{min.x + p[0], min.y + p[1]});
+    });
+}
+
+
+inline void poissonDisk(const Vec3& min, const Vec3& max, const f32 radius,
+                        std::vector<Vec3>& out, Generator& generator, const u32 attempts)
+{
+    const f32 extent[3]{max.x - min.x, max.y - min.y, max.z - min.z};
+
+    PointSetsDetail::poissonDisk(extent, radius, false, generator, attempts, [&](const f32* p)
+    {
+        out.push_back(Vec3{min.x + p[0], min.y + p[1], min.z + p[2]});
+    });
+}
+
+
+inline void blueNoiseTile(const f32 radius, std::vector<Vec2>& out, Generator& generator, const u32 attempts)
+{
+    const f32 extent[2]{1.f, 1.f};
+
+    PointSetsDetail::poissonDisk(extent, radius, true, generator, attempts, [&](const f32* p)
+    {
+        out.push_back(Vec2{p[0], p[1]});
+    });
+}
+
+
+
+
+/* =================== Stratified =================== */
+inline void stratified(Vec2* out, const u32 nx, const u32 ny, Generator& generator) noexcept
+{
+    const f32 invX{1.f / static_cast<f32>(nx)}, invY{1.f / static_cast<f32>(ny)};
+
+    for (u32 y{0u}; y < ny; ++y)
+    {
+        for (u32 x{0u}; x < nx; ++x)
+        {
+            *out++ = Vec2{std::min((static_cast<f32>(x) + generator.nextFloat()) * invX, PointSetsDetail::oneMinusEpsilon),
+                          std::min((static_cast<f32>(y) + generator.nextFloat()) * invY, PointSetsDetail::oneMinusEpsilon)};
+        }
+    }
+}
+
+
+inline void stratified(Vec3* out, const u32 nx, const u32 ny, const u32 nz, Generator& generator) noexcept
+{
+    const f32 invX{1.f / static_cast<f32>(nx)}, invY{1.f / static_cast<f32>(ny)}, invZ{1.f / static_cast<f32>(nz)};
+
+    for (u32 z{0u}; z < nz; ++z)
+    {
+        for (u32 y{0u}; y < ny; ++y)
+        {
+            for (u32 x{0u}; x < nx; ++x)
+            {
+                *out++ = Vec3{std::min((static_cast<f32>(x) + generator.nextFloat()) * invX, PointSetsDetail::oneMinusEpsilon),
+                              std::min((static_cast<f32>(y) + generator.nextFloat()) * invY, PointSetsDetail::oneMinusEpsilon),
+                              std::min((static_cast<f32>(z) + generator.nextFloat()) * invZ, PointSetsDetail::oneMinusEpsilon)};
+            }
+        }
+    }
+}
+
+
+
+
+/* =================== Low-discrepancy sequences =================== */
+inline void halton(Vec2* out, const size_t count, const u32 first) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const u32 index{first + static_cast<u32>(i)};
+        out[i] = Vec2{PointSetsDetail::toUnitFloat(PointSetsDetail::reverseBits(index)),
+                      PointSetsDetail::radicalInverse(3u, index)};
+    }
+}
+
+
+inline void halton(Vec3* out, const size_t count, const u32 first) noexcept
+{
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const u32 index{first + static_cast<u32>(i)};
+        out[i] = Vec3{PointSetsDetail::toUnitFloat(PointSetsDetail::reverseBits(index)),
+                      PointSetsDetail::radicalInverse(3u, index),
+                      PointSetsDetail::radicalInverse(5u, index)};
+    }
+}
+
+
+inline void sobol(Vec2* out, const size_t count, const u32 first, const u32 seed) noexcept
+{
+    f32 values[2u * 256u];
+    for (size_t done{0u}; done < count; done += 256u)
+    {
+        const size_t block{std::min<size_t>(256u, count - done)};
+        PointSetsDetail::sobol(values, 2u, block, first + static_cast<u32>(done), seed);
+
+        for (size_t i{0u}; i < block; ++i)
+            out[done + i] = Vec2{values[2u * i], values[2u * i + 1u]};
+    }
+}
+
+
+inline void sobol(Vec3* out, const size_t count, const u32 first, const u32 seed) noexcept
+{
+    f32 values[3u * 256u];
+    for (size_t done{0u}; done < count; done += 256u)
+    {
+        const size_t block{std::min<size_t>(256u, count - done)};
+        PointSetsDetail::sobol(values, 3u, block, first + static_cast<u32>(done), seed);
+
+        for (size_t i{0u}; i < block; ++i)
+            out[done + i] = Vec3{values[3u * i], values[3u * i + 1u], values[3u * i + 2u]};
+    }
+}
+
+
+// In 64-bit fixed point the recurrence is exact: frac() is the wrap-around of the sum
+inline void roberts(Vec2* out, const size_t count, const u32 first) noexcept
+{
+    constexpr u64 alpha[2]{0xC13FA9A902A6328Full, 0x91E10DA5C79E7B1Cull};
+    constexpr u64 half    {1ull << 63u};
+
+    u64 x{half + alpha[0] * first}, y{half + alpha[1] * first};
+    for (size_t i{0u}; i < count; ++i, x += alpha[0], y += alpha[1])
+        out[i] = Vec2{PointSetsDetail::toUnitFloat(x), PointSetsDetail::toUnitFloat(y)};
+}
+
+
+inline void roberts(Vec3* out, const size_t count, const u32 first) noexcept
+{
+    constexpr u64 alpha[3]{0xD1B54A32D192ED03ull, 0xABC98388FB8FAC02ull, 0x8CB92BA72F3D8DD7ull};
+    constexpr u64 half    {1ull << 63u};
+
+    u64 x{half + alpha[0] * first}, y{half + alpha[1] * first}, z{half + alpha[2] * first};
+    for (size_t i{0u}; i < count; ++i, x += alpha[0], y += alpha[1], z += alpha[2])
+        out[i] = Vec3{PointSetsDetail::toUnitFloat(x), PointSetsDetail::toUnitFloat(y), PointSetsDetail::toUnitFloat(z)};
+}
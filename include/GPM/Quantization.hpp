@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "Matrix4.hpp"
+#include "SIMD.hpp"
+
+namespace GPM
+{
+
+// Compressed formats for streaming and storage.
+// - PackedQuat32 / PackedQuat48: "smallest three" quaternions. The largest
+//   component is dropped and rebuilt from the unit length, the other three are
+//   stored on 10 (resp. 15) bits in [-1/sqrt(2), 1/sqrt(2)]. The rebuilt one
+//   sums the errors of the others: max error per component 2.1e-3 (resp. 6.5e-5),
+//   reached when the four components are close to +-1/2
+// - PackedVec3Half: IEEE 754 half-precision floats, rounded to nearest even,
+//   NaNs become quiet NaNs without payload
+// - PackedVec3Fixed: 16-bit fixed point inside a [min, max] box
+// - PackedNormal: octahedral encoding of unit vectors on 2 x 16 bits, max error 7e-5 rad
+
+struct PackedQuat32
+{
+    // Bits 30-31: index of the dropped component, then 3 x 10 bits
+    u32 bits;
+};
+
+struct PackedQuat48
+{
+    // 3 x 15 bits, the index of the dropped component is in the top bits of e[0] and e[1]
+    u16 e[3];
+};
+
+struct PackedVec3Half
+{
+    u16 e[3];
+};
+
+struct PackedVec3Fixed
+{
+    u16 e[3];
+};
+
+struct PackedNormal
+{
+    s16 x;
+    s16 y;
+};
+
+// Single values. Quaternions are assumed normalized, normals non-zero.
+u16             toHalf          (const f32 f)                               noexcept;
+f32             fromHalf        (const u16 h)                               noexcept;
+
+PackedQuat32    toPackedQuat32  (const Quat& q)                             noexcept;
+PackedQuat48    toPackedQuat48  (const Quat& q)                             noexcept;
+PackedVec3Half  toPackedVec3Half(const Vec3& v)                             noexcept;
+PackedVec3Fixed toPackedVec3Fixed(const Vec3& v,
+                                  const Vec3& min, const Vec3& max)         noexcept;
+PackedNormal    toPackedNormal  (const Vec3& n)                             noexcept;
+
+Quat            toQuaternion    (const PackedQuat32& p)                     noexcept;
+Quat            toQuaternion    (const PackedQuat48& p)                     noexcept;
+Vec3            toVector3       (const PackedVec3Half& p)                   noexcept;
+Vec3            toVector3       (const PackedVec3Fixed& p,
+                                 const Vec3& min, const Vec3& max)          noexcept;
+Vec3            toVector3       (const PackedNormal& p)                     noexcept;
+
+// Batched versions, 4 elements per iteration when SSE is enabled
+void pack   (const Quat* in, PackedQuat32* out, const size_t count)         noexcept;
+void pack   (const Quat* in, PackedQuat48* out, const size_t count)         noexcept;
+void pack   (const Vec3* in, PackedVec3Half* out, const size_t count)       noexcept;
+void pack   (const Vec3* in, PackedVec3Fixed* out, const size_t count,
+             const Vec3& min, const Vec3& max)                              noexcept;
+void pack   (const Vec3* in, PackedNormal* out, const size_t count)         noexcept;
+
+void unpack (const PackedQuat32* in, Quat* out, const size_t count)         noexcept;
+void unpack (const PackedQuat48* in, Quat* out, const size_t count)         noexcept;
+void unpack (const PackedVec3Half* in, Vec3* out, const size_t count)       noexcept;
+void unpack (const PackedVec3Fixed* in, Vec3* out, const size_t count,
+             const Vec3& min, const Vec3& max)                              noexcept;
+void unpack (const PackedNormal* in, Vec3* out, const size_t count)         noexcept;
+
+#include "Quantization.inl"
+
+} // End of namespace GPM
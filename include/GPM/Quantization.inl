@@ -0,0 +1,734 @@
+/* =================== Quantization helpers =================== */
+namespace Quantize
+{
+
+// Smallest-three components are in [-1/sqrt(2), 1/sqrt(2)]
+constexpr f32 smallestThreeRange{.70710678118654752f};
+
+// Scale and offset mapping [-1/sqrt(2), 1/sqrt(2)] to [0, maxValue]
+constexpr f32 smallestThreeScale (const f32 maxValue) noexcept { return maxValue * .5f / smallestThreeRange; }
+constexpr f32 smallestThreeOffset(const f32 maxValue) noexcept { return maxValue * .5f; }
+
+// Largest component in absolute value, the first one on ties
+inline u32 largestComponent(const Quat& q) noexcept
+{
+    u32 index  {0u};
+    f32 largest{fabsf(q.e[0])};
+
+    for (u32 i{1u}; i < 4u; ++i)
+    {
+        if (fabsf(q.e[i]) > largest)
+        {
+            largest = fabsf(q.e[i]);
+            index   = i;
+        }
+    }
+
+    return index;
+}
+
+
+// Clamped to [0, maxValue] and rounded to nearest even, like _mm_cvtpd_epi32.
+// v * scale is exact in double precision: contracting it into an FMA can't
+// change the sum, so every build and the SIMD path give the same integer.
+inline u32 quantize(const f32 v, const f32 scale, const f32 offset, const f32 maxValue) noexcept
+{
+    const f64 q{static_cast<f64>(v) * static_cast<f64>(scale) + static_cast<f64>(offset)};
+
+    return static_cast<u32>(std::nearbyint(q < .0 ? .0 : (q > maxValue ? static_cast<f64>(maxValue) : q)));
+}
+
+
+// The three stored components, in the order of the quaternion, made positive
+// on the dropped one so that it can be rebuilt as a positive square root
+template<u32 Bits>
+inline void encodeSmallestThree(const Quat& q, u32& index, u32 stored[3]) noexcept
+{
+    constexpr f32 maxValue{static_cast<f32>((1u << Bits) - 1u)};
+
+    index = largestComponent(q);
+
+    const f32 sign{q.e[index] < .0f ? -1.f : 1.f};
+
+    for (u32 i{0u}, j{0u}; i < 4u; ++i)
+    {
+        if (i != index)
+            stored[j++] = quantize(q.e[i] * sign, smallestThreeScale(maxValue), smallestThreeOffset(maxValue), maxValue);
+    }
+}
+
+
+template<u32 Bits>
+inline Quat decodeSmallestThree(const u32 index, const u32 stored[3]) noexcept
+{
+    constexpr f32 maxValue{static_cast<f32>((1u << Bits) - 1u)};
+    constexpr f32 scale   {1.f / smallestThreeScale(maxValue)};
+    constexpr f32 offset  {-smallestThreeOffset(maxValue) / smallestThreeScale(maxValue)};
+
+    const f32 values[3]
+    {
+        static_cast<f32>(stored[0]) * scale + offset,
+        static_cast<f32>(stored[1]) * scale + offset,
+        static_cast<f32>(stored[2]) * scale + offset
+    };
+    const f32 sqrLength{1.f - values[0] * values[0] - values[1] * values[1] - values[2] * values[2]};
+
+    Quat q;
+    for (u32 i{0u}, j{0u}; i < 4u; ++i)
+        q.e[i] = i == index ? sqrtf(sqrLength > .0f ? sqrLength : .0f) : values[j++];
+
+    return q;
+}
+
+} // End of namespace Quantize
+
+
+
+
+/* =================== Single values =================== */
+// Bit manipulations after F. Giesen's conversions, with round to nearest even.
+// The batched versions do the same operations on 4 lanes.
+inline u16 toHalf(const f32 f) noexcept
+{
+    f32u      value{f};
+    const u32 sign {(static_cast<u32>(value.bits) >> 16u) & 0x8000u};
+    const u32 bits {static_cast<u32>(value.bits) & 0x7fffffffu};
+
+    // Too large for a half: infinity, or the quiet NaN 0x7e00 whatever the payload
+    if (bits >= (127u + 16u) << 23u)
+        return static_cast<u16>((bits > 0x7f800000u ? 0x7e00u : 0x7c00u) | sign);
+
+    // Subnormal half or zero: the float addition does the rounding
+    if (bits < (127u - 14u) << 23u)
+    {
+        f32u magic;
+        magic.bits = ((127 - 15) + (23 - 10) + 1) << 23;
+
+        value.bits = static_cast<s32>(bits);
+        value.f   += magic.f;
+
+        return static_cast<u16>(static_cast<u32>(value.bits - magic.bits) | sign);
+    }
+
+    // Normal half: rebias the exponent, and round the 13 dropped bits to nearest even
+    return static_cast<u16>(((bits + ((15u - 127u) << 23u) + 0xfffu + ((bits >> 13u) & 1u)) >> 13u) | sign);
+}
+
+
+inline f32 fromHalf(const u16 h) noexcept
+{
+    const u32 exponentMantissa{h & 0x7fffu};
+
+    // Rebias the exponent
+    u32 bits{(exponentMantissa << 13u) + ((127u - 15u) << 23u)};
+
+    if (exponentMantissa > 0x7bffu)
+    {
+        bits |= 255u << 23u;
+    }
+    else if (exponentMantissa < 0x0400u)
+    {
+        // Subnormal half: 2^-14 * (1 + m) - 2^-14 is exact, and unlike scaling
+        // a denormal float, isn't flushed to zero with DAZ
+        f32u value, magic;
+        value.bits = static_cast<s32>(bits + (1u << 23u));
+        magic.bits = (127 - 14) << 23;
+        value.f   -= magic.f;
+
+        bits = static_cast<u32>(value.bits);
+    }
+
+    f32u value;
+    value.bits = static_cast<s32>(bits | (static_cast<u32>(h & 0x8000u) << 16u));
+
+    return value.f;
+}
+
+
+inline PackedQuat32 toPackedQuat32(const Quat& q) noexcept
+{
+    u32 index, stored[3];
+    Quantize::encodeSmallestThree<10u>(q, index, stored);
+
+    return {(index << 30u) | (stored[0] << 20u) | (stored[1] << 10u) | stored[2]};
+}
+
+
+inline PackedQuat48 toPackedQuat48(const Quat& q) noexcept
+{
+    u32 index, stored[3];
+    Quantize::encodeSmallestThree<15u>(q, index, stored);
+
+    return {{static_cast<u16>(((index >> 1u) << 15u) | stored[0]),
+             static_cast<u16>(((index & 1u)  << 15u) | stored[1]),
+             static_cast<u16>(stored[2])}};
+}
+
+
+inline PackedVec3Half toPackedVec3Half(const Vec3& v) noexcept
+{
+    return {{toHalf(v.x), toHalf(v.y), toHalf(v.z)}};
+}
+
+
+inline PackedVec3Fixed toPackedVec3Fixed(const Vec3& v, const Vec3& min, const Vec3& max) noexcept
+{
+    PackedVec3Fixed p;
+
+    for (u32 i{0u}; i < 3u; ++i)
+    {
+        const f32 scale{65535.f / (max.e[i] - min.e[i])};
+        p.e[i] = static_cast<u16>(Quantize::quantize(v.e[i], scale, -min.e[i] * scale, 65535.f));
+    }
+
+    return p;
+}
+
+
+// Projection on the octahedron |x| + |y| + |z| = 1, whose lower half is folded
+// over the upper one, then unfolded on the [-1, 1] square
+inline PackedNormal toPackedNormal(const Vec3& n) noexcept
+{
+    const f32 reciprocal{1.f / (fabsf(n.x) + fabsf(n.y) + fabsf(n.z))};
+
+    f32 x{n.x * reciprocal};
+    f32 y{n.y * reciprocal};
+
+    if (n.z < .0f)
+    {
+        const f32 foldedX{copysignf(1.f - fabsf(y), x)};
+        y = copysignf(1.f - fabsf(x), y);
+        x = foldedX;
+    }
+
+    return {static_cast<s16>(static_cast<s32>(Quantize::quantize(x, 32767.f, 32767.f, 65534.f)) - 32767),
+            static_cast<s16>(static_cast<s32>(Quantize::quantize(y, 32767.f, 32767.f, 65534.f)) - 32767)};
+}
+
+
+inline Quat toQuaternion(const PackedQuat32& p) noexcept
+{
+    const u32 stored[3]{(p.bits >> 20u) & 1023u, (p.bits >> 10u) & 1023u, p.bits & 1023u};
+
+    return Quantize::decodeSmallestThree<10u>(p.bits >> 30u, stored);
+}
+
+
+inline Quat toQuaternion(const PackedQuat48& p) noexcept
+{
+    const u32 stored[3]{p.e[0] & 0x7fffu, p.e[1] & 0x7fffu, p.e[2] & 0x7fffu};
+
+    return Quantize::decodeSmallestThree<15u>(((p.e[0] >> 15u) << 1u) | (p.e[1] >> 15u), stored);
+}
+
+
+inline Vec3 toVector3(const PackedVec3Half& p) noexcept
+{
+    return {fromHalf(p.e[0]), fromHalf(p.e[1]), fromHalf(p.e[2])};
+}
+
+
+inline Vec3 toVector3(const PackedVec3Fixed& p, const Vec3& min, const Vec3& max) noexcept
+{
+    Vec3 v;
+
+    for (u32 i{0u}; i < 3u; ++i)
+        v.e[i] = static_cast<f32>(p.e[i]) * ((max.e[i] - min.e[i]) / 65535.f) + min.e[i];
+
+    return v;
+}
+
+
+inline Vec3 toVector3(const PackedNormal& p) noexcept
+{
+    f32 x{static_cast<f32>(p.x) * (1.f / 32767.f)};
+    f32 y{static_cast<f32>(p.y) * (1.f / 32767.f)};
+
+    const f32 z   {1.f - fabsf(x) - fabsf(y)};
+    const f32 fold{z < .0f ? -z : .0f};
+
+    // Unfolds the lower half of the octahedron
+    x -= copysignf(fold, x);
+    y -= copysignf(fold, y);
+
+    const f32 reciprocal{1.f / sqrtf(x * x + y * y + z * z)};
+
+    return {x * reciprocal, y * reciprocal, z * reciprocal};
+}
+
+
+
+
+/* ==================== SIMD backend ==================== */
+#ifdef GPM_USE_SSE
+namespace SIMD
+{
+
+// The codecs work on 4 lanes even when SIMD::f32v is 8 wide: AVX has no 256-bit integer operations
+inline __m128 select4(const __m128 mask, const __m128 a, const __m128 b) noexcept
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+
+inline __m128i selectInt(const __m128i mask, const __m128i a, const __m128i b) noexcept
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+
+// Low 16 bits of every 32-bit lane of a then b. _mm_packs_epi32 saturates,
+// so the lanes are sign-extended from 16 bits first.
+inline __m128i packLow16(const __m128i a, const __m128i b) noexcept
+{
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+
+// Same as toHalf(), the result being in the low 16 bits of every lane. Like
+// toHalf(), NaNs become the quiet NaN 0x7e00 with their sign: unlike the F16C
+// conversion (_mm_cvtps_ph), the top bits of the payload are not kept.
+inline __m128i toHalf4(const __m128 f) noexcept
+{
+    const __m128i bits    {_mm_and_si128(_mm_castps_si128(f), _mm_set1_epi32(0x7fffffff))};
+    const __m128i sign    {_mm_and_si128(_mm_srli_epi32(_mm_castps_si128(f), 16), _mm_set1_epi32(0x8000))};
+    const __m128i magic   {_mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23)};
+
+    const __m128i isNaN   {_mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7f800000))};
+    const __m128i special {_mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNaN, _mm_set1_epi32(0x200)))};
+
+    const __m128i subnormal{_mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(magic))), magic)};
+
+    const __m128i odd     {_mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1))};
+    const __m128i normal  {_mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(static_cast<s32>(((15u - 127u) << 23u) + 0xfffu))), odd), 13)};
+
+    const __m128i isSpecial  {_mm_cmpgt_epi32(bits, _mm_set1_epi32(((127 + 16) << 23) - 1))};
+    const __m128i isSubnormal{_mm_cmplt_epi32(bits, _mm_set1_epi32((127 - 14) << 23))};
+
+    return _mm_or_si128(selectInt(isSpecial, special, selectInt(isSubnormal, subnormal, normal)), sign);
+}
+
+
+// Same as fromHalf(), from the low 16 bits of every lane
+inline __m128 fromHalf4(const __m128i h) noexcept
+{
+    const __m128i exponentMantissa{_mm_and_si128(h, _mm_set1_epi32(0x7fff))};
+    const __m128i rebiased        {_mm_add_epi32(_mm_slli_epi32(exponentMantissa, 13), _mm_set1_epi32((127 - 15) << 23))};
+    const __m128i subnormal       {_mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(rebiased, _mm_set1_epi32(1 << 23))),
+                                                               _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23))))};
+    const __m128i isSubnormal     {_mm_cmplt_epi32(exponentMantissa, _mm_set1_epi32(0x0400))};
+    const __m128i infNaN          {_mm_and_si128(_mm_cmpgt_epi32(exponentMantissa, _mm_set1_epi32(0x7bff)),
+                                                 _mm_set1_epi32(255 << 23))};
+    const __m128i sign            {_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)};
+
+    return _mm_castsi128_ps(_mm_or_si128(selectInt(isSubnormal, subnormal, rebiased), _mm_or_si128(infNaN, sign)));
+}
+
+
+// Same as Quantize::quantize() on the 2 low lanes, the result being in the 2 low lanes
+inline __m128i quantize2(const __m128 v, const __m128 scale, const __m128 offset, const __m128 maxValue) noexcept
+{
+    const __m128d q{_mm_add_pd(_mm_mul_pd(_mm_cvtps_pd(v), _mm_cvtps_pd(scale)), _mm_cvtps_pd(offset))};
+
+    return _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(q, _mm_setzero_pd()), _mm_cvtps_pd(maxValue)));
+}
+
+
+inline __m128i quantize4(const __m128 v, const __m128 scale, const __m128 offset, const __m128 maxValue) noexcept
+{
+    return _mm_unpacklo_epi64(quantize2(v, scale, offset, maxValue),
+                              quantize2(_mm_movehl_ps(v, v),           _mm_movehl_ps(scale, scale),
+                                        _mm_movehl_ps(offset, offset), _mm_movehl_ps(maxValue, maxValue)));
+}
+
+
+// 4 quaternions: index of the dropped component and the 3 stored ones
+template<u32 Bits>
+inline void encodeSmallestThree(const Quat* in, __m128i& index, __m128i& a, __m128i& b, __m128i& c) noexcept
+{
+    constexpr f32 maxValue{static_cast<f32>((1u << Bits) - 1u)};
+
+    __m128 x{_mm_load_ps(in[0].e)}, y{_mm_load_ps(in[1].e)}, z{_mm_load_ps(in[2].e)}, w{_mm_load_ps(in[3].e)};
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    const __m128 signMask{_mm_set1_ps(-.0f)};
+
+    __m128  largest   {_mm_andnot_ps(signMask, x)};
+    __m128  largestRaw{x};
+    index = _mm_setzero_si128();
+
+    const __m128 components[3]{y, z, w};
+    for (s32 i{0}; i < 3; ++i)
+    {
+        const __m128 magnitude{_mm_andnot_ps(signMask, components[i])};
+        const __m128 greater  {_mm_cmpgt_ps(magnitude, largest)};
+
+        largest    = _mm_max_ps(magnitude, largest);
+        largestRaw = select4(greater, components[i], largestRaw);
+        index      = selectInt(_mm_castps_si128(greater), _mm_set1_epi32(i + 1), index);
+    }
+
+    const __m128 flip{_mm_and_ps(largestRaw, signMask)};
+    x = _mm_xor_ps(x, flip);
+    y = _mm_xor_ps(y, flip);
+    z = _mm_xor_ps(z, flip);
+    w = _mm_xor_ps(w, flip);
+
+    const __m128 is0  {_mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()))};
+    const __m128 is01 {_mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(2)))};
+    const __m128 is012{_mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(3)))};
+
+    const __m128 scale {_mm_set1_ps(Quantize::smallestThreeScale(maxValue))};
+    const __m128 offset{_mm_set1_ps(Quantize::smallestThreeOffset(maxValue))};
+    const __m128 vmax  {_mm_set1_ps(maxValue)};
+
+    a = quantize4(select4(is0,   y, x), scale, offset, vmax);
+    b = quantize4(select4(is01,  z, y), scale, offset, vmax);
+    c = quantize4(select4(is012, w, z), scale, offset, vmax);
+}
+
+
+template<u32 Bits>
+inline void decodeSmallestThree(const __m128i index, const __m128i a, const __m128i b, const __m128i c, Quat* out) noexcept
+{
+    constexpr f32 maxValue{static_cast<f32>((1u << Bits) - 1u)};
+
+    const __m128 scale {_mm_set1_ps(1.f / Quantize::smallestThreeScale(maxValue))};
+    const __m128 offset{_mm_set1_ps(-Quantize::smallestThreeOffset(maxValue) / Quantize::smallestThreeScale(maxValue))};
+
+    const __m128 fa{_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(a), scale), offset)};
+    const __m128 fb{_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(b), scale), offset)};
+    const __m128 fc{_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(c), scale), offset)};
+
+    const __m128 sqrLength{_mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(fa, fa)), _mm_mul_ps(fb, fb)), _mm_mul_ps(fc, fc))};
+    const __m128 largest  {_mm_sqrt_ps(_mm_max_ps(sqrLength, _mm_setzero_ps()))};
+
+    const __m128 is0{_mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()))};
+    const __m128 is1{_mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)))};
+    const __m128 is2{_mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)))};
+    const __m128 is3{_mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)))};
+
+    __m128 x{select4(is0, largest, fa)};
+    __m128 y{select4(is0, fa, select4(is1, largest, fb))};
+    __m128 z{select4(_mm_or_ps(is0, is1), fb, select4(is2, largest, fc))};
+    __m128 w{select4(is3, largest, fc)};
+
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    _mm_store_ps(out[0].e, x);
+    _mm_store_ps(out[1].e, y);
+    _mm_store_ps(out[2].e, z);
+    _mm_store_ps(out[3].e, w);
+}
+
+} // End of namespace SIMD
+#endif
+
+
+
+
+/* =================== Batched codecs =================== */
+inline void pack(const Quat* in, PackedQuat32* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    for (; i + 4u <= count; i += 4u)
+    {
+        __m128i index, a, b, c;
+        SIMD::encodeSmallestThree<10u>(in + i, index, a, b, c);
+
+        const __m128i bits{_mm_or_si128(_mm_or_si128(_mm_slli_epi32(index, 30), _mm_slli_epi32(a, 20)),
+                                        _mm_or_si128(_mm_slli_epi32(b, 10), c))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), bits);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toPackedQuat32(in[i]);
+    }
+}
+
+
+inline void pack(const Quat* in, PackedQuat48* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    alignas(16) s32 words[3][4];
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        __m128i index, a, b, c;
+        SIMD::encodeSmallestThree<15u>(in + i, index, a, b, c);
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(words[0]), _mm_or_si128(_mm_slli_epi32(_mm_srli_epi32(index, 1), 15), a));
+        _mm_store_si128(reinterpret_cast<__m128i*>(words[1]), _mm_or_si128(_mm_slli_epi32(_mm_and_si128(index, _mm_set1_epi32(1)), 15), b));
+        _mm_store_si128(reinterpret_cast<__m128i*>(words[2]), c);
+
+        for (size_t lane{0u}; lane < 4u; ++lane)
+            out[i + lane] = {{static_cast<u16>(words[0][lane]), static_cast<u16>(words[1][lane]), static_cast<u16>(words[2][lane])}};
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toPackedQuat48(in[i]);
+    }
+}
+
+
+// Arrays of Vec3 and PackedVec3Half are converted as flat arrays of components
+inline void pack(const Vec3* in, PackedVec3Half* out, const size_t count) noexcept
+{
+    const f32* src   {in->e};
+    u16*       dst   {out->e};
+    const size_t size{3u * count};
+    size_t       i   {0u};
+
+#ifdef GPM_USE_SSE
+    for (; i + 8u <= size; i += 8u)
+    {
+        const __m128i low {SIMD::toHalf4(_mm_loadu_ps(src + i))};
+        const __m128i high{SIMD::toHalf4(_mm_loadu_ps(src + i + 4u))};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), SIMD::packLow16(low, high));
+    }
+#endif
+
+    for (; i < size; ++i)
+    {
+        dst[i] = toHalf(src[i]);
+    }
+}
+
+
+// 4 Vec3 per iteration: 3 registers whose lanes are x y z x, y z x y and z x y z
+inline void pack(const Vec3* in, PackedVec3Fixed* out, const size_t count, const Vec3& min, const Vec3& max) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const Vec3   scale{65535.f / (max.x - min.x), 65535.f / (max.y - min.y), 65535.f / (max.z - min.z)};
+    const Vec3   offset{-min.x * scale.x, -min.y * scale.y, -min.z * scale.z};
+    const __m128 vmax {_mm_set1_ps(65535.f)};
+
+    const __m128 scales [3]{_mm_setr_ps(scale.x, scale.y, scale.z, scale.x),
+                            _mm_setr_ps(scale.y, scale.z, scale.x, scale.y),
+                            _mm_setr_ps(scale.z, scale.x, scale.y, scale.z)};
+    const __m128 offsets[3]{_mm_setr_ps(offset.x, offset.y, offset.z, offset.x),
+                            _mm_setr_ps(offset.y, offset.z, offset.x, offset.y),
+                            _mm_setr_ps(offset.z, offset.x, offset.y, offset.z)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const f32* src{in[i].e};
+        u16*       dst{out[i].e};
+
+        const __m128i q0{SIMD::quantize4(_mm_loadu_ps(src),      scales[0], offsets[0], vmax)};
+        const __m128i q1{SIMD::quantize4(_mm_loadu_ps(src + 4u), scales[1], offsets[1], vmax)};
+        const __m128i q2{SIMD::quantize4(_mm_loadu_ps(src + 8u), scales[2], offsets[2], vmax)};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), SIMD::packLow16(q0, q1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 8u), SIMD::packLow16(q2, q2));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toPackedVec3Fixed(in[i], min, max);
+    }
+}
+
+
+inline void pack(const Vec3* in, PackedNormal* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const __m128 signMask{_mm_set1_ps(-.0f)};
+    const __m128 one     {_mm_set1_ps(1.f)};
+    const __m128 scale   {_mm_set1_ps(32767.f)};
+    const __m128 vmax    {_mm_set1_ps(65534.f)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        __m128 x, y, z;
+        SIMD::loadTransposed(in + i, x, y, z);
+
+        const __m128 reciprocal{_mm_div_ps(one, _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)),
+                                                           _mm_andnot_ps(signMask, z)))};
+        x = _mm_mul_ps(x, reciprocal);
+        y = _mm_mul_ps(y, reciprocal);
+
+        const __m128 lower  {_mm_cmplt_ps(z, _mm_setzero_ps())};
+        const __m128 foldedX{_mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_and_ps(x, signMask))};
+        const __m128 foldedY{_mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_and_ps(y, signMask))};
+
+        x = SIMD::select4(lower, foldedX, x);
+        y = SIMD::select4(lower, foldedY, y);
+
+        const __m128i bias{_mm_set1_epi32(32767)};
+        const __m128i qx  {_mm_sub_epi32(SIMD::quantize4(x, scale, scale, vmax), bias)};
+        const __m128i qy  {_mm_sub_epi32(SIMD::quantize4(y, scale, scale, vmax), bias)};
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_or_si128(_mm_and_si128(qx, _mm_set1_epi32(0xffff)), _mm_slli_epi32(qy, 16)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toPackedNormal(in[i]);
+    }
+}
+
+
+inline void unpack(const PackedQuat32* in, Quat* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const __m128i mask{_mm_set1_epi32(1023)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const __m128i bits{_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))};
+
+        SIMD::decodeSmallestThree<10u>(_mm_srli_epi32(bits, 30),
+                                       _mm_and_si128(_mm_srli_epi32(bits, 20), mask),
+                                       _mm_and_si128(_mm_srli_epi32(bits, 10), mask),
+                                       _mm_and_si128(bits, mask), out + i);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toQuaternion(in[i]);
+    }
+}
+
+
+inline void unpack(const PackedQuat48* in, Quat* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const __m128i mask{_mm_set1_epi32(0x7fff)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const u16* words{in[i].e};
+
+        const __m128i e0{_mm_setr_epi32(words[0], words[3], words[6], words[9])};
+        const __m128i e1{_mm_setr_epi32(words[1], words[4], words[7], words[10])};
+        const __m128i e2{_mm_setr_epi32(words[2], words[5], words[8], words[11])};
+
+        const __m128i index{_mm_or_si128(_mm_slli_epi32(_mm_srli_epi32(e0, 15), 1), _mm_srli_epi32(e1, 15))};
+
+        SIMD::decodeSmallestThree<15u>(index, _mm_and_si128(e0, mask), _mm_and_si128(e1, mask), _mm_and_si128(e2, mask), out + i);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toQuaternion(in[i]);
+    }
+}
+
+
+inline void unpack(const PackedVec3Half* in, Vec3* out, const size_t count) noexcept
+{
+    const u16*   src {in->e};
+    f32*         dst {out->e};
+    const size_t size{3u * count};
+    size_t       i   {0u};
+
+#ifdef GPM_USE_SSE
+    for (; i + 8u <= size; i += 8u)
+    {
+        const __m128i h{_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))};
+
+        _mm_storeu_ps(dst + i,      SIMD::fromHalf4(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+        _mm_storeu_ps(dst + i + 4u, SIMD::fromHalf4(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+    }
+#endif
+
+    for (; i < size; ++i)
+    {
+        dst[i] = fromHalf(src[i]);
+    }
+}
+
+
+inline void unpack(const PackedVec3Fixed* in, Vec3* out, const size_t count, const Vec3& min, const Vec3& max) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const Vec3 step{(max.x - min.x) / 65535.f, (max.y - min.y) / 65535.f, (max.z - min.z) / 65535.f};
+
+    const __m128 steps[3]{_mm_setr_ps(step.x, step.y, step.z, step.x),
+                          _mm_setr_ps(step.y, step.z, step.x, step.y),
+                          _mm_setr_ps(step.z, step.x, step.y, step.z)};
+    const __m128 mins [3]{_mm_setr_ps(min.x, min.y, min.z, min.x),
+                          _mm_setr_ps(min.y, min.z, min.x, min.y),
+                          _mm_setr_ps(min.z, min.x, min.y, min.z)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const u16* src{in[i].e};
+        f32*       dst{out[i].e};
+
+        const __m128i low {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))};
+        const __m128i high{_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 8u))};
+        const __m128i q[3]{_mm_unpacklo_epi16(low, _mm_setzero_si128()),
+                           _mm_unpackhi_epi16(low, _mm_setzero_si128()),
+                           _mm_unpacklo_epi16(high, _mm_setzero_si128())};
+
+        for (size_t r{0u}; r < 3u; ++r)
+            _mm_storeu_ps(dst + 4u * r, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(q[r]), steps[r]), mins[r]));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toVector3(in[i], min, max);
+    }
+}
+
+
+inline void unpack(const PackedNormal* in, Vec3* out, const size_t count) noexcept
+{
+    size_t i{0u};
+
+#ifdef GPM_USE_SSE
+    const __m128 signMask{_mm_set1_ps(-.0f)};
+    const __m128 one     {_mm_set1_ps(1.f)};
+    const __m128 scale   {_mm_set1_ps(1.f / 32767.f)};
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const __m128i bits{_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))};
+
+        __m128 x{_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(bits, 16), 16)), scale)};
+        __m128 y{_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(bits, 16)), scale)};
+
+        const __m128 z   {_mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y))};
+        const __m128 fold{_mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps())};
+
+        x = _mm_sub_ps(x, _mm_or_ps(fold, _mm_and_ps(x, signMask)));
+        y = _mm_sub_ps(y, _mm_or_ps(fold, _mm_and_ps(y, signMask)));
+
+        const __m128 reciprocal{_mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))))};
+
+        SIMD::storeTransposed(out + i, _mm_mul_ps(x, reciprocal), _mm_mul_ps(y, reciprocal), _mm_mul_ps(z, reciprocal));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        out[i] = toVector3(in[i]);
+    }
+}
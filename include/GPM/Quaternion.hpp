@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Vector3.hpp"
 #include "constants.hpp"
 #include "Types.hpp"
+#include "SIMD.hpp"
 
 namespace GPM
 {
@@ -81,6 +84,16 @@ union alignas(16) Quaternion
 
 using Quat = Quaternion;
 
+// Batched interpolation between two arrays of quaternions, for t in [0, 1].
+// Unlike the nlerp() method, they all take the shortest path, like slerp().
+// - slerp() replaces acos and sin by polynomials: |error| < 1e-6
+// - slerpFast() is a normalized lerp with a corrected t: within 2e-3 radians of slerp()
+// - nlerp() is the normalized lerp
+// out may be the same array as from or to.
+void slerp    (const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept;
+void slerpFast(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept;
+void nlerp    (const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept;
+
 #include "Quaternion.inl"
 
 } // End of namespace GPM
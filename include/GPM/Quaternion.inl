@@ -285,4 +285,225 @@ inline constexpr Quaternion Quaternion::operator/(const f32 k) const noexcept
     const f32 reciprocal{1.f / k};
 
     return {v * reciprocal, w * reciprocal};
-}
\ No newline at end of file
+}
+
+
+
+/* =================== Batched interpolation =================== */
+// Written with the lane helpers of SIMD.hpp only, so the same code runs on
+// every backend, GPM_SIMD_WIDTH quaternions at a time.
+namespace SIMD
+{
+
+enum class EQuatBlend
+{
+    Nlerp,
+    Slerp,
+    FastSlerp
+};
+
+
+// acos(x) for x in [0, 1], |error| < 2e-8 (Abramowitz and Stegun 4.4.46)
+inline f32v acosUnit(const f32v x) noexcept
+{
+    f32v p{set1(-.0012624911f)};
+    p = mulAdd(p, x, set1( .0066700901f));
+    p = mulAdd(p, x, set1(-.0170881256f));
+    p = mulAdd(p, x, set1( .0308918810f));
+    p = mulAdd(p, x, set1(-.0501743046f));
+    p = mulAdd(p, x, set1( .0889789874f));
+    p = mulAdd(p, x, set1(-.2145988016f));
+    p = mulAdd(p, x, set1(1.5707963050f));
+
+    return mul(p, sqrt(sub(set1(1.f), x)));
+}
+
+
+// sin(x) for x in [0, PI / 2], odd Taylor series up to degree 13: |error| < 1e-9,
+// and no cancellation for small x, where slerp divides by sin(angle)
+inline f32v sinQuarterTurn(const f32v x) noexcept
+{
+    const f32v x2{mul(x, x)};
+
+    f32v p{set1(1.f / 6227020800.f)};
+    p = mulAdd(p, x2, set1(-1.f / 39916800.f));
+    p = mulAdd(p, x2, set1( 1.f / 362880.f));
+    p = mulAdd(p, x2, set1(-1.f / 5040.f));
+    p = mulAdd(p, x2, set1( 1.f / 120.f));
+    p = mulAdd(p, x2, set1(-1.f / 6.f));
+
+    return mulAdd(mul(p, x2), x, x);
+}
+
+
+// One register of quaternions: from, to and out point to the x, y, z and w
+// arrays, aligned on GPM_SIMD_ALIGNMENT
+template<EQuatBlend Blend>
+inline void blend(const f32* const from[4], const f32* const to[4], f32* const out[4], const f32v t) noexcept
+{
+    const f32v ax{load(from[0])}, ay{load(from[1])}, az{load(from[2])}, aw{load(from[3])};
+    const f32v bx{load(to[0])},   by{load(to[1])},   bz{load(to[2])},   bw{load(to[3])};
+
+    const f32v one   {set1(1.f)};
+    const f32v cosine{mulAdd(ax, bx, mulAdd(ay, by, mulAdd(az, bz, mul(aw, bw))))};
+    const f32v sign  {select(lessThan(cosine, set1(.0f)), set1(-1.f), one)};
+    const f32v d     {abs(cosine)};
+    const f32v tFrom {sub(one, t)};
+
+    f32v wa, wb;
+
+    if constexpr (Blend == EQuatBlend::Slerp)
+    {
+        // d >= 0 so angle, and every angle passed to sin, is in [0, PI / 2]
+        const f32v angle {acosUnit(min(d, one))};
+        const f32v sine  {sinQuarterTurn(angle)};
+
+        // Near-identical rotations: sin(t * angle) / sin(angle) tends to t
+        const maskv tiny {lessThan(sine, set1(1e-3f))};
+        const f32v  scale{div(one, select(tiny, one, sine))};
+
+        wa = select(tiny, tFrom, mul(sinQuarterTurn(mul(tFrom, angle)), scale));
+        wb = select(tiny, t,     mul(sinQuarterTurn(mul(t,     angle)), scale));
+    }
+    else if constexpr (Blend == EQuatBlend::FastSlerp)
+    {
+        // Polynomial correction of t fitted on the slerp curve, depending on the angle
+        const f32v half{set1(.5f)};
+        const f32v tc  {sub(t, half)};
+        const f32v a   {mulAdd(d, mulAdd(d, mulAdd(d, set1(-1.43519f), set1(3.55645f)), set1(-3.2452f)), set1(1.0904f))};
+        const f32v b   {mulAdd(d, mulAdd(d, set1(.215638f), set1(-1.06021f)), set1(.848013f))};
+        const f32v k   {mulAdd(a, mul(tc, tc), b)};
+        const f32v tFix{mulAdd(mul(mul(t, tc), sub(t, one)), k, t)};
+
+        wa = sub(one, tFix);
+        wb = tFix;
+    }
+    else
+    {
+        wa = tFrom;
+        wb = t;
+    }
+
+    wa = mul(wa, sign);
+
+    f32v x{mulAdd(ax, wa, mul(bx, wb))};
+    f32v y{mulAdd(ay, wa, mul(by, wb))};
+    f32v z{mulAdd(az, wa, mul(bz, wb))};
+    f32v w{mulAdd(aw, wa, mul(bw, wb))};
+
+    if constexpr (Blend != EQuatBlend::Slerp)
+    {
+        const f32v reciprocal{div(one, sqrt(mulAdd(x, x, mulAdd(y, y, mulAdd(z, z, mul(w, w))))))};
+
+        x = mul(x, reciprocal);
+        y = mul(y, reciprocal);
+        z = mul(z, reciprocal);
+        w = mul(w, reciprocal);
+    }
+
+    store(out[0], x);
+    store(out[1], y);
+    store(out[2], z);
+    store(out[3], w);
+}
+
+
+// Whole registers straight from the arrays, then the last count % GPM_SIMD_WIDTH
+// quaternions through a padded copy, so that every element goes through the same code
+template<EQuatBlend Blend>
+inline void blend(const f32* const from[4], const f32* const to[4], f32* const out[4],
+                  const f32 t, const size_t count) noexcept
+{
+    const f32v vt{set1(t)};
+    size_t     i {0u};
+
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+    {
+        const f32* const a[4]{from[0] + i, from[1] + i, from[2] + i, from[3] + i};
+        const f32* const b[4]{to[0] + i,   to[1] + i,   to[2] + i,   to[3] + i};
+        f32* const       o[4]{out[0] + i,  out[1] + i,  out[2] + i,  out[3] + i};
+
+        blend<Blend>(a, b, o, vt);
+    }
+
+    if (i == count)
+        return;
+
+    alignas(GPM_SIMD_ALIGNMENT) f32 buffer[3][4][GPM_SIMD_WIDTH];
+
+    for (size_t c{0u}; c < 4u; ++c)
+    {
+        for (size_t lane{0u}; lane < GPM_SIMD_WIDTH; ++lane)
+        {
+            const bool used{i + lane < count};
+            buffer[0][c][lane] = used ? from[c][i + lane] : (c == 3u ? 1.f : .0f);
+            buffer[1][c][lane] = used ? to[c][i + lane]   : (c == 3u ? 1.f : .0f);
+        }
+    }
+
+    const f32* const a[4]{buffer[0][0], buffer[0][1], buffer[0][2], buffer[0][3]};
+    const f32* const b[4]{buffer[1][0], buffer[1][1], buffer[1][2], buffer[1][3]};
+    f32* const       o[4]{buffer[2][0], buffer[2][1], buffer[2][2], buffer[2][3]};
+
+    blend<Blend>(a, b, o, vt);
+
+    for (size_t c{0u}; c < 4u; ++c)
+    {
+        for (size_t lane{0u}; i + lane < count; ++lane)
+            out[c][i + lane] = buffer[2][c][lane];
+    }
+}
+
+
+// Arrays of Quaternion are de-interleaved into aligned blocks on the stack
+template<EQuatBlend Blend>
+inline void blend(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept
+{
+    constexpr size_t blockSize{64u};
+
+    alignas(GPM_SIMD_ALIGNMENT) f32 a[4][blockSize];
+    alignas(GPM_SIMD_ALIGNMENT) f32 b[4][blockSize];
+
+    const f32* const pa[4]{a[0], a[1], a[2], a[3]};
+    const f32* const pb[4]{b[0], b[1], b[2], b[3]};
+    f32* const       po[4]{a[0], a[1], a[2], a[3]};
+
+    for (size_t first{0u}; first < count; first += blockSize)
+    {
+        const size_t size{count - first < blockSize ? count - first : blockSize};
+
+        for (size_t i{0u}; i < size; ++i)
+        {
+            for (size_t c{0u}; c < 4u; ++c)
+            {
+                a[c][i] = from[first + i].e[c];
+                b[c][i] = to[first + i].e[c];
+            }
+        }
+
+        blend<Blend>(pa, pb, po, t, size);
+
+        for (size_t i{0u}; i < size; ++i)
+            out[first + i] = {Vec3{a[0][i], a[1][i], a[2][i]}, a[3][i]};
+    }
+}
+
+} // End of namespace SIMD
+
+
+inline void slerp(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept
+{
+    SIMD::blend<SIMD::EQuatBlend::Slerp>(from, to, t, out, count);
+}
+
+
+inline void slerpFast(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept
+{
+    SIMD::blend<SIMD::EQuatBlend::FastSlerp>(from, to, t, out, count);
+}
+
+
+inline void nlerp(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) noexcept
+{
+    SIMD::blend<SIMD::EQuatBlend::Nlerp>(from, to, t, out, count);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "Quaternion.hpp"
+#include "SIMD.hpp"
+#include "SoAStorage.hpp"
+
+namespace GPM
+{
+
+// Structure-of-arrays stream of Quaternion, laid out like Vector3SoA with a
+// fourth array for w. Used for the per-bone data of animation blending.
+class QuaternionSoA : public SoAStorage<4u>
+{
+public:
+    // Constructors
+    QuaternionSoA()                                                         = default;
+    explicit QuaternionSoA(const size_t count);
+    QuaternionSoA(const Quat* values, const size_t count);
+
+    // Storage
+    f32*        x           ()                                              noexcept       { return component(0u); }
+    f32*        y           ()                                              noexcept       { return component(1u); }
+    f32*        z           ()                                              noexcept       { return component(2u); }
+    f32*        w           ()                                              noexcept       { return component(3u); }
+    const f32*  x           ()                                              const noexcept { return component(0u); }
+    const f32*  y           ()                                              const noexcept { return component(1u); }
+    const f32*  z           ()                                              const noexcept { return component(2u); }
+    const f32*  w           ()                                              const noexcept { return component(3u); }
+
+    void        resize      (const size_t count);
+    void        pushBack    (const Quat& q);
+
+    // Element access and conversion from/to arrays of Quaternion
+    Quat        get         (const size_t i)                                const noexcept;
+    void        set         (const size_t i, const Quat& q)                 noexcept;
+    void        assign      (const Quat* values, const size_t count);
+    void        copyTo      (Quat* out)                                     const noexcept;
+
+    // Batched kernels, with the same accuracy as the array versions declared
+    // in Quaternion.hpp. target must hold at least size() elements, out is
+    // resized to size() and may be this stream or target.
+    void        normalize   ()                                              noexcept;
+    void        slerp       (const QuaternionSoA& target, const f32 t,
+                             QuaternionSoA& out)                            const;
+    void        slerpFast   (const QuaternionSoA& target, const f32 t,
+                             QuaternionSoA& out)                            const;
+    void        nlerp       (const QuaternionSoA& target, const f32 t,
+                             QuaternionSoA& out)                            const;
+};
+
+using QuatSoA = QuaternionSoA;
+
+#include "QuaternionSoA.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,130 @@
+/* =================== Constructors =================== */
+inline QuaternionSoA::QuaternionSoA(const size_t count)
+{
+    resize(count);
+}
+
+
+inline QuaternionSoA::QuaternionSoA(const Quat* values, const size_t count)
+{
+    assign(values, count);
+}
+
+
+
+
+/* =================== Storage =================== */
+inline void QuaternionSoA::resize(const size_t count)
+{
+    SoAStorage::resize(count, {.0f, .0f, .0f, 1.f});
+}
+
+
+inline void QuaternionSoA::pushBack(const Quat& q)
+{
+    grow();
+    set(m_size++, q);
+}
+
+
+
+
+/* =================== Element access =================== */
+inline Quat QuaternionSoA::get(const size_t i) const noexcept
+{
+    return {Vec3{x()[i], y()[i], z()[i]}, w()[i]};
+}
+
+
+inline void QuaternionSoA::set(const size_t i, const Quat& q) noexcept
+{
+    x()[i] = q.x;
+    y()[i] = q.y;
+    z()[i] = q.z;
+    w()[i] = q.w;
+}
+
+
+inline void QuaternionSoA::assign(const Quat* values, const size_t count)
+{
+    m_size = 0u;
+    reserve(count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        set(i, values[i]);
+    }
+
+    m_size = count;
+}
+
+
+inline void QuaternionSoA::copyTo(Quat* out) const noexcept
+{
+    for (size_t i{0u}; i < m_size; ++i)
+    {
+        out[i] = get(i);
+    }
+}
+
+
+
+
+/* =================== Batched kernels =================== */
+inline void QuaternionSoA::normalize() noexcept
+{
+    const SIMD::f32v one{SIMD::set1(1.f)};
+    size_t           i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v qx{SIMD::load(x() + i)}, qy{SIMD::load(y() + i)}, qz{SIMD::load(z() + i)}, qw{SIMD::load(w() + i)};
+        const SIMD::f32v reciprocal{SIMD::div(one, SIMD::sqrt(SIMD::mulAdd(qx, qx, SIMD::mulAdd(qy, qy, SIMD::mulAdd(qz, qz, SIMD::mul(qw, qw))))))};
+
+        SIMD::store(x() + i, SIMD::mul(qx, reciprocal));
+        SIMD::store(y() + i, SIMD::mul(qy, reciprocal));
+        SIMD::store(z() + i, SIMD::mul(qz, reciprocal));
+        SIMD::store(w() + i, SIMD::mul(qw, reciprocal));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        set(i, get(i).normalized());
+    }
+}
+
+
+inline void QuaternionSoA::slerp(const QuaternionSoA& target, const f32 t, QuaternionSoA& out) const
+{
+    out.resize(m_size);
+
+    const f32* const from[4]{x(), y(), z(), w()};
+    const f32* const to[4]  {target.x(), target.y(), target.z(), target.w()};
+    f32* const       res[4] {out.x(), out.y(), out.z(), out.w()};
+
+    SIMD::blend<SIMD::EQuatBlend::Slerp>(from, to, res, t, m_size);
+}
+
+
+inline void QuaternionSoA::slerpFast(const QuaternionSoA& target, const f32 t, QuaternionSoA& out) const
+{
+    out.resize(m_size);
+
+    const f32* const from[4]{x(), y(), z(), w()};
+    const f32* const to[4]  {target.x(), target.y(), target.z(), target.w()};
+    f32* const       res[4] {out.x(), out.y(), out.z(), out.w()};
+
+    SIMD::blend<SIMD::EQuatBlend::FastSlerp>(from, to, res, t, m_size);
+}
+
+
+inline void QuaternionSoA::nlerp(const QuaternionSoA& target, const f32 t, QuaternionSoA& out) const
+{
+    out.resize(m_size);
+
+    const f32* const from[4]{x(), y(), z(), w()};
+    const f32* const to[4]  {target.x(), target.y(), target.z(), target.w()};
+    f32* const       res[4] {out.x(), out.y(), out.z(), out.w()};
+
+    SIMD::blend<SIMD::EQuatBlend::Nlerp>(from, to, res, t, m_size);
+}
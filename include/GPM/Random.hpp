@@ -7,35 +7,189 @@
 #pragma once
 
 #include <cstdlib>
+#include <cstddef>
 #include <type_traits>
 
+#include "Types.hpp"
 #include "Vector2.hpp"
 #include "Vector3.hpp"
 
 //in inl
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <time.h>
 #include <cmath>
 
 #include "Constants.hpp"
+#include "SIMD.hpp"
 
 namespace GPM::Random
 {
 
 /**
- * @brief Init random seed with the current time
+ * @brief Pseudo-random number generator, to be owned by one thread or one system:
+ * it holds no lock and no global state.
+ * Scalar values come from PCG32 (PCG-XSH-RR, 64-bit state), bulk fills from 8
+ * interleaved xoshiro128+ streams seeded by it. Both are reproducible: a given
+ * seed and stream give the same values on every platform and SIMD backend,
+ * floats included, whether or not the compiler contracts into FMAs.
+ */
+class Generator
+{
+private:
+    static constexpr u32 fillLanes{8u};
+
+    u64 m_state;
+    u64 m_increment;
+    u64 m_stream;
+
+    // xoshiro128+ states of the bulk fills, m_lanes[word][lane]
+    alignas(16) u32 m_lanes[4][fillLanes];
+
+    // Runs blocks steps of the 8 streams, out receives the raw bits for u32
+    // and (bits >> 8) * scale + offset for f32
+    template<typename T>
+    void generate   (T* out, const size_t blocks,
+                     const f64 scale, const f64 offset)                 noexcept;
+    template<typename T>
+    void fillImpl   (T* out, const size_t count,
+                     const f64 scale, const f64 offset)                 noexcept;
+
+public:
+    static constexpr u64 defaultSeed  {0x853C49E6748FEA9Bull};
+    static constexpr u64 defaultStream{0xDA3E39CB94B95BDBull};
+
+    explicit Generator(const u64 seed = defaultSeed, const u64 stream = defaultStream) noexcept;
+
+    /**
+     * @brief Restart the generator. Generators with different streams give
+     * independent sequences for the same seed.
+     */
+    void seed       (const u64 seed, const u64 stream = defaultStream)  noexcept;
+
+    /**
+     * @brief Stream given to the last seed()
+     */
+    u64  stream     ()                                                  const noexcept { return m_stream; }
+
+    /**
+     * @brief 32 uniformly distributed bits
+     */
+    u32  next       ()                                                  noexcept;
+
+    /**
+     * @brief Unbiased integer in [0, bound), bound must not be 0
+     */
+    u32  nextBelow  (const u32 bound)                                   noexcept;
+
+    /**
+     * @brief Float in [0, 1), 24 random bits
+     */
+    f32  nextFloat  ()                                                  noexcept;
+
+    /**
+     * @brief Double in [0, 1), 53 random bits
+     */
+    f64  nextDouble ()                                                  noexcept;
+
+    /**
+     * @brief Bulk versions, 8 values per step. Floats are in [0, 1), or [min, max).
+     * Values left over by a count that isn't a multiple of 8 are discarded, so the
+     * sequence depends on how the calls are split, not on the SIMD backend.
+     * Floats in [min, max) may round to max when max - min is large.
+     */
+    void fill       (u32* out, const size_t count)                      noexcept;
+    void fill       (f32* out, const size_t count)                      noexcept;
+    void fill       (f32* out, const size_t count,
+                     const f32 min, const f32 max)                      noexcept;
+};
+
+/**
+ * @brief Counter-based generator (Philox4x32-10, Salmon et al. 2011): value i of
+ * the sequence is a function of (seed, stream, i) only, computed in O(1) without
+ * any state. Parallel loops that draw element i for item i get the same numbers
+ * whatever the thread count or the chunking, e.g. with JobSystem::parallelFor:
+ *
+ *     const Random::Philox noise{worldSeed, chunkId};
+ *     jobs.parallelFor(count, 4096u, [&](u32 begin, u32 end)
+ *     {
+ *         noise.fill(begin, values + begin, end - begin);
+ *     });
+ */
+class Philox
+{
+private:
+    u32 m_key[2];
+    u32 m_stream[2];
+    u64 m_position{0u};
+
+    template<typename T>
+    void fillImpl   (const u64 first, T* out, const size_t count,
+                     const f64 scale, const f64 offset)                 const noexcept;
+
+public:
+    explicit Philox(const u64 seed = 0u, const u64 stream = 0u)         noexcept;
+
+    /**
+     * @brief The 4 values of block index, i.e. values 4 * index to 4 * index + 3
+     */
+    void block      (const u64 index, u32 out[4])                       const noexcept;
+
+    /**
+     * @brief Value index of the sequence, as 32 bits or a float in [0, 1)
+     */
+    u32  at         (const u64 index)                                   const noexcept;
+    f32  floatAt    (const u64 index)                                   const noexcept;
+
+    /**
+     * @brief Values first to first + count - 1 of the sequence, 16 per step with SSE.
+     * Floats are in [0, 1), or [min, max), converted as by Generator::fill() and
+     * just as reproducible.
+     */
+    void fill       (const u64 first, u32* out, const size_t count)     const noexcept;
+    void fill       (const u64 first, f32* out, const size_t count)     const noexcept;
+    void fill       (const u64 first, f32* out, const size_t count,
+                     const f32 min, const f32 max)                      const noexcept;
+
+    /**
+     * @brief Sequential use: next() returns the value at the current position
+     * and advances it, seek() moves it anywhere in O(1)
+     */
+    void seek       (const u64 index)                                   noexcept { m_position = index; }
+    u64  position   ()                                                  const noexcept { return m_position; }
+    u32  next       ()                                                  noexcept { return at(m_position++); }
+    f32  nextFloat  ()                                                  noexcept { return floatAt(m_position++); }
+};
+
+/**
+ * @brief Generator used by the free functions below. Each thread has its own,
+ * seeded with defaultSeed and a stream unique to the thread.
+ */
+inline Generator& defaultGenerator() noexcept;
+
+/**
+ * @brief Init the random seed of the calling thread with the current time.
+ * The thread keeps its stream, so threads seeded alike still differ.
  * 
  */
 inline void initSeed();
 
 /**
- * @brief Initialize random number generator
+ * @brief Initialize the random number generator of the calling thread, keeping its stream
  * 
  * @param seed The pseudo-random number generator is initialized using the argument passed as seed.
  */
 inline void initSeed(const u32 seed);
 
+/**
+ * @brief Fill out with count numbers from 0.0 to 1.0, exclusive, or from min to max, exclusive
+ * 
+ */
+inline void fill(f32* out, const size_t count);
+
+inline void fill(f32* out, const size_t count, const f32 min, const f32 max);
+
 /**
  * @brief This will generate a number from 0.0 to 1.0, inclusive.
  * 
@@ -1,83 +1,564 @@
+/* =================== Float conversion =================== */
+namespace FloatConversion
+{
+
+// (bits >> 8) * scale + offset, scale being a float: the 24 x 24-bit product is
+// exact in double precision, so an FMA contraction can't change the result, and
+// every backend rounds the same sum to f32
+inline f32 toFloat(const u32 bits, const f64 scale, const f64 offset) noexcept
+{
+    return static_cast<f32>(static_cast<f64>(bits >> 8u) * scale + offset);
+}
+
+// Raw bits for u32 outputs, toFloat() for f32 ones
+inline void store(u32& out, const u32 bits, const f64, const f64) noexcept
+{
+    out = bits;
+}
+
+inline void store(f32& out, const u32 bits, const f64 scale, const f64 offset) noexcept
+{
+    out = toFloat(bits, scale, offset);
+}
+
+#if defined(GPM_USE_SSE)
+
+inline __m128 toFloat(const __m128i bits, const __m128d scale, const __m128d offset) noexcept
+{
+    const __m128i high{_mm_srli_epi32(bits, 8)};
+    const __m128d low {_mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(high), scale), offset)};
+    const __m128d up  {_mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(high, high)), scale), offset)};
+
+    return _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(up));
+}
+
+#endif
+
+} // End of namespace FloatConversion
+
+
+
+
+/* =================== Generator =================== */
+inline Generator::Generator(const u64 seed, const u64 stream) noexcept
+{
+    this->seed(seed, stream);
+}
+
+
+inline void Generator::seed(const u64 seed, const u64 stream) noexcept
+{
+    m_state     = 0u;
+    m_increment = (stream << 1u) | 1u;
+    m_stream    = stream;
+    next();
+    m_state += seed;
+    next();
+
+    // The fill streams are seeded with SplitMix64, apart from the scalar sequence
+    u64 mix{seed ^ (stream * 0x9E3779B97F4A7C15ull)};
+
+    for (u32 lane{0u}; lane < fillLanes; ++lane)
+    {
+        for (u32 word{0u}; word < 4u; word += 2u)
+        {
+            mix += 0x9E3779B97F4A7C15ull;
+
+            u64 z{mix};
+            z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27u)) * 0x94D049BB133111EBull;
+            z ^= z >> 31u;
+
+            m_lanes[word][lane]      = static_cast<u32>(z);
+            m_lanes[word + 1u][lane] = static_cast<u32>(z >> 32u);
+        }
+
+        // The all-zero state is the only one xoshiro can't leave
+        if ((m_lanes[0][lane] | m_lanes[1][lane] | m_lanes[2][lane] | m_lanes[3][lane]) == 0u)
+            m_lanes[0][lane] = 1u;
+    }
+}
+
+
+inline u32 Generator::next() noexcept
+{
+    const u64 oldState{m_state};
+    m_state = oldState * 6364136223846793005ull + m_increment;
+
+    const u32 xorShifted{static_cast<u32>(((oldState >> 18u) ^ oldState) >> 27u)};
+    const u32 rotation  {static_cast<u32>(oldState >> 59u)};
+
+    return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+}
+
+
+// Lemire's multiply-shift, rejecting the few values that would bias the result
+inline u32 Generator::nextBelow(const u32 bound) noexcept
+{
+    u64 product{static_cast<u64>(next()) * bound};
+    u32 low    {static_cast<u32>(product)};
+
+    if (low < bound)
+    {
+        const u32 threshold{(0u - bound) % bound};
+        while (low < threshold)
+        {
+            product = static_cast<u64>(next()) * bound;
+            low     = static_cast<u32>(product);
+        }
+    }
+
+    return static_cast<u32>(product >> 32u);
+}
+
+
+inline f32 Generator::nextFloat() noexcept
+{
+    return static_cast<f32>(next() >> 8u) * (1.f / 16777216.f);
+}
+
+
+inline f64 Generator::nextDouble() noexcept
+{
+    const u64 high{next() >> 5u}, low{next() >> 6u};
+    return static_cast<f64>((high << 26u) | low) * (1. / 9007199254740992.);
+}
+
+
+template<typename T>
+inline void Generator::generate(T* out, const size_t blocks, const f64 scale, const f64 offset) noexcept
+{
+#if defined(GPM_USE_SSE)
+    // Two registers of 4 streams, kept in registers for the whole fill
+    __m128i s0[2], s1[2], s2[2], s3[2];
+    for (u32 half{0u}; half < 2u; ++half)
+    {
+        s0[half] = _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[0] + 4u * half));
+        s1[half] = _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[1] + 4u * half));
+        s2[half] = _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[2] + 4u * half));
+        s3[half] = _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[3] + 4u * half));
+    }
+
+    const __m128d scaleV{_mm_set1_pd(scale)}, offsetV{_mm_set1_pd(offset)};
+
+    for (size_t block{0u}; block < blocks; ++block)
+    {
+        for (u32 half{0u}; half < 2u; ++half)
+        {
+            const __m128i result{_mm_add_epi32(s0[half], s3[half])};
+            const __m128i t     {_mm_slli_epi32(s1[half], 9)};
+
+            s2[half] = _mm_xor_si128(s2[half], s0[half]);
+            s3[half] = _mm_xor_si128(s3[half], s1[half]);
+            s1[half] = _mm_xor_si128(s1[half], s2[half]);
+            s0[half] = _mm_xor_si128(s0[half], s3[half]);
+            s2[half] = _mm_xor_si128(s2[half], t);
+            s3[half] = _mm_or_si128(_mm_slli_epi32(s3[half], 11), _mm_srli_epi32(s3[half], 21));
+
+            T* const dst{out + block * fillLanes + 4u * half};
+            if constexpr (std::is_same_v<T, u32>)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), result);
+            }
+            else
+            {
+                _mm_storeu_ps(dst, FloatConversion::toFloat(result, scaleV, offsetV));
+            }
+        }
+    }
+
+    for (u32 half{0u}; half < 2u; ++half)
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[0] + 4u * half), s0[half]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[1] + 4u * half), s1[half]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[2] + 4u * half), s2[half]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[3] + 4u * half), s3[half]);
+    }
+#else
+    for (size_t block{0u}; block < blocks; ++block)
+    {
+        for (u32 lane{0u}; lane < fillLanes; ++lane)
+        {
+            u32& s0{m_lanes[0][lane]};
+            u32& s1{m_lanes[1][lane]};
+            u32& s2{m_lanes[2][lane]};
+            u32& s3{m_lanes[3][lane]};
+
+            const u32 result{s0 + s3};
+            const u32 t     {s1 << 9u};
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = (s3 << 11u) | (s3 >> 21u);
+
+            if constexpr (std::is_same_v<T, u32>)
+                out[block * fillLanes + lane] = result;
+            else
+                out[block * fillLanes + lane] = FloatConversion::toFloat(result, scale, offset);
+        }
+    }
+#endif
+}
+
+
+template<typename T>
+inline void Generator::fillImpl(T* out, const size_t count, const f64 scale, const f64 offset) noexcept
+{
+    const size_t blocks{count / fillLanes};
+    generate(out, blocks, scale, offset);
+
+    const size_t done{blocks * fillLanes};
+    if (done == count)
+        return;
+
+    T tail[fillLanes];
+    generate(tail, 1u, scale, offset);
+
+    for (size_t i{done}; i < count; ++i)
+        out[i] = tail[i - done];
+}
+
+
+inline void Generator::fill(u32* out, const size_t count) noexcept
+{
+    fillImpl(out, count, .0, .0);
+}
+
+
+inline void Generator::fill(f32* out, const size_t count) noexcept
+{
+    fillImpl(out, count, 1. / 16777216., .0);
+}
+
+
+inline void Generator::fill(f32* out, const size_t count, const f32 min, const f32 max) noexcept
+{
+    // The step is rounded to a float, which keeps the products exact
+    fillImpl(out, count, static_cast<f64>((max - min) * (1.f / 16777216.f)), static_cast<f64>(min));
+}
+
+
+inline Generator& defaultGenerator() noexcept
+{
+    static std::atomic<u64>       nextStream{Generator::defaultStream};
+    static thread_local Generator generator{Generator::defaultSeed, nextStream.fetch_add(1u, std::memory_order_relaxed)};
+
+    return generator;
+}
+
+
+
+
+/* =================== Philox =================== */
+namespace PhiloxRounds
+{
+
+constexpr u32 m0{0xD2511F53u}, m1{0xCD9E8D57u};
+constexpr u32 w0{0x9E3779B9u}, w1{0xBB67AE85u};
+
+inline void apply(u32 c[4], u32 k0, u32 k1) noexcept
+{
+    for (u32 round{0u}; round < 10u; ++round)
+    {
+        const u64 p0{static_cast<u64>(m0) * c[0]};
+        const u64 p1{static_cast<u64>(m1) * c[2]};
+
+        const u32 next[4]
+        {
+            static_cast<u32>(p1 >> 32u) ^ c[1] ^ k0,
+            static_cast<u32>(p1),
+            static_cast<u32>(p0 >> 32u) ^ c[3] ^ k1,
+            static_cast<u32>(p0)
+        };
+
+        c[0] = next[0];
+        c[1] = next[1];
+        c[2] = next[2];
+        c[3] = next[3];
+
+        k0 += w0;
+        k1 += w1;
+    }
+}
+
+#if defined(GPM_USE_SSE)
+
+// Low and high halves of the 4 products a * m
+inline void mulHiLo(const __m128i a, const __m128i m, __m128i& hi, __m128i& lo) noexcept
+{
+    const __m128i even{_mm_mul_epu32(a, m)};
+    const __m128i odd {_mm_mul_epu32(_mm_srli_epi64(a, 32), m)};
+    const __m128i low {_mm_set_epi32(0, -1, 0, -1)};
+
+    lo = _mm_or_si128(_mm_and_si128(even, low), _mm_slli_epi64(odd, 32));
+    hi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(low, odd));
+}
+
+// 4 blocks at once, c[word] holding that word of the 4 counters
+inline void apply(__m128i c[4], u32 k0, u32 k1) noexcept
+{
+    const __m128i mul0{_mm_set1_epi32(static_cast<s32>(m0))}, mul1{_mm_set1_epi32(static_cast<s32>(m1))};
+
+    for (u32 round{0u}; round < 10u; ++round)
+    {
+        __m128i hi0, lo0, hi1, lo1;
+        mulHiLo(c[0], mul0, hi0, lo0);
+        mulHiLo(c[2], mul1, hi1, lo1);
+
+        c[0] = _mm_xor_si128(_mm_xor_si128(hi1, c[1]), _mm_set1_epi32(static_cast<s32>(k0)));
+        c[1] = lo1;
+        c[2] = _mm_xor_si128(_mm_xor_si128(hi0, c[3]), _mm_set1_epi32(static_cast<s32>(k1)));
+        c[3] = lo0;
+
+        k0 += w0;
+        k1 += w1;
+    }
+}
+
+#endif
+
+} // End of namespace PhiloxRounds
+
+
+inline Philox::Philox(const u64 seed, const u64 stream) noexcept
+    : m_key   {static_cast<u32>(seed),   static_cast<u32>(seed >> 32u)},
+      m_stream{static_cast<u32>(stream), static_cast<u32>(stream >> 32u)}
+{}
+
+
+inline void Philox::block(const u64 index, u32 out[4]) const noexcept
+{
+    out[0] = static_cast<u32>(index);
+    out[1] = static_cast<u32>(index >> 32u);
+    out[2] = m_stream[0];
+    out[3] = m_stream[1];
+
+    PhiloxRounds::apply(out, m_key[0], m_key[1]);
+}
+
+
+inline u32 Philox::at(const u64 index) const noexcept
+{
+    u32 values[4];
+    block(index >> 2u, values);
+
+    return values[index & 3u];
+}
+
+
+inline f32 Philox::floatAt(const u64 index) const noexcept
+{
+    return static_cast<f32>(at(index) >> 8u) * (1.f / 16777216.f);
+}
+
+
+template<typename T>
+inline void Philox::fillImpl(const u64 first, T* out, const size_t count,
+                             const f64 scale, const f64 offset) const noexcept
+{
+    size_t i{0u};
+
+    // Values up to the first whole block
+    for (; i < count && ((first + i) & 3u) != 0u; ++i)
+        FloatConversion::store(out[i], at(first + i), scale, offset);
+
+#if defined(GPM_USE_SSE)
+    const __m128d scaleV{_mm_set1_pd(scale)}, offsetV{_mm_set1_pd(offset)};
+
+    for (; i + 16u <= count; i += 16u)
+    {
+        const u64 index{(first + i) >> 2u};
+        __m128i   c[4]
+        {
+            _mm_add_epi32(_mm_set1_epi32(static_cast<s32>(index)), _mm_set_epi32(3, 2, 1, 0)),
+            _mm_set1_epi32(static_cast<s32>(index >> 32u)),
+            _mm_set1_epi32(static_cast<s32>(m_stream[0])),
+            _mm_set1_epi32(static_cast<s32>(m_stream[1]))
+        };
+
+        // The low word wraps in the middle of the 4 blocks: carry into the high word
+        const u32 low{static_cast<u32>(index)};
+        if (low > 0xFFFFFFFCu)
+        {
+            const __m128i carry{_mm_set_epi32(low + 3u < low, low + 2u < low, low + 1u < low, 0)};
+            c[1] = _mm_add_epi32(c[1], carry);
+        }
+
+        PhiloxRounds::apply(c, m_key[0], m_key[1]);
+
+        // Transpose from one register per word to one register per block
+        const __m128i t0{_mm_unpacklo_epi32(c[0], c[1])}, t1{_mm_unpackhi_epi32(c[0], c[1])};
+        const __m128i t2{_mm_unpacklo_epi32(c[2], c[3])}, t3{_mm_unpackhi_epi32(c[2], c[3])};
+        const __m128i blocks[4]
+        {
+            _mm_unpacklo_epi64(t0, t2), _mm_unpackhi_epi64(t0, t2),
+            _mm_unpacklo_epi64(t1, t3), _mm_unpackhi_epi64(t1, t3)
+        };
+
+        for (u32 b{0u}; b < 4u; ++b)
+        {
+            if constexpr (std::is_same_v<T, u32>)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4u * b), blocks[b]);
+            }
+            else
+            {
+                _mm_storeu_ps(out + i + 4u * b, FloatConversion::toFloat(blocks[b], scaleV, offsetV));
+            }
+        }
+    }
+#endif
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        u32 values[4];
+        block((first + i) >> 2u, values);
+
+        for (u32 w{0u}; w < 4u; ++w)
+            FloatConversion::store(out[i + w], values[w], scale, offset);
+    }
+
+    for (; i < count; ++i)
+        FloatConversion::store(out[i], at(first + i), scale, offset);
+}
+
+
+inline void Philox::fill(const u64 first, u32* out, const size_t count) const noexcept
+{
+    fillImpl(first, out, count, .0, .0);
+}
+
+
+inline void Philox::fill(const u64 first, f32* out, const size_t count) const noexcept
+{
+    fillImpl(first, out, count, 1. / 16777216., .0);
+}
+
+
+inline void Philox::fill(const u64 first, f32* out, const size_t count, const f32 min, const f32 max) const noexcept
+{
+    fillImpl(first, out, count, static_cast<f64>((max - min) * (1.f / 16777216.f)), static_cast<f64>(min));
+}
+
+
+
+
+/* =================== Free functions =================== */
 void initSeed()
 {
-    srand((u32)time(NULL));
+    Generator& generator{defaultGenerator()};
+    generator.seed(static_cast<u64>(time(NULL)), generator.stream());
 }
 
 void initSeed(const u32 seed)
 {
-    srand(seed);
+    Generator& generator{defaultGenerator()};
+    generator.seed(seed, generator.stream());
+}
+
+void fill(f32* out, const size_t count)
+{
+    defaultGenerator().fill(out, count);
+}
+
+void fill(f32* out, const size_t count, const f32 min, const f32 max)
+{
+    defaultGenerator().fill(out, count, min, max);
 }
 
 template<typename T> 
 auto unitValue() -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return static_cast<T>(rand()) / static_cast<T>(RAND_MAX);
+    // 2^24 - 1 so that 1 is included
+    if constexpr (sizeof(T) <= sizeof(f32))
+        return static_cast<T>(defaultGenerator().next() >> 8u) * static_cast<T>(1. / 16777215.);
+    else
+        return static_cast<T>(defaultGenerator().nextDouble() * (9007199254740992. / 9007199254740991.));
 } 
 
 template<typename T> 
 auto unitValue() -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return static_cast<T>(rand() & 1);
+    return static_cast<T>(defaultGenerator().next() >> 31u);
 }
 
 template<typename T>
 auto ranged(T max) -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return static_cast<T>(rand()) / (static_cast<T>(RAND_MAX / max));
+    if constexpr (sizeof(T) <= sizeof(f32))
+        return static_cast<T>(defaultGenerator().nextFloat()) * max;
+    else
+        return static_cast<T>(defaultGenerator().nextDouble()) * max;
 }
 
 template<typename T>
 auto ranged(T max) -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return static_cast<T>(rand()) % max;
+    if constexpr (sizeof(T) <= sizeof(u32))
+    {
+        return static_cast<T>(defaultGenerator().nextBelow(static_cast<u32>(max)));
+    }
+    else
+    {
+        Generator& generator{defaultGenerator()};
+        const u64  bits     {(static_cast<u64>(generator.next()) << 32u) | generator.next()};
+        return static_cast<T>(bits % static_cast<u64>(max));
+    }
 }
 
 template<typename T>
 auto ranged(T min, T max)  -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return min + static_cast<T>(rand()) / (static_cast<T>(RAND_MAX / (max - min)));
+    return min + ranged<T>(max - min);
 }
 
 template<typename T>
 auto ranged(T min, T max) -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return min + static_cast<T>(rand()) % (max - min);
+    using U = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(min) + static_cast<U>(ranged<U>(static_cast<U>(static_cast<U>(max) - static_cast<U>(min)))));
 }
 
 Vec2 circularCoordinate(const Vec2& center, float range)
 {
-    const float randValue = static_cast<float>(rand());
+    const float randValue = ranged<float>(TWO_PI);
     const float scale = unitValue<float>();
     return {center.x + range * std::cos(randValue) * scale, center.y + range * std::sin(randValue) * scale};
 }
 
 Vec2 peripheralCircularCoordinate(const Vec2& center, float range)
 {
-    const float randValue = static_cast<float>(rand());
+    const float randValue = ranged<float>(TWO_PI);
     return Vec2{center.x + range * std::cos(randValue), center.y + range * std::sin(randValue)};
 }
 
 Vec2 unitPeripheralCircularCoordinate()
 {
-    const float randValue = static_cast<float>(rand());
+    const float randValue = ranged<float>(TWO_PI);
     return Vec2{std::cos(randValue), std::sin(randValue)};
 }
 
+// z uniform in [-1, 1] gives equal areas to equal z intervals, unlike two uniform angles
+// which gather points at the poles
 Vec3 unitPeripheralSphericalCoordonate()
 {
-    const float phi   = ranged<float>(0.f, TWO_PI);
+    const float z     = ranged<float>(-1.f, 1.f);
     const float theta = ranged<float>(0.f, TWO_PI);
-    return Vec3{std::sin(phi) * std::cos(theta), std::sin(phi) * std::sin(theta), std::cos(phi)};
+    const float r     = std::sqrt(std::max(0.f, 1.f - z * z));
+    return Vec3{r * std::cos(theta), r * std::sin(theta), z};
 }
 
 Vec3 sphericalCoordinate(const Vec3& center, float range)
 {
-    return (center + unitPeripheralSphericalCoordonate()) * unitValue<float>() * range;
+    return center + unitPeripheralSphericalCoordonate() * (std::cbrt(unitValue<float>()) * range);
 }
 
 Vec3 peripheralSphericalCoordinate(const Vec3& center, float range)
 {
-    return (center + unitPeripheralSphericalCoordonate()) * range;
+    return center + unitPeripheralSphericalCoordonate() * range;
 }
 
 Vec2 peripheralSquareCoordinate(const Vec2& center, float extX, float extY)
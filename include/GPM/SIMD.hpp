@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include "types.hpp"
+
+// SIMD backend selection, done at compile time from the target flags.
+// Define GPM_NO_SIMD before including any GPM header to force the scalar code paths.
+#if !defined(GPM_NO_SIMD)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define GPM_USE_SSE
+#   endif
+#   if defined(GPM_USE_SSE) && defined(__AVX__)
+#       define GPM_USE_AVX
+#   endif
+#   if defined(GPM_USE_AVX) && defined(__FMA__)
+#       define GPM_USE_FMA
+#   endif
+#endif
+
+#if defined(GPM_USE_AVX)
+#   include <immintrin.h>
+#elif defined(GPM_USE_SSE)
+#   include <emmintrin.h>
+#endif
+
+// Number of f32 lanes of SIMD::f32v, processed per iteration by the batched kernels
+#if defined(GPM_USE_AVX)
+#   define GPM_SIMD_WIDTH 8u
+#elif defined(GPM_USE_SSE)
+#   define GPM_SIMD_WIDTH 4u
+#else
+#   define GPM_SIMD_WIDTH 1u
+#endif
+
+// Alignment (in bytes) of the buffers owned by the batched containers
+#if defined(GPM_USE_AVX)
+#   define GPM_SIMD_ALIGNMENT 32u
+#else
+#   define GPM_SIMD_ALIGNMENT 16u
+#endif
+
+// constexpr functions keep their scalar body for compile-time evaluation
+// and only branch to the SIMD backend when evaluated at run time.
+// Compilers that can't tell the two apart always stay on the scalar path.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#   define GPM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#   define GPM_IS_CONSTANT_EVALUATED() true
+#endif
+
+namespace GPM::SIMD
+{
+
+// Width-agnostic lane helpers used by the batched kernels.
+// f32v holds GPM_SIMD_WIDTH floats, maskv is the result of a lane-wise comparison.
+#if defined(GPM_USE_AVX)
+
+using f32v  = __m256;
+using maskv = __m256;
+
+inline f32v  load   (const f32* p)                                noexcept { return _mm256_load_ps(p); }
+inline f32v  loadu  (const f32* p)                                noexcept { return _mm256_loadu_ps(p); }
+inline void  store  (f32* p, const f32v v)                        noexcept { _mm256_store_ps(p, v); }
+inline void  storeu (f32* p, const f32v v)                        noexcept { _mm256_storeu_ps(p, v); }
+inline f32v  set1   (const f32 k)                                 noexcept { return _mm256_set1_ps(k); }
+inline f32v  add    (const f32v a, const f32v b)                  noexcept { return _mm256_add_ps(a, b); }
+inline f32v  sub    (const f32v a, const f32v b)                  noexcept { return _mm256_sub_ps(a, b); }
+inline f32v  mul    (const f32v a, const f32v b)                  noexcept { return _mm256_mul_ps(a, b); }
+inline f32v  div    (const f32v a, const f32v b)                  noexcept { return _mm256_div_ps(a, b); }
+inline f32v  min    (const f32v a, const f32v b)                  noexcept { return _mm256_min_ps(a, b); }
+inline f32v  max    (const f32v a, const f32v b)                  noexcept { return _mm256_max_ps(a, b); }
+inline f32v  sqrt   (const f32v a)                                noexcept { return _mm256_sqrt_ps(a); }
+inline maskv lessThan   (const f32v a, const f32v b)              noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline maskv lessEqual  (const f32v a, const f32v b)              noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+inline maskv maskAnd    (const maskv a, const maskv b)            noexcept { return _mm256_and_ps(a, b); }
+inline maskv maskOr     (const maskv a, const maskv b)            noexcept { return _mm256_or_ps(a, b); }
+inline f32v  select (const maskv m, const f32v a, const f32v b)   noexcept { return _mm256_blendv_ps(b, a, m); }
+inline u32   bits   (const maskv m)                               noexcept { return static_cast<u32>(_mm256_movemask_ps(m)); }
+inline f32v  abs    (const f32v a)                                noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-.0f), a); }
+#   ifdef GPM_USE_FMA
+inline f32v  mulAdd (const f32v a, const f32v b, const f32v c)    noexcept { return _mm256_fmadd_ps(a, b, c); }
+#   else
+inline f32v  mulAdd (const f32v a, const f32v b, const f32v c)    noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#   endif
+
+#elif defined(GPM_USE_SSE)
+
+using f32v  = __m128;
+using maskv = __m128;
+
+inline f32v  load   (const f32* p)                                noexcept { return _mm_load_ps(p); }
+inline f32v  loadu  (const f32* p)                                noexcept { return _mm_loadu_ps(p); }
+inline void  store  (f32* p, const f32v v)                        noexcept { _mm_store_ps(p, v); }
+inline void  storeu (f32* p, const f32v v)                        noexcept { _mm_storeu_ps(p, v); }
+inline f32v  set1   (const f32 k)                                 noexcept { return _mm_set1_ps(k); }
+inline f32v  add    (const f32v a, const f32v b)                  noexcept { return _mm_add_ps(a, b); }
+inline f32v  sub    (const f32v a, const f32v b)                  noexcept { return _mm_sub_ps(a, b); }
+inline f32v  mul    (const f32v a, const f32v b)                  noexcept { return _mm_mul_ps(a, b); }
+inline f32v  div    (const f32v a, const f32v b)                  noexcept { return _mm_div_ps(a, b); }
+inline f32v  min    (const f32v a, const f32v b)                  noexcept { return _mm_min_ps(a, b); }
+inline f32v  max    (const f32v a, const f32v b)                  noexcept { return _mm_max_ps(a, b); }
+inline f32v  sqrt   (const f32v a)                                noexcept { return _mm_sqrt_ps(a); }
+inline maskv lessThan   (const f32v a, const f32v b)              noexcept { return _mm_cmplt_ps(a, b); }
+inline maskv lessEqual  (const f32v a, const f32v b)              noexcept { return _mm_cmple_ps(a, b); }
+inline maskv maskAnd    (const maskv a, const maskv b)            noexcept { return _mm_and_ps(a, b); }
+inline maskv maskOr     (const maskv a, const maskv b)            noexcept { return _mm_or_ps(a, b); }
+inline f32v  select (const maskv m, const f32v a, const f32v b)   noexcept { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+inline u32   bits   (const maskv m)                               noexcept { return static_cast<u32>(_mm_movemask_ps(m)); }
+inline f32v  abs    (const f32v a)                                noexcept { return _mm_andnot_ps(_mm_set1_ps(-.0f), a); }
+inline f32v  mulAdd (const f32v a, const f32v b, const f32v c)    noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+#else
+
+using f32v  = f32;
+using maskv = bool;
+
+inline f32v  load   (const f32* p)                                noexcept { return *p; }
+inline f32v  loadu  (const f32* p)                                noexcept { return *p; }
+inline void  store  (f32* p, const f32v v)                        noexcept { *p = v; }
+inline void  storeu (f32* p, const f32v v)                        noexcept { *p = v; }
+inline f32v  set1   (const f32 k)                                 noexcept { return k; }
+inline f32v  add    (const f32v a, const f32v b)                  noexcept { return a + b; }
+inline f32v  sub    (const f32v a, const f32v b)                  noexcept { return a - b; }
+inline f32v  mul    (const f32v a, const f32v b)                  noexcept { return a * b; }
+inline f32v  div    (const f32v a, const f32v b)                  noexcept { return a / b; }
+inline f32v  min    (const f32v a, const f32v b)                  noexcept { return a < b ? a : b; }
+inline f32v  max    (const f32v a, const f32v b)                  noexcept { return a > b ? a : b; }
+inline f32v  sqrt   (const f32v a)                                noexcept { return sqrtf(a); }
+inline maskv lessThan   (const f32v a, const f32v b)              noexcept { return a < b; }
+inline maskv lessEqual  (const f32v a, const f32v b)              noexcept { return a <= b; }
+inline maskv maskAnd    (const maskv a, const maskv b)            noexcept { return a && b; }
+inline maskv maskOr     (const maskv a, const maskv b)            noexcept { return a || b; }
+inline f32v  select (const maskv m, const f32v a, const f32v b)   noexcept { return m ? a : b; }
+inline u32   bits   (const maskv m)                               noexcept { return static_cast<u32>(m); }
+inline f32v  abs    (const f32v a)                                noexcept { return fabsf(a); }
+inline f32v  mulAdd (const f32v a, const f32v b, const f32v c)    noexcept { return a * b + c; }
+
+#endif
+
+} // End of namespace GPM::SIMD
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "Calc.hpp"
+#include "Random.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Shape3D/Sphere.hpp"
+#include "Shape3D/Capsule.hpp"
+#include "Shape3D/Cylinder.hpp"
+
+namespace GPM::Random
+{
+
+// Batched uniform sampling of shapes: points are uniformly distributed over the
+// volume (sampleInside) or the area (sampleSurface) of the shape. Uniform numbers
+// are drawn in bulk and points computed in blocks of 256, in SoA layout so the
+// loops vectorize, with the batched Math functions for the trigonometry.
+void sampleInside   (const AABB& box, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleInside   (const OrientedBox& box, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleInside   (const Sphere& sphere, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleInside   (const Capsule& capsule, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleInside   (const Cylinder& cylinder, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+
+void sampleSurface  (const AABB& box, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleSurface  (const OrientedBox& box, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleSurface  (const Sphere& sphere, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleSurface  (const Capsule& capsule, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+void sampleSurface  (const Cylinder& cylinder, Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+
+void sampleTriangle (const Vec3& a, const Vec3& b, const Vec3& c,
+                     Vec3* out, const size_t count,
+                     Generator& generator = defaultGenerator())             noexcept;
+
+
+// Uniform sampling of the surface of a triangle mesh. The triangles are picked
+// with a binary search in the cumulative distribution of their areas, built once.
+class MeshSurfaceSampler
+{
+protected:
+    // Per triangle: first vertex and both edges
+    std::vector<Vec3> m_origins;
+    std::vector<Vec3> m_edges1;
+    std::vector<Vec3> m_edges2;
+    std::vector<f32>  m_cdf;
+    f32               m_totalArea{.0f};
+
+public:
+    MeshSurfaceSampler() = default;
+
+    // indices holds 3 * triangleCount vertex indices
+    MeshSurfaceSampler(const Vec3* positions, const u32* indices, const size_t triangleCount);
+
+    void    build       (const Vec3* positions, const u32* indices, const size_t triangleCount);
+
+    size_t  size        ()                                                  const noexcept { return m_cdf.size(); }
+    f32     totalArea   ()                                                  const noexcept { return m_totalArea; }
+
+    // triangles, when not null, receives the triangle index of every point,
+    // e.g. to interpolate normals or texture coordinates. The mesh must not be empty.
+    void    sample      (Vec3* out, const size_t count,
+                         u32* triangles = nullptr,
+                         Generator& generator = defaultGenerator())         const noexcept;
+};
+
+#include "Sampling.inl"
+
+} // End of namespace GPM::Random
@@ -0,0 +1,480 @@
+/* =================== Helpers =================== */
+namespace ShapeSampling
+{
+
+constexpr size_t blockSize{256u};
+
+template<typename F>
+inline void forEachBlock(const size_t count, F&& function) noexcept
+{
+    for (size_t first{0u}; first < count; first += blockSize)
+        function(first, std::min(blockSize, count - first));
+}
+
+
+inline void sqrt(f32* values, const size_t count) noexcept
+{
+    Math::Kernel::forEach(values, values, count, [](const SIMD::f32v x) { return SIMD::sqrt(x); });
+}
+
+
+// Orthonormal basis {b1, b2, n} around the unit vector n (Duff et al. 2017)
+inline void basis(const Vec3& n, Vec3& b1, Vec3& b2) noexcept
+{
+    const f32 sign{n.z < .0f ? -1.f : 1.f};
+    const f32 a   {-1.f / (sign + n.z)};
+    const f32 b   {n.x * n.y * a};
+
+    b1 = {1.f + sign * n.x * n.x * a, sign * b, -sign * n.x};
+    b2 = {b, sign + n.y * n.y * a, -n.y};
+}
+
+
+// Unit vectors uniform on the sphere: z uniform in [-1, 1] and a uniform longitude
+// give equal areas to equal z intervals (Archimedes' hat-box theorem)
+inline void unitDirections(f32* x, f32* y, f32* z, const size_t count, Generator& generator) noexcept
+{
+    generator.fill(z, count, -1.f, 1.f);
+    generator.fill(x, count, .0f, TWO_PI);
+    Math::sincos<EPrecision::Fast>(x, y, x, count);
+
+    f32 scales[blockSize];
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const f32 squared{1.f - z[i] * z[i]};
+        scales[i] = squared > .0f ? squared : .0f;
+    }
+
+    sqrt(scales, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        x[i] *= scales[i];
+        y[i] *= scales[i];
+    }
+}
+
+
+// Distances to the center of points uniform in the unit ball: cbrt(u)
+inline void ballRadii(f32* r, const size_t count, Generator& generator) noexcept
+{
+    generator.fill(r, count);
+    Math::log(r, r, count);
+
+    for (size_t i{0u}; i < count; ++i)
+        r[i] *= 1.f / 3.f;
+
+    Math::exp(r, r, count);
+}
+
+
+// Unit disk coordinates: sqrt(u) for the radius, uniform angle
+inline void unitDisk(f32* x, f32* y, const size_t count, Generator& generator) noexcept
+{
+    f32 radii[blockSize];
+    generator.fill(radii, count);
+    sqrt(radii, count);
+
+    generator.fill(x, count, .0f, TWO_PI);
+    Math::sincos<EPrecision::Fast>(x, y, x, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        x[i] *= radii[i];
+        y[i] *= radii[i];
+    }
+}
+
+
+// out = origin + i * x + j * y + k * z
+inline void toWorld(const Vec3& origin, const Vec3& i, const Vec3& j, const Vec3& k,
+                    const f32* x, const f32* y, const f32* z, Vec3* out, const size_t count) noexcept
+{
+    for (size_t p{0u}; p < count; ++p)
+    {
+        out[p] =
+        {
+            origin.x + i.x * x[p] + j.x * y[p] + k.x * z[p],
+            origin.y + i.y * x[p] + j.y * y[p] + k.y * z[p],
+            origin.z + i.z * x[p] + j.z * y[p] + k.z * z[p]
+        };
+    }
+}
+
+
+// Boxes are sampled in [-1, 1]^3 and mapped with their axes scaled by the extents
+inline void boxInside(const Vec3& origin, const Vec3& i, const Vec3& j, const Vec3& k,
+                      Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[blockSize], y[blockSize], z[blockSize];
+        generator.fill(x, size, -1.f, 1.f);
+        generator.fill(y, size, -1.f, 1.f);
+        generator.fill(z, size, -1.f, 1.f);
+
+        toWorld(origin, i, j, k, x, y, z, out + first, size);
+    });
+}
+
+
+// A face is picked with a probability proportional to its area, then the point
+// is uniform on it. areaX is the area of the faces orthogonal to i, and so on.
+inline void boxSurface(const Vec3& origin, const Vec3& i, const Vec3& j, const Vec3& k,
+                       const f32 areaX, const f32 areaY, const f32 areaZ,
+                       Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 face[blockSize], side[blockSize], u[blockSize], v[blockSize];
+        f32 x[blockSize], y[blockSize], z[blockSize];
+
+        generator.fill(face, size, .0f, areaX + areaY + areaZ);
+        generator.fill(side, size);
+        generator.fill(u, size, -1.f, 1.f);
+        generator.fill(v, size, -1.f, 1.f);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            const bool onX {face[p] < areaX};
+            const bool onY {!onX && face[p] < areaX + areaY};
+            const bool onZ {!onX && !onY};
+            const f32  sign{side[p] < .5f ? -1.f : 1.f};
+
+            x[p] = onX ? sign : u[p];
+            y[p] = onY ? sign : (onX ? u[p] : v[p]);
+            z[p] = onZ ? sign : v[p];
+        }
+
+        toWorld(origin, i, j, k, x, y, z, out + first, size);
+    });
+}
+
+
+// Frame of the shapes built around a segment: unit axis n, and its length
+inline void segmentFrame(const Vec3& pt1, const Vec3& pt2, Vec3& b1, Vec3& b2, Vec3& n, f32& length) noexcept
+{
+    const Vec3 axis{pt2 - pt1};
+    length = axis.length();
+    n      = length > .0f ? axis / length : Vec3::up();
+
+    basis(n, b1, b2);
+}
+
+} // End of namespace ShapeSampling
+
+
+
+
+/* =================== Boxes =================== */
+inline void sampleInside(const AABB& box, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    ShapeSampling::boxInside(box.center,
+                             Vec3::right()   * box.extents.x,
+                             Vec3::up()      * box.extents.y,
+                             Vec3::forward() * box.extents.z,
+                             out, count, generator);
+}
+
+
+inline void sampleInside(const OrientedBox& box, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Referential referential{box.getReferential()};
+
+    ShapeSampling::boxInside(referential.origin,
+                             referential.unitI * box.getExtI(),
+                             referential.unitJ * box.getExtJ(),
+                             referential.unitK * box.getExtK(),
+                             out, count, generator);
+}
+
+
+inline void sampleSurface(const AABB& box, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Vec3& e{box.extents};
+
+    ShapeSampling::boxSurface(box.center,
+                              Vec3::right() * e.x, Vec3::up() * e.y, Vec3::forward() * e.z,
+                              e.y * e.z, e.x * e.z, e.x * e.y,
+                              out, count, generator);
+}
+
+
+inline void sampleSurface(const OrientedBox& box, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Referential referential{box.getReferential()};
+    const f32         eI{box.getExtI()}, eJ{box.getExtJ()}, eK{box.getExtK()};
+
+    ShapeSampling::boxSurface(referential.origin,
+                              referential.unitI * eI, referential.unitJ * eJ, referential.unitK * eK,
+                              eJ * eK, eI * eK, eI * eJ,
+                              out, count, generator);
+}
+
+
+
+
+/* =================== Spheres =================== */
+inline void sampleInside(const Sphere& sphere, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const f32 radius{sphere.getRadius()};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize], r[ShapeSampling::blockSize];
+        ShapeSampling::unitDirections(x, y, z, size, generator);
+        ShapeSampling::ballRadii(r, size, generator);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            x[p] *= r[p];
+            y[p] *= r[p];
+            z[p] *= r[p];
+        }
+
+        ShapeSampling::toWorld(sphere.getCenter(), Vec3::right() * radius, Vec3::up() * radius, Vec3::forward() * radius,
+                               x, y, z, out + first, size);
+    });
+}
+
+
+inline void sampleSurface(const Sphere& sphere, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const f32 radius{sphere.getRadius()};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize];
+        ShapeSampling::unitDirections(x, y, z, size, generator);
+
+        ShapeSampling::toWorld(sphere.getCenter(), Vec3::right() * radius, Vec3::up() * radius, Vec3::forward() * radius,
+                               x, y, z, out + first, size);
+    });
+}
+
+
+
+
+/* =================== Cylinders and capsules =================== */
+// Points are computed in the frame {b1 * radius, b2 * radius, n} at the first end
+inline void sampleInside(const Cylinder& cylinder, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Segment& segment{cylinder.getSegment()};
+    const f32      radius {cylinder.getRadius()};
+    Vec3           b1, b2, n;
+    f32            height;
+    ShapeSampling::segmentFrame(segment.getPt1(), segment.getPt2(), b1, b2, n, height);
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize];
+        ShapeSampling::unitDisk(x, y, size, generator);
+        generator.fill(z, size, .0f, height);
+
+        ShapeSampling::toWorld(segment.getPt1(), b1 * radius, b2 * radius, n, x, y, z, out + first, size);
+    });
+}
+
+
+// The side has an area of 2 PI r h, the caps of PI r^2 each
+inline void sampleSurface(const Cylinder& cylinder, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Segment& segment{cylinder.getSegment()};
+    const f32      radius {cylinder.getRadius()};
+    Vec3           b1, b2, n;
+    f32            height;
+    ShapeSampling::segmentFrame(segment.getPt1(), segment.getPt2(), b1, b2, n, height);
+
+    // Areas divided by 2 PI r
+    const f32 sideArea{height}, capsArea{radius};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize], part[ShapeSampling::blockSize];
+        ShapeSampling::unitDisk(x, y, size, generator);
+        generator.fill(z, size);
+        generator.fill(part, size, .0f, sideArea + capsArea);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            const bool onSide{part[p] < sideArea};
+
+            // Side points are pushed from the disk to its rim, the center to any point of it
+            const f32  length    {x[p] * x[p] + y[p] * y[p]};
+            const bool degenerate{onSide && !(length > .0f)};
+            const f32  toRim     {onSide && length > .0f ? 1.f / std::sqrt(length) : 1.f};
+
+            x[p] = degenerate ? 1.f : x[p] * toRim;
+            y[p] *= toRim;
+            z[p] = onSide ? z[p] * height : (z[p] < .5f ? .0f : height);
+        }
+
+        ShapeSampling::toWorld(segment.getPt1(), b1 * radius, b2 * radius, n, x, y, z, out + first, size);
+    });
+}
+
+
+// The cylinder has a volume of PI r^2 h, the two half balls of 4 / 3 PI r^3:
+// a point of the ball goes to the end cap on the same side as it
+inline void sampleInside(const Capsule& capsule, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Segment& segment{capsule.getSegment()};
+    const f32      radius {capsule.getRadius()};
+    Vec3           b1, b2, n;
+    f32            height;
+    ShapeSampling::segmentFrame(segment.getPt1(), segment.getPt2(), b1, b2, n, height);
+
+    // Volumes divided by PI r^2
+    const f32 cylinderVolume{height}, ballVolume{radius * (4.f / 3.f)};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize];
+        f32 bx[ShapeSampling::blockSize], by[ShapeSampling::blockSize], bz[ShapeSampling::blockSize], br[ShapeSampling::blockSize], part[ShapeSampling::blockSize];
+
+        ShapeSampling::unitDisk(x, y, size, generator);
+        generator.fill(z, size, .0f, height);
+        ShapeSampling::unitDirections(bx, by, bz, size, generator);
+        ShapeSampling::ballRadii(br, size, generator);
+        generator.fill(part, size, .0f, cylinderVolume + ballVolume);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            const bool inBall{part[p] >= cylinderVolume};
+            const f32  ballZ {bz[p] * br[p] * radius};
+
+            x[p] = inBall ? bx[p] * br[p] : x[p];
+            y[p] = inBall ? by[p] * br[p] : y[p];
+            z[p] = inBall ? ballZ + (ballZ >= .0f ? height : .0f) : z[p];
+        }
+
+        ShapeSampling::toWorld(segment.getPt1(), b1 * radius, b2 * radius, n, x, y, z, out + first, size);
+    });
+}
+
+
+// The side has an area of 2 PI r h, the two half spheres of 4 PI r^2
+inline void sampleSurface(const Capsule& capsule, Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Segment& segment{capsule.getSegment()};
+    const f32      radius {capsule.getRadius()};
+    Vec3           b1, b2, n;
+    f32            height;
+    ShapeSampling::segmentFrame(segment.getPt1(), segment.getPt2(), b1, b2, n, height);
+
+    // Areas divided by 2 PI r
+    const f32 sideArea{height}, sphereArea{radius * 2.f};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 x[ShapeSampling::blockSize], y[ShapeSampling::blockSize], z[ShapeSampling::blockSize], part[ShapeSampling::blockSize];
+
+        // Directions give both the rim of the side (x, y normalized) and the sphere points
+        ShapeSampling::unitDirections(x, y, z, size, generator);
+        generator.fill(part, size, .0f, sideArea + sphereArea);
+
+        f32 t[ShapeSampling::blockSize];
+        generator.fill(t, size, .0f, height);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            // Directions along the axis have no rim point of their own, any one will do
+            const bool onSide    {part[p] < sideArea};
+            const f32  length    {x[p] * x[p] + y[p] * y[p]};
+            const bool degenerate{onSide && !(length > .0f)};
+            const f32  toRim     {onSide && length > .0f ? 1.f / std::sqrt(length) : 1.f};
+            const f32  ballZ     {z[p] * radius};
+
+            x[p] = degenerate ? 1.f : x[p] * toRim;
+            y[p] *= toRim;
+            z[p] = onSide ? t[p] : ballZ + (ballZ >= .0f ? height : .0f);
+        }
+
+        ShapeSampling::toWorld(segment.getPt1(), b1 * radius, b2 * radius, n, x, y, z, out + first, size);
+    });
+}
+
+
+
+
+/* =================== Triangles =================== */
+// Barycentric coordinates (1 - sqrt(u), sqrt(u) (1 - v), sqrt(u) v) are uniform over the triangle
+inline void sampleTriangle(const Vec3& a, const Vec3& b, const Vec3& c,
+                           Vec3* out, const size_t count, Generator& generator) noexcept
+{
+    const Vec3 ab{b - a}, ac{c - a};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 u[ShapeSampling::blockSize], v[ShapeSampling::blockSize], w[ShapeSampling::blockSize];
+        generator.fill(u, size);
+        generator.fill(v, size);
+        ShapeSampling::sqrt(u, size);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            w[p] = u[p] * v[p];
+            u[p] = u[p] - w[p];
+        }
+
+        ShapeSampling::toWorld(a, ab, ac, Vec3::zero(), u, w, w, out + first, size);
+    });
+}
+
+
+inline MeshSurfaceSampler::MeshSurfaceSampler(const Vec3* positions, const u32* indices, const size_t triangleCount)
+{
+    build(positions, indices, triangleCount);
+}
+
+
+inline void MeshSurfaceSampler::build(const Vec3* positions, const u32* indices, const size_t triangleCount)
+{
+    m_origins.resize(triangleCount);
+    m_edges1 .resize(triangleCount);
+    m_edges2 .resize(triangleCount);
+    m_cdf    .resize(triangleCount);
+
+    // Accumulated in double so that small triangles after large ones still count
+    f64 area{.0};
+    for (size_t i{0u}; i < triangleCount; ++i)
+    {
+        const Vec3& a{positions[indices[3u * i]]};
+
+        m_origins[i] = a;
+        m_edges1[i]  = positions[indices[3u * i + 1u]] - a;
+        m_edges2[i]  = positions[indices[3u * i + 2u]] - a;
+
+        area += .5 * static_cast<f64>(m_edges1[i].cross(m_edges2[i]).length());
+        m_cdf[i] = static_cast<f32>(area);
+    }
+
+    m_totalArea = static_cast<f32>(area);
+}
+
+
+inline void MeshSurfaceSampler::sample(Vec3* out, const size_t count, u32* triangles, Generator& generator) const noexcept
+{
+    const size_t lastTriangle{m_cdf.size() - 1u};
+
+    ShapeSampling::forEachBlock(count, [&](const size_t first, const size_t size)
+    {
+        f32 pick[ShapeSampling::blockSize], u[ShapeSampling::blockSize], v[ShapeSampling::blockSize];
+        generator.fill(pick, size, .0f, m_totalArea);
+        generator.fill(u, size);
+        generator.fill(v, size);
+        ShapeSampling::sqrt(u, size);
+
+        for (size_t p{0u}; p < size; ++p)
+        {
+            const size_t triangle{std::min(static_cast<size_t>(std::upper_bound(m_cdf.begin(), m_cdf.end(), pick[p]) - m_cdf.begin()),
+                                           lastTriangle)};
+            const f32    w       {u[p] * v[p]};
+
+            out[first + p] = m_origins[triangle] + m_edges1[triangle] * (u[p] - w) + m_edges2[triangle] * w;
+
+            if (triangles)
+                triangles[first + p] = static_cast<u32>(triangle);
+        }
+    });
+}
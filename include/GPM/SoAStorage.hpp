@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include "Types.hpp"
+#include "SIMD.hpp"
+
+namespace GPM
+{
+
+// Storage shared by the structure-of-arrays streams: Components arrays of
+// capacity() floats in a single allocation, each aligned to GPM_SIMD_ALIGNMENT
+// and padded to a multiple of the SIMD width. The streams add the element
+// access and the batched kernels on top of it.
+template<size_t Components>
+class SoAStorage
+{
+protected:
+    // [c0 c0 ... | c1 c1 ... | ...], m_capacity floats per component
+    f32*   m_data    {nullptr};
+    size_t m_size    {0u};
+    size_t m_capacity{0u};
+
+    f32*        component   (const size_t c)                                noexcept       { return m_data + c * m_capacity; }
+    const f32*  component   (const size_t c)                                const noexcept { return m_data + c * m_capacity; }
+
+    // Grows or shrinks to count elements, the new ones are set to values
+    void        resize      (const size_t count, const f32 (&values)[Components]);
+
+    // Makes room for one more element, doubling the capacity when full
+    void        grow        ();
+
+public:
+    // Constructors
+    SoAStorage()                                                            = default;
+    SoAStorage(const SoAStorage& other);
+    SoAStorage(SoAStorage&& other)                                          noexcept;
+    ~SoAStorage();
+    SoAStorage& operator=(const SoAStorage& other);
+    SoAStorage& operator=(SoAStorage&& other)                               noexcept;
+
+    // Storage
+    size_t      size        ()                                              const noexcept { return m_size; }
+    size_t      capacity    ()                                              const noexcept { return m_capacity; }
+    bool        empty       ()                                              const noexcept { return m_size == 0u; }
+    void        clear       ()                                              noexcept       { m_size = 0u; }
+    void        reserve     (const size_t count);
+};
+
+#include "SoAStorage.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,141 @@
+/* =================== Allocation helpers =================== */
+namespace SoA
+{
+
+// Component arrays are padded to whole SIMD registers, and to a whole
+// alignment unit so that every array starts aligned too
+inline constexpr size_t paddedCount(const size_t count) noexcept
+{
+    constexpr size_t granularity{GPM_SIMD_ALIGNMENT / sizeof(f32)};
+    return (count + granularity - 1u) / granularity * granularity;
+}
+
+
+inline f32* allocate(const size_t floatCount)
+{
+    return static_cast<f32*>(::operator new(floatCount * sizeof(f32), std::align_val_t{GPM_SIMD_ALIGNMENT}));
+}
+
+
+inline void deallocate(f32* data) noexcept
+{
+    if (data)
+        ::operator delete(data, std::align_val_t{GPM_SIMD_ALIGNMENT});
+}
+
+} // End of namespace SoA
+
+
+
+
+/* =================== Constructors =================== */
+template<size_t Components>
+inline SoAStorage<Components>::SoAStorage(const SoAStorage& other)
+{
+    *this = other;
+}
+
+
+template<size_t Components>
+inline SoAStorage<Components>::SoAStorage(SoAStorage&& other) noexcept
+    : m_data{other.m_data}, m_size{other.m_size}, m_capacity{other.m_capacity}
+{
+    other.m_data     = nullptr;
+    other.m_size     = 0u;
+    other.m_capacity = 0u;
+}
+
+
+template<size_t Components>
+inline SoAStorage<Components>::~SoAStorage()
+{
+    SoA::deallocate(m_data);
+}
+
+
+template<size_t Components>
+inline SoAStorage<Components>& SoAStorage<Components>::operator=(const SoAStorage& other)
+{
+    if (this != &other)
+    {
+        m_size = 0u;
+        reserve(other.m_size);
+
+        for (size_t c{0u}; c < Components; ++c)
+        {
+            for (size_t i{0u}; i < other.m_size; ++i)
+                component(c)[i] = other.component(c)[i];
+        }
+
+        m_size = other.m_size;
+    }
+
+    return *this;
+}
+
+
+template<size_t Components>
+inline SoAStorage<Components>& SoAStorage<Components>::operator=(SoAStorage&& other) noexcept
+{
+    if (this != &other)
+    {
+        SoA::deallocate(m_data);
+
+        m_data     = other.m_data;
+        m_size     = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data     = nullptr;
+        other.m_size     = 0u;
+        other.m_capacity = 0u;
+    }
+
+    return *this;
+}
+
+
+
+
+/* =================== Storage =================== */
+template<size_t Components>
+inline void SoAStorage<Components>::reserve(const size_t count)
+{
+    if (count <= m_capacity)
+        return;
+
+    const size_t newCapacity{SoA::paddedCount(count)};
+    f32* const   newData    {SoA::allocate(Components * newCapacity)};
+
+    for (size_t c{0u}; c < Components; ++c)
+    {
+        for (size_t i{0u}; i < m_size; ++i)
+            newData[c * newCapacity + i] = m_data[c * m_capacity + i];
+    }
+
+    SoA::deallocate(m_data);
+    m_data     = newData;
+    m_capacity = newCapacity;
+}
+
+
+template<size_t Components>
+inline void SoAStorage<Components>::resize(const size_t count, const f32 (&values)[Components])
+{
+    reserve(count);
+
+    for (size_t c{0u}; c < Components; ++c)
+    {
+        for (size_t i{m_size}; i < count; ++i)
+            component(c)[i] = values[c];
+    }
+
+    m_size = count;
+}
+
+
+template<size_t Components>
+inline void SoAStorage<Components>::grow()
+{
+    if (m_size == m_capacity)
+        reserve(m_capacity ? 2u * m_capacity : SoA::paddedCount(1u));
+}
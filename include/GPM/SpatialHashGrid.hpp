@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "JobSystem.hpp"
+#include "NearestHeap.hpp"
+#include "Shape3D/Sphere.hpp"
+
+namespace GPM
+{
+
+// Hashed uniform grid over points or spheres, for neighbour queries. Cells are
+// cubes of cellSize, hashed from their integer coordinates to a power-of-two
+// table of about twice as many buckets as objects, so only the occupied space
+// costs memory. The objects are counting-sorted by bucket into flat arrays:
+// a rebuild makes no per-cell allocation.
+//
+// Queries are exact: the objects of other cells sharing a bucket are skipped.
+// A cellSize close to the usual query radius works best.
+class SpatialHashGrid
+{
+protected:
+    std::vector<u32>  m_bucketStarts;   // tableSize + 1 offsets into the sorted arrays
+    std::vector<Vec3> m_points;         // Sorted by bucket
+    std::vector<u64>  m_cellKeys;       // Packed cell of each sorted object
+    std::vector<f32>  m_radii;          // Sorted by bucket, empty for points
+    std::vector<u32>  m_indices;        // Input index of each sorted object
+    std::vector<u32>  m_buckets;        // Bucket of each input object
+    std::vector<u32>  m_counts;         // Bucket counts of each build chunk
+    f32               m_cellSize;
+    f32               m_inverseCellSize;
+    f32               m_maxRadius   {.0f};
+    s32               m_cellMin[3]  {};
+    s32               m_cellMax[3]  {-1, -1, -1};
+
+    void   build         (const Vec3* points, const Sphere* spheres,
+                          const size_t count, JobSystem* jobs);
+    void   cellOf        (const Vec3& point, s32 (&cell)[3])            const noexcept;
+    u32    bucketOf      (const s32 x, const s32 y, const s32 z)        const noexcept;
+
+    // Calls visit(sorted) for the objects in the cells [min, max]
+    template<typename F>
+    void   forEachInCells(const s32 (&min)[3], const s32 (&max)[3], F&& visit) const noexcept;
+
+public:
+    // Constructors
+    explicit SpatialHashGrid(const f32 cellSize = 1.f)                  noexcept
+        : m_cellSize{cellSize}, m_inverseCellSize{1.f / cellSize} {}
+
+    // Rebuilds the grid over count points or spheres, in parallel with jobs.
+    // Objects of a bucket stay in input order, so both builds are identical.
+    void   build         (const Vec3* points, const size_t count);
+    void   build         (const Vec3* points, const size_t count, JobSystem& jobs);
+    void   build         (const Sphere* spheres, const size_t count);
+    void   build         (const Sphere* spheres, const size_t count, JobSystem& jobs);
+
+    // Radius query: writes the first capacity indices of the points within
+    // radius of center, or of the spheres that intersect the sphere {center,
+    // radius}, to out, in no particular order, and returns their total count.
+    size_t queryRadius   (const Vec3& center, const f32 radius,
+                          u32* out, const size_t capacity)              const noexcept;
+
+    // k-nearest query on the points or sphere centers, within maxDistance:
+    // writes up to k indices to out, nearest first, with their squared
+    // distances to sqrDistances, and returns their count. Both arrays must
+    // hold k elements, they are the heap of the search. The search grows rings
+    // of cells around center until the k-th distance is known to be final.
+    size_t queryNearest  (const Vec3& center, const u32 k, u32* out, f32* sqrDistances,
+                          const f32 maxDistance = std::numeric_limits<f32>::infinity()) const noexcept;
+
+    // Getters
+    f32    getCellSize   ()                                             const noexcept { return m_cellSize; }
+    size_t getTableSize  ()                                             const noexcept { return m_bucketStarts.empty() ? 0u : m_bucketStarts.size() - 1u; }
+    size_t size          ()                                             const noexcept { return m_indices.size(); }
+    u32    getCellHash   (const Vec3& point)                            const noexcept;
+};
+
+#include "SpatialHashGrid.inl"
+
+} // End of namespace GPM
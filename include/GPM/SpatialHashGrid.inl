@@ -0,0 +1,406 @@
+/* =================== Helpers =================== */
+namespace SpatialHashing
+{
+
+// Build chunks are never smaller than this
+constexpr size_t minChunkSize{4096u};
+
+// Cell coordinates are clamped to 21 bits, to be packed in the 63 bits of a
+// cell key. The objects beyond share the border cells: queries stay exact.
+constexpr f32 cellLimit{1048576.f};
+constexpr u32 keyBits  {21u};
+constexpr u32 keyMask  {(1u << keyBits) - 1u};
+
+
+// Teschner et al. 2003, large primes xor-ed
+inline u32 hashCell(const s32 x, const s32 y, const s32 z) noexcept
+{
+    return (static_cast<u32>(x) * 73856093u) ^ (static_cast<u32>(y) * 19349663u) ^ (static_cast<u32>(z) * 83492791u);
+}
+
+
+inline u64 packCell(const s32 x, const s32 y, const s32 z) noexcept
+{
+    return static_cast<u64>(static_cast<u32>(x) & keyMask) << (2u * keyBits) |
+           static_cast<u64>(static_cast<u32>(y) & keyMask) << keyBits |
+           static_cast<u64>(static_cast<u32>(z) & keyMask);
+}
+
+
+// Sign extension of the 21-bit coordinates
+inline void unpackCell(const u64 key, s32 (&cell)[3]) noexcept
+{
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        const u32 bits{static_cast<u32>(key >> ((2u - axis) * keyBits)) & keyMask};
+        cell[axis] = static_cast<s32>(bits << (32u - keyBits)) >> (32u - keyBits);
+    }
+}
+
+
+inline size_t tableSizeFor(const size_t count) noexcept
+{
+    size_t size{1u};
+    while (size < 2u * count)
+        size <<= 1u;
+
+    return size;
+}
+
+} // End of namespace SpatialHashing
+
+
+
+
+/* =================== Cells =================== */
+inline void SpatialHashGrid::cellOf(const Vec3& point, s32 (&cell)[3]) const noexcept
+{
+    using namespace SpatialHashing;
+
+    for (u32 axis{0u}; axis < 3u; ++axis)
+        cell[axis] = static_cast<s32>(std::min(std::max(std::floor(point.e[axis] * m_inverseCellSize), -cellLimit), cellLimit - 1.f));
+}
+
+
+inline u32 SpatialHashGrid::bucketOf(const s32 x, const s32 y, const s32 z) const noexcept
+{
+    return SpatialHashing::hashCell(x, y, z) & static_cast<u32>(m_bucketStarts.size() - 2u);
+}
+
+
+inline u32 SpatialHashGrid::getCellHash(const Vec3& point) const noexcept
+{
+    s32 cell[3];
+    cellOf(point, cell);
+
+    return SpatialHashing::hashCell(cell[0], cell[1], cell[2]);
+}
+
+
+
+
+/* =================== Build =================== */
+inline void SpatialHashGrid::build(const Vec3* points, const size_t count)
+{
+    build(points, nullptr, count, nullptr);
+}
+
+
+inline void SpatialHashGrid::build(const Vec3* points, const size_t count, JobSystem& jobs)
+{
+    build(points, nullptr, count, &jobs);
+}
+
+
+inline void SpatialHashGrid::build(const Sphere* spheres, const size_t count)
+{
+    build(nullptr, spheres, count, nullptr);
+}
+
+
+inline void SpatialHashGrid::build(const Sphere* spheres, const size_t count, JobSystem& jobs)
+{
+    build(nullptr, spheres, count, &jobs);
+}
+
+
+// Counting sort by bucket: every chunk counts its buckets, then scatters its
+// objects from its own offsets, after the same bucket of the previous chunks
+inline void SpatialHashGrid::build(const Vec3* points, const Sphere* spheres, const size_t count, JobSystem* jobs)
+{
+    const size_t tableSize{SpatialHashing::tableSizeFor(count)};
+    const u32    mask     {static_cast<u32>(tableSize - 1u)};
+    const u32    chunks   {jobs ? static_cast<u32>(std::max<size_t>(std::min<size_t>(jobs->workerCount() + 1u,
+                                                                                     count / SpatialHashing::minChunkSize), 1u))
+                                : 1u};
+
+    m_bucketStarts.assign(tableSize + 1u, 0u);
+    m_points.resize(count);
+    m_cellKeys.resize(count);
+    m_radii.resize(spheres ? count : 0u);
+    m_indices.resize(count);
+    m_buckets.resize(count);
+    m_counts.assign(static_cast<size_t>(chunks) * tableSize, 0u);
+
+    // Occupied cells and largest radius of each chunk
+    struct ChunkBounds
+    {
+        s32 min[3]{std::numeric_limits<s32>::max(), std::numeric_limits<s32>::max(), std::numeric_limits<s32>::max()};
+        s32 max[3]{std::numeric_limits<s32>::min(), std::numeric_limits<s32>::min(), std::numeric_limits<s32>::min()};
+        f32 radius{.0f};
+    };
+
+    std::vector<ChunkBounds> bounds(chunks);
+
+    auto forEachChunk = [&](auto&& function)
+    {
+        auto run = [&](const u32 first, const u32 last)
+        {
+            for (u32 chunk{first}; chunk < last; ++chunk)
+                function(chunk, count * chunk / chunks, count * (chunk + 1u) / chunks);
+        };
+
+        if (chunks > 1u)
+            jobs->parallelFor(chunks, 1u, run);
+        else
+            run(0u, chunks);
+    };
+
+    forEachChunk([&](const u32 chunk, const size_t begin, const size_t end)
+    {
+        u32*         counts{m_counts.data() + static_cast<size_t>(chunk) * tableSize};
+        ChunkBounds& chunkBounds{bounds[chunk]};
+
+        for (size_t i{begin}; i < end; ++i)
+        {
+            s32 cell[3];
+            cellOf(spheres ? spheres[i].getCenter() : points[i], cell);
+
+            for (u32 axis{0u}; axis < 3u; ++axis)
+            {
+                chunkBounds.min[axis] = std::min(chunkBounds.min[axis], cell[axis]);
+                chunkBounds.max[axis] = std::max(chunkBounds.max[axis], cell[axis]);
+            }
+
+            if (spheres)
+                chunkBounds.radius = std::max(chunkBounds.radius, spheres[i].getRadius());
+
+            m_buckets[i] = SpatialHashing::hashCell(cell[0], cell[1], cell[2]) & mask;
+            ++counts[m_buckets[i]];
+        }
+    });
+
+    // Exclusive prefix sum, bucket-major then chunk order
+    u32 offset{0u};
+    for (size_t bucket{0u}; bucket < tableSize; ++bucket)
+    {
+        m_bucketStarts[bucket] = offset;
+
+        for (u32 chunk{0u}; chunk < chunks; ++chunk)
+        {
+            u32&      bucketCount{m_counts[static_cast<size_t>(chunk) * tableSize + bucket]};
+            const u32 size       {bucketCount};
+
+            bucketCount = offset;
+            offset     += size;
+        }
+    }
+    m_bucketStarts[tableSize] = offset;
+
+    forEachChunk([&](const u32 chunk, const size_t begin, const size_t end)
+    {
+        u32* offsets{m_counts.data() + static_cast<size_t>(chunk) * tableSize};
+
+        for (size_t i{begin}; i < end; ++i)
+        {
+            const u32 target{offsets[m_buckets[i]]++};
+
+            s32 cell[3];
+            m_indices[target]  = static_cast<u32>(i);
+            m_points[target]   = spheres ? spheres[i].getCenter() : points[i];
+            cellOf(m_points[target], cell);
+            m_cellKeys[target] = SpatialHashing::packCell(cell[0], cell[1], cell[2]);
+
+            if (spheres)
+                m_radii[target] = spheres[i].getRadius();
+        }
+    });
+
+    m_maxRadius = .0f;
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        m_cellMin[axis] = count > 0u ? std::numeric_limits<s32>::max() : 0;
+        m_cellMax[axis] = count > 0u ? std::numeric_limits<s32>::min() : -1;
+    }
+
+    for (const ChunkBounds& chunkBounds : bounds)
+    {
+        m_maxRadius = std::max(m_maxRadius, chunkBounds.radius);
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            m_cellMin[axis] = std::min(m_cellMin[axis], chunkBounds.min[axis]);
+            m_cellMax[axis] = std::max(m_cellMax[axis], chunkBounds.max[axis]);
+        }
+    }
+}
+
+
+
+
+/* =================== Queries =================== */
+template<typename F>
+inline void SpatialHashGrid::forEachInCells(const s32 (&min)[3], const s32 (&max)[3], F&& visit) const noexcept
+{
+    s32 first[3], last[3];
+    for (u32 axis{0u}; axis < 3u; ++axis)
+    {
+        first[axis] = std::max(min[axis], m_cellMin[axis]);
+        last[axis]  = std::min(max[axis], m_cellMax[axis]);
+
+        if (first[axis] > last[axis])
+            return;
+    }
+
+    const f64 cellCount{static_cast<f64>(last[0] - first[0] + 1) *
+                        static_cast<f64>(last[1] - first[1] + 1) *
+                        static_cast<f64>(last[2] - first[2] + 1)};
+
+    // Regions of more cells than objects: a linear scan is cheaper
+    if (cellCount > static_cast<f64>(m_points.size()))
+    {
+        for (u32 sorted{0u}; sorted < m_points.size(); ++sorted)
+        {
+            s32 cell[3];
+            SpatialHashing::unpackCell(m_cellKeys[sorted], cell);
+
+            if (cell[0] >= first[0] && cell[0] <= last[0] &&
+                cell[1] >= first[1] && cell[1] <= last[1] &&
+                cell[2] >= first[2] && cell[2] <= last[2])
+                visit(sorted);
+        }
+        return;
+    }
+
+    for (s32 z{first[2]}; z <= last[2]; ++z)
+    {
+        for (s32 y{first[1]}; y <= last[1]; ++y)
+        {
+            for (s32 x{first[0]}; x <= last[0]; ++x)
+            {
+                const u32 bucket{bucketOf(x, y, z)};
+                const u64 key   {SpatialHashing::packCell(x, y, z)};
+
+                for (u32 sorted{m_bucketStarts[bucket]}; sorted < m_bucketStarts[bucket + 1u]; ++sorted)
+                    if (m_cellKeys[sorted] == key)
+                        visit(sorted);
+            }
+        }
+    }
+}
+
+
+inline size_t SpatialHashGrid::queryRadius(const Vec3& center, const f32 radius, u32* out, const size_t capacity) const noexcept
+{
+    // Spheres are found from their centers, up to the largest radius away
+    const f32 reach{radius + m_maxRadius};
+    size_t    count{0u};
+
+    s32 min[3], max[3];
+    cellOf(center - Vec3{reach}, min);
+    cellOf(center + Vec3{reach}, max);
+
+    forEachInCells(min, max, [&](const u32 sorted)
+    {
+        const f32 distance{m_radii.empty() ? radius : radius + m_radii[sorted]};
+
+        if (center.sqrDistanceTo(m_points[sorted]) <= distance * distance)
+        {
+            if (count < capacity)
+                out[count] = m_indices[sorted];
+            ++count;
+        }
+    });
+
+    return count;
+}
+
+
+inline size_t SpatialHashGrid::queryNearest(const Vec3& center, const u32 k, u32* out, f32* sqrDistances,
+                                            const f32 maxDistance) const noexcept
+{
+    if (k == 0u || m_points.empty())
+        return 0u;
+
+    // Max-heap of the k best candidates in out and sqrDistances, with sorted
+    // indices until the end
+    const f32 maxSqrDistance{maxDistance * maxDistance};
+    size_t    found         {0u};
+    f32       worst         {maxSqrDistance};
+
+    auto visit = [&](const u32 sorted)
+    {
+        const f32 sqrDistance{center.sqrDistanceTo(m_points[sorted])};
+
+        if (found < k)
+        {
+            if (sqrDistance <= maxSqrDistance)
+            {
+                out[found]          = sorted;
+                sqrDistances[found] = sqrDistance;
+                NearestHeap::siftUp(sqrDistances, out, found++);
+            }
+        }
+        else if (sqrDistance < sqrDistances[0])
+        {
+            out[0]          = sorted;
+            sqrDistances[0] = sqrDistance;
+            NearestHeap::siftDown(sqrDistances, out, k, 0u);
+        }
+
+        worst = found < k ? maxSqrDistance : sqrDistances[0];
+    };
+
+    s32 cell[3];
+    cellOf(center, cell);
+
+    // Ring r holds the cells at Chebyshev distance r from the cell of center.
+    // The objects left are beyond the faces of the rings visited that still
+    // have occupied cells behind them, the search ends when they are too far.
+    for (s32 ring{0};; ++ring)
+    {
+        if (ring > 0)
+        {
+            f32 reached{std::numeric_limits<f32>::infinity()};
+            for (u32 axis{0u}; axis < 3u; ++axis)
+            {
+                if (cell[axis] - ring + 1 > m_cellMin[axis])
+                    reached = std::min(reached, center.e[axis] - static_cast<f32>(cell[axis] - ring + 1) * m_cellSize);
+                if (cell[axis] + ring - 1 < m_cellMax[axis])
+                    reached = std::min(reached, static_cast<f32>(cell[axis] + ring) * m_cellSize - center.e[axis]);
+            }
+
+            reached = std::max(reached, static_cast<f32>(ring - 1) * m_cellSize);
+            if (reached * reached >= worst)
+                break;
+        }
+
+        // The six faces of the shell, without visiting an edge twice:
+        // z faces whole, y faces without their z rows, x faces without both
+        for (s32 side{-1}; side <= 1; side += 2)
+        {
+            const s32 z{cell[2] + side * ring};
+            const s32 faceMin[3]{cell[0] - ring, cell[1] - ring, z};
+            const s32 faceMax[3]{cell[0] + ring, cell[1] + ring, z};
+            forEachInCells(faceMin, faceMax, visit);
+
+            if (ring == 0)
+                break;
+        }
+
+        if (ring == 0)
+            continue;
+
+        for (s32 side{-1}; side <= 1; side += 2)
+        {
+            const s32 y{cell[1] + side * ring};
+            const s32 faceMin[3]{cell[0] - ring, y, cell[2] - ring + 1};
+            const s32 faceMax[3]{cell[0] + ring, y, cell[2] + ring - 1};
+            forEachInCells(faceMin, faceMax, visit);
+        }
+
+        for (s32 side{-1}; side <= 1; side += 2)
+        {
+            const s32 x{cell[0] + side * ring};
+            const s32 faceMin[3]{x, cell[1] - ring + 1, cell[2] - ring + 1};
+            const s32 faceMax[3]{x, cell[1] + ring - 1, cell[2] + ring - 1};
+            forEachInCells(faceMin, faceMax, visit);
+        }
+    }
+
+    NearestHeap::sort(sqrDistances, out, found);
+
+    for (size_t i{0u}; i < found; ++i)
+        out[i] = m_indices[out[i]];
+
+    return found;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Types.hpp"
+#include "Vector3.hpp"
+#include "SIMD.hpp"
+#include "JobSystem.hpp"
+#include "Shape3D/AABB.hpp"
+
+namespace GPM
+{
+
+// Indices of two overlapping boxes in the input array, first < second
+struct SweepAndPrunePair
+{
+    u32 first;
+    u32 second;
+};
+
+// Sort-and-sweep broadphase. The boxes are sorted by their min along one axis,
+// then each box is only tested against the following ones that start before
+// it ends, GPM_SIMD_WIDTH boxes at a time on the two other axes. Fits dense
+// and flat scenes, e.g. 2.5D crowds, where the boxes spread along one or two
+// axes and trees gain little.
+//
+// The order is kept from one update to the next: for coherent motion, an
+// insertion sort brings it up to date in about linear time. When it takes too
+// many moves, the count changes or the axis changes, the boxes are radix
+// sorted instead, in parallel with a JobSystem.
+class SweepAndPrune
+{
+protected:
+    std::vector<u32> m_order;           // Input indices sorted along m_axis
+    std::vector<u32> m_keys;            // Sortable bits of the sorted mins
+    std::vector<u32> m_orderTemp;
+    std::vector<u32> m_keysTemp;
+    std::vector<u32> m_histograms;
+    std::vector<f32> m_min[3];          // Sorted SoA bounds, padded with GPM_SIMD_WIDTH empty boxes
+    std::vector<f32> m_max[3];
+    u32              m_axis     {0u};
+    bool             m_rebuilt  {false};
+
+    void update         (const AABB* boxes, const size_t count,
+                         std::vector<SweepAndPrunePair>& pairs, JobSystem* jobs);
+    bool sortIncremental(const AABB* boxes, const size_t count)                 noexcept;
+    void sortRadix      (const AABB* boxes, const size_t count, JobSystem* jobs);
+    void sweep          (const size_t begin, const size_t end,
+                         std::vector<SweepAndPrunePair>& pairs)                 const;
+
+public:
+    // The sweep axis only changes when the variance of the box centers along
+    // another axis is this many times higher, so that it doesn't flip-flop
+    static constexpr f32 axisHysteresis{1.2f};
+
+    // Above this many insertion sort moves per box on average, the boxes are radix sorted
+    static constexpr u32 maxMovesPerBox{4u};
+
+    // Constructors
+    SweepAndPrune()                                                             = default;
+
+    // Finds the pairs of overlapping boxes (touching boxes overlap), in no
+    // particular order. pairs is cleared first. With jobs, the sort and the
+    // sweep run in parallel and give the same pairs in the same order.
+    void        update          (const AABB* boxes, const size_t count,
+                                 std::vector<SweepAndPrunePair>& pairs);
+    void        update          (const AABB* boxes, const size_t count,
+                                 std::vector<SweepAndPrunePair>& pairs,
+                                 JobSystem& jobs);
+
+    // Getters of the last update
+    u32         getAxis         ()                                              const noexcept { return m_axis; }
+    bool        wasRebuilt      ()                                              const noexcept { return m_rebuilt; }
+    const u32*  getOrder        ()                                              const noexcept { return m_order.data(); }
+};
+
+#include "SweepAndPrune.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,316 @@
+/* =================== Helpers =================== */
+namespace SweepAndPruneDetail
+{
+
+// 3 passes of 11 bits over the 32 bits of the keys
+constexpr u32 radixBits  {11u};
+constexpr u32 radixSize  {1u << radixBits};
+constexpr u32 radixPasses{3u};
+
+// Elements per job of the parallel passes
+constexpr size_t chunkSize{16384u};
+
+
+// Bits of a float that sort as unsigned integers in the order of the floats
+inline u32 sortableKey(const f32 value) noexcept
+{
+    u32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return bits ^ ((bits >> 31u) != 0u ? 0xFFFFFFFFu : 0x80000000u);
+}
+
+
+inline u32 chunkCount(const JobSystem* jobs, const size_t count) noexcept
+{
+    return jobs ? std::max(static_cast<u32>((count + chunkSize - 1u) / chunkSize), 1u) : 1u;
+}
+
+
+// Calls function(chunk, begin, end) for chunks of [0, count), in parallel with jobs
+template<typename F>
+inline void forEachChunk(JobSystem* jobs, const u32 chunks, const size_t count, F&& function)
+{
+    auto run = [&](const u32 first, const u32 last)
+    {
+        for (u32 chunk{first}; chunk < last; ++chunk)
+            function(chunk, count * chunk / chunks, count * (chunk + 1u) / chunks);
+    };
+
+    if (jobs && chunks > 1u)
+        jobs->parallelFor(chunks, 1u, run);
+    else
+        run(0u, chunks);
+}
+
+} // End of namespace SweepAndPruneDetail
+
+
+
+
+/* =================== Update =================== */
+inline void SweepAndPrune::update(const AABB* boxes, const size_t count, std::vector<SweepAndPrunePair>& pairs)
+{
+    update(boxes, count, pairs, nullptr);
+}
+
+
+inline void SweepAndPrune::update(const AABB* boxes, const size_t count, std::vector<SweepAndPrunePair>& pairs,
+                                  JobSystem& jobs)
+{
+    update(boxes, count, pairs, &jobs);
+}
+
+
+inline void SweepAndPrune::update(const AABB* boxes, const size_t count, std::vector<SweepAndPrunePair>& pairs,
+                                  JobSystem* jobs)
+{
+    using namespace SweepAndPruneDetail;
+
+    pairs.clear();
+
+    // Sweep axis: the largest variance of the centers separates the boxes best
+    f64 sum[3]{}, sumSquared[3]{};
+    for (size_t i{0u}; i < count; ++i)
+    {
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            const f64 center{boxes[i].center.e[axis]};
+            sum[axis]        += center;
+            sumSquared[axis] += center * center;
+        }
+    }
+
+    f64 variance[3];
+    for (u32 axis{0u}; axis < 3u; ++axis)
+        variance[axis] = sumSquared[axis] - sum[axis] * sum[axis] / static_cast<f64>(std::max<size_t>(count, 1u));
+
+    u32 axis{variance[0] >= variance[1] && variance[0] >= variance[2] ? 0u : (variance[1] >= variance[2] ? 1u : 2u)};
+    if (variance[axis] <= axisHysteresis * variance[m_axis])
+        axis = m_axis;
+
+    m_rebuilt = axis != m_axis || count != m_order.size() || !sortIncremental(boxes, count);
+    m_axis    = axis;
+
+    if (m_rebuilt)
+        sortRadix(boxes, count, jobs);
+
+    // Sorted SoA bounds, padded for the full-width loads at the end of the sweep
+    for (u32 component{0u}; component < 3u; ++component)
+    {
+        m_min[component].resize(count + GPM_SIMD_WIDTH);
+        m_max[component].resize(count + GPM_SIMD_WIDTH);
+    }
+
+    for (size_t i{count}; i < count + GPM_SIMD_WIDTH; ++i)
+    {
+        for (u32 component{0u}; component < 3u; ++component)
+        {
+            m_min[component][i] = std::numeric_limits<f32>::infinity();
+            m_max[component][i] = -std::numeric_limits<f32>::infinity();
+        }
+    }
+
+    const u32 chunks{chunkCount(jobs, count)};
+
+    forEachChunk(jobs, chunks, count, [&](const u32, const size_t begin, const size_t end)
+    {
+        for (size_t i{begin}; i < end; ++i)
+        {
+            const AABB& box{boxes[m_order[i]]};
+            for (u32 component{0u}; component < 3u; ++component)
+            {
+                m_min[component][i] = box.center.e[component] - box.extents.e[component];
+                m_max[component][i] = box.center.e[component] + box.extents.e[component];
+            }
+        }
+    });
+
+    if (chunks == 1u)
+    {
+        sweep(0u, count, pairs);
+        return;
+    }
+
+    // One pair list per chunk, appended in order
+    std::vector<std::vector<SweepAndPrunePair>> chunkPairs(chunks);
+    forEachChunk(jobs, chunks, count, [&](const u32 chunk, const size_t begin, const size_t end)
+    {
+        sweep(begin, end, chunkPairs[chunk]);
+    });
+
+    size_t total{0u};
+    for (const std::vector<SweepAndPrunePair>& chunk : chunkPairs)
+        total += chunk.size();
+
+    pairs.reserve(total);
+    for (const std::vector<SweepAndPrunePair>& chunk : chunkPairs)
+        pairs.insert(pairs.end(), chunk.begin(), chunk.end());
+}
+
+
+
+
+/* =================== Sort =================== */
+// Insertion sort of the previous order with the new mins, false when it gives
+// up after maxMovesPerBox moves per box on average
+inline bool SweepAndPrune::sortIncremental(const AABB* boxes, const size_t count) noexcept
+{
+    using namespace SweepAndPruneDetail;
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const AABB& box{boxes[m_order[i]]};
+        m_keys[i] = sortableKey(box.center.e[m_axis] - box.extents.e[m_axis]);
+    }
+
+    const size_t maxMoves{count * maxMovesPerBox};
+    size_t       moves   {0u};
+
+    for (size_t i{1u}; i < count; ++i)
+    {
+        const u32 key  {m_keys[i]};
+        const u32 index{m_order[i]};
+
+        size_t j{i};
+        for (; j > 0u && m_keys[j - 1u] > key; --j)
+        {
+            m_keys[j]  = m_keys[j - 1u];
+            m_order[j] = m_order[j - 1u];
+        }
+
+        m_keys[j]  = key;
+        m_order[j] = index;
+
+        moves += i - j;
+        if (moves > maxMoves)
+            return false;
+    }
+
+    return true;
+}
+
+
+// Stable LSD radix sort of the boxes in input order. Each pass counts the
+// digits per chunk, then every chunk scatters its elements from its own
+// offsets, which gives the same result as a serial pass.
+inline void SweepAndPrune::sortRadix(const AABB* boxes, const size_t count, JobSystem* jobs)
+{
+    using namespace SweepAndPruneDetail;
+
+    m_order.resize(count);
+    m_keys.resize(count);
+    m_orderTemp.resize(count);
+    m_keysTemp.resize(count);
+
+    const u32 chunks{chunkCount(jobs, count)};
+    m_histograms.resize(static_cast<size_t>(chunks) * radixSize);
+
+    forEachChunk(jobs, chunks, count, [&](const u32, const size_t begin, const size_t end)
+    {
+        for (size_t i{begin}; i < end; ++i)
+        {
+            m_order[i] = static_cast<u32>(i);
+            m_keys[i]  = sortableKey(boxes[i].center.e[m_axis] - boxes[i].extents.e[m_axis]);
+        }
+    });
+
+    for (u32 pass{0u}; pass < radixPasses; ++pass)
+    {
+        const u32 shift{pass * radixBits};
+
+        std::fill(m_histograms.begin(), m_histograms.end(), 0u);
+
+        forEachChunk(jobs, chunks, count, [&](const u32 chunk, const size_t begin, const size_t end)
+        {
+            u32* histogram{m_histograms.data() + static_cast<size_t>(chunk) * radixSize};
+            for (size_t i{begin}; i < end; ++i)
+                ++histogram[(m_keys[i] >> shift) & (radixSize - 1u)];
+        });
+
+        // Exclusive prefix sum, digit-major then chunk order
+        u32 offset{0u};
+        for (u32 digit{0u}; digit < radixSize; ++digit)
+        {
+            for (u32 chunk{0u}; chunk < chunks; ++chunk)
+            {
+                u32& bucket{m_histograms[static_cast<size_t>(chunk) * radixSize + digit]};
+                const u32 size{bucket};
+
+                bucket  = offset;
+                offset += size;
+            }
+        }
+
+        forEachChunk(jobs, chunks, count, [&](const u32 chunk, const size_t begin, const size_t end)
+        {
+            u32* offsets{m_histograms.data() + static_cast<size_t>(chunk) * radixSize};
+            for (size_t i{begin}; i < end; ++i)
+            {
+                const u32 target{offsets[(m_keys[i] >> shift) & (radixSize - 1u)]++};
+
+                m_keysTemp[target]  = m_keys[i];
+                m_orderTemp[target] = m_order[i];
+            }
+        });
+
+        m_keys.swap(m_keysTemp);
+        m_order.swap(m_orderTemp);
+    }
+}
+
+
+
+
+/* =================== Sweep =================== */
+inline void SweepAndPrune::sweep(const size_t begin, const size_t end, std::vector<SweepAndPrunePair>& pairs) const
+{
+    const u32 axis1{(m_axis + 1u) % 3u};
+    const u32 axis2{(m_axis + 2u) % 3u};
+
+    const f32* sweepMin{m_min[m_axis].data()};
+    const f32* min1    {m_min[axis1].data()};
+    const f32* max1    {m_max[axis1].data()};
+    const f32* min2    {m_min[axis2].data()};
+    const f32* max2    {m_max[axis2].data()};
+
+    constexpr u32 allLanes{(1u << GPM_SIMD_WIDTH) - 1u};
+    const size_t  count   {m_order.size()};
+
+    for (size_t i{begin}; i < end; ++i)
+    {
+        const SIMD::f32v sweepEnd{SIMD::set1(m_max[m_axis][i])};
+        const SIMD::f32v boxMin1 {SIMD::set1(min1[i])};
+        const SIMD::f32v boxMax1 {SIMD::set1(max1[i])};
+        const SIMD::f32v boxMin2 {SIMD::set1(min2[i])};
+        const SIMD::f32v boxMax2 {SIMD::set1(max2[i])};
+
+        // The boxes after i that start before it ends, a register at a time:
+        // the mins are sorted, so the lanes in range are a prefix of the register
+        for (size_t j{i + 1u}; j < count; j += GPM_SIMD_WIDTH)
+        {
+            u32 inRange{SIMD::bits(SIMD::lessEqual(SIMD::loadu(sweepMin + j), sweepEnd))};
+            if (count - j < GPM_SIMD_WIDTH)
+                inRange &= (1u << (count - j)) - 1u;
+
+            const SIMD::maskv overlap1{SIMD::maskAnd(SIMD::lessEqual(SIMD::loadu(min1 + j), boxMax1),
+                                                     SIMD::lessEqual(boxMin1, SIMD::loadu(max1 + j)))};
+            const SIMD::maskv overlap2{SIMD::maskAnd(SIMD::lessEqual(SIMD::loadu(min2 + j), boxMax2),
+                                                     SIMD::lessEqual(boxMin2, SIMD::loadu(max2 + j)))};
+
+            for (u32 lanes{inRange & SIMD::bits(SIMD::maskAnd(overlap1, overlap2))}; lanes != 0u; lanes &= lanes - 1u)
+            {
+                u32 lane{0u};
+                while (((lanes >> lane) & 1u) == 0u)
+                    ++lane;
+
+                const u32 a{m_order[i]};
+                const u32 b{m_order[j + lane]};
+                pairs.push_back({std::min(a, b), std::max(a, b)});
+            }
+
+            if (inRange != allLanes)
+                break;
+        }
+    }
+}
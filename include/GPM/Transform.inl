@@ -97,9 +97,17 @@ inline constexpr Mat4 Transform::scaling(const Vec3& s) noexcept
 }
 
 
+// Same as translation(t) * rotation(r) * scaling(s), without the two products
 inline Mat4 Transform::TRS(const Vec3& t, const Vec3& r, const Vec3& s) noexcept
 {
-    return translation(t) * rotation(r) * scaling(s);
+    Mat4 trs{rotation(r)};
+
+    trs.c[0].xyz *= s.x;
+    trs.c[1].xyz *= s.y;
+    trs.c[2].xyz *= s.z;
+    trs.c[3].xyz  = t;
+
+    return trs;
 }
 
  
@@ -194,7 +202,7 @@ inline constexpr Transform::Transform(const Mat4& m) noexcept
 /* ================== Transform non-static methods ================== */
 inline Mat4 Transform::normalMat() const noexcept
 {
-    return model.cofactor();
+    return model.isAffine() ? model.cofactorAffine() : model.cofactor();
 }
 
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Matrix4.hpp"
+#include "Transform.hpp"
+#include "conversion.hpp"
+#include "JobSystem.hpp"
+
+namespace GPM
+{
+
+// Flat transform hierarchy. Nodes are identified by the stable handle returned
+// by addNode(), and stored in breadth-first order: a parent always comes before
+// its children, and the children of a node are contiguous. Local transforms are
+// SplitTransforms and world matrices are cached.
+//
+// updateWorld() sweeps the dirty nodes and their subtrees once, in increasing
+// storage order, so its cost is proportional to the number of nodes that
+// actually moved (directly or through an ancestor), not to the size of the scene.
+class TransformHierarchy
+{
+public:
+    static constexpr u32 invalidNode{~0u};
+
+protected:
+    // Indexed by storage (breadth-first) index
+    std::vector<SplitTransform> m_locals;
+    std::vector<Mat4>           m_worlds;
+    std::vector<u32>            m_parents;    // storage index of the parent, or invalidNode
+    std::vector<u32>            m_firstChild; // children of i are [m_firstChild[i], m_firstChild[i] + m_childCount[i])
+    std::vector<u32>            m_childCount;
+    std::vector<u32>            m_handleOf;
+    std::vector<u8>             m_isDirty;
+
+    // Nodes of depth d are [m_levelOffsets[d], m_levelOffsets[d + 1])
+    std::vector<u32>            m_levelOffsets;
+
+    // Indexed by handle
+    std::vector<u32>            m_indexOf;
+
+    // Storage indices whose local transform changed since the last update
+    std::vector<u32>            m_dirty;
+    bool                        m_needsSort{false};
+
+    // Scratch memory of updateWorld(), kept to avoid reallocating every frame
+    std::vector<u32>            m_pendingRanges;
+    std::vector<u32>            m_updateList;
+
+    void sortBreadthFirst();
+    void updateNode      (const u32 index) noexcept;
+
+public:
+    TransformHierarchy()                                                = default;
+    TransformHierarchy(const TransformHierarchy& other)                 = default;
+    TransformHierarchy(TransformHierarchy&& other)                      = default;
+    ~TransformHierarchy()                                               = default;
+    TransformHierarchy& operator=(TransformHierarchy const& other)      = default;
+    TransformHierarchy& operator=(TransformHierarchy&& other)           = default;
+
+    // Adding or reparenting nodes invalidates the breadth-first order: the
+    // hierarchy is re-sorted and fully recomputed by the next updateWorld().
+    // setParent() moves node with its subtree, parent must not be part of it.
+    u32                   addNode     (const SplitTransform& local,
+                                       const u32 parent = invalidNode);
+    void                  setParent   (const u32 node, const u32 parent);
+    void                  reserve     (const size_t count);
+
+    void                  setLocal    (const u32 node, const SplitTransform& local);
+    void                  markDirty   (const u32 node);
+    void                  updateWorld ();
+
+    // Same results as updateWorld(), with every depth level split across the threads of jobs
+    void                  updateWorld (JobSystem& jobs);
+
+    size_t                size        ()                  const noexcept { return m_locals.size(); }
+    const SplitTransform& getLocal    (const u32 node)    const noexcept { return m_locals[m_indexOf[node]]; }
+    const Mat4&           getWorld    (const u32 node)    const noexcept { return m_worlds[m_indexOf[node]]; }
+    u32                   getParent   (const u32 node)    const noexcept;
+    size_t                depthCount  ()                  const noexcept { return m_levelOffsets.empty() ? 0u : m_levelOffsets.size() - 1u; }
+
+    // Breadth-first storage, valid after updateWorld()
+    const Mat4*           worldMatrices()                 const noexcept { return m_worlds.data(); }
+    u32                   storageIndex(const u32 node)    const noexcept { return m_indexOf[node]; }
+    u32                   handleAt    (const u32 index)   const noexcept { return m_handleOf[index]; }
+};
+
+#include "TransformHierarchy.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,354 @@
+/* =================== Building =================== */
+inline u32 TransformHierarchy::addNode(const SplitTransform& local, const u32 parent)
+{
+    const u32 handle{static_cast<u32>(m_indexOf.size())};
+    const u32 index {static_cast<u32>(m_locals.size())};
+
+    m_locals    .push_back(local);
+    m_worlds    .push_back(Mat4::identity());
+    m_parents   .push_back(parent == invalidNode ? invalidNode : m_indexOf[parent]);
+    m_firstChild.push_back(0u);
+    m_childCount.push_back(0u);
+    m_handleOf  .push_back(handle);
+    m_isDirty   .push_back(0u);
+    m_indexOf   .push_back(index);
+
+    m_needsSort = true;
+
+    return handle;
+}
+
+
+inline void TransformHierarchy::setParent(const u32 node, const u32 parent)
+{
+    m_parents[m_indexOf[node]] = parent == invalidNode ? invalidNode : m_indexOf[parent];
+    m_needsSort                = true;
+}
+
+
+inline void TransformHierarchy::reserve(const size_t count)
+{
+    m_locals    .reserve(count);
+    m_worlds    .reserve(count);
+    m_parents   .reserve(count);
+    m_firstChild.reserve(count);
+    m_childCount.reserve(count);
+    m_handleOf  .reserve(count);
+    m_isDirty   .reserve(count);
+    m_indexOf   .reserve(count);
+}
+
+
+// Stable re-ordering into breadth-first order: roots first, in their current
+// order, then the children of each node appended as one contiguous range
+inline void TransformHierarchy::sortBreadthFirst()
+{
+    const u32 count{static_cast<u32>(m_locals.size())};
+
+    // Counting sort of the nodes by parent to get every children list
+    std::vector<u32> childOffsets(count + 1u, 0u);
+    for (u32 i{0u}; i < count; ++i)
+    {
+        if (m_parents[i] != invalidNode)
+            ++childOffsets[m_parents[i] + 1u];
+    }
+
+    for (u32 i{0u}; i < count; ++i)
+        childOffsets[i + 1u] += childOffsets[i];
+
+    std::vector<u32> children(childOffsets[count]);
+    {
+        std::vector<u32> cursor(childOffsets.begin(), childOffsets.end() - 1);
+        for (u32 i{0u}; i < count; ++i)
+        {
+            if (m_parents[i] != invalidNode)
+                children[cursor[m_parents[i]]++] = i;
+        }
+    }
+
+    // order[newIndex] = oldIndex
+    std::vector<u32> order;
+    order.reserve(count);
+    for (u32 i{0u}; i < count; ++i)
+    {
+        if (m_parents[i] == invalidNode)
+            order.push_back(i);
+    }
+
+    std::vector<u32> firstChild(count), childCount(count);
+    for (u32 head{0u}; head < order.size(); ++head)
+    {
+        const u32 old{order[head]};
+
+        firstChild[head] = static_cast<u32>(order.size());
+        childCount[head] = childOffsets[old + 1u] - childOffsets[old];
+        order.insert(order.end(), children.begin() + childOffsets[old], children.begin() + childOffsets[old + 1u]);
+    }
+
+    std::vector<u32> newIndexOf(count);
+    for (u32 i{0u}; i < count; ++i)
+        newIndexOf[order[i]] = i;
+
+    std::vector<SplitTransform> locals  (count);
+    std::vector<u32>            parents (count);
+    std::vector<u32>            handleOf(count);
+    std::vector<u32>            depths  (count);
+    m_levelOffsets.assign(1u, 0u);
+    for (u32 i{0u}; i < count; ++i)
+    {
+        const u32 old{order[i]};
+
+        locals  [i] = m_locals[old];
+        parents [i] = m_parents[old] == invalidNode ? invalidNode : newIndexOf[m_parents[old]];
+        handleOf[i] = m_handleOf[old];
+        depths  [i] = parents[i] == invalidNode ? 0u : depths[parents[i]] + 1u;
+        m_indexOf[handleOf[i]] = i;
+
+        // Depth never decreases in breadth-first order
+        if (depths[i] == m_levelOffsets.size())
+            m_levelOffsets.push_back(i);
+    }
+    if (count != 0u)
+        m_levelOffsets.push_back(count);
+
+    m_locals     = std::move(locals);
+    m_parents    = std::move(parents);
+    m_handleOf   = std::move(handleOf);
+    m_firstChild = std::move(firstChild);
+    m_childCount = std::move(childCount);
+}
+
+
+
+
+/* =================== Update =================== */
+inline void TransformHierarchy::setLocal(const u32 node, const SplitTransform& local)
+{
+    m_locals[m_indexOf[node]] = local;
+    markDirty(node);
+}
+
+
+inline void TransformHierarchy::markDirty(const u32 node)
+{
+    const u32 index{m_indexOf[node]};
+
+    if (m_isDirty[index])
+        return;
+
+    m_isDirty[index] = 1u;
+    m_dirty.push_back(index);
+}
+
+
+inline void TransformHierarchy::updateNode(const u32 index) noexcept
+{
+    const Mat4 local {toTransform(m_locals[index]).model};
+    const u32  parent{m_parents[index]};
+
+    m_worlds[index] = parent == invalidNode ? local : m_worlds[parent].multiplyAffine(local);
+}
+
+
+inline void TransformHierarchy::updateWorld()
+{
+    if (m_needsSort)
+    {
+        sortBreadthFirst();
+
+        for (u32 i{0u}; i < m_locals.size(); ++i)
+            updateNode(i);
+
+        std::fill(m_isDirty.begin(), m_isDirty.end(), u8{0u});
+        m_dirty.clear();
+        m_needsSort = false;
+        return;
+    }
+
+    if (m_dirty.empty())
+        return;
+
+    // Merge of two increasing sequences: the sorted dirty nodes, and the
+    // children ranges of the nodes updated so far. Ranges are queued in the
+    // order their parents are visited, which in breadth-first order is also
+    // increasing, so every node is visited once and after its parent.
+    std::sort(m_dirty.begin(), m_dirty.end());
+    m_pendingRanges.clear();
+
+    size_t nextDirty{0u};
+    size_t nextRange{0u};
+    u32    current  {0u};
+    u32    end      {0u};
+
+    for (;;)
+    {
+        while (current == end && nextRange < m_pendingRanges.size())
+        {
+            current    = m_pendingRanges[nextRange];
+            end        = m_pendingRanges[nextRange + 1u];
+            nextRange += 2u;
+        }
+
+        const bool hasChild{current != end};
+        const bool hasDirty{nextDirty < m_dirty.size()};
+
+        if (!hasChild && !hasDirty)
+            break;
+
+        u32 index;
+        if (hasDirty && (!hasChild || m_dirty[nextDirty] <= current))
+        {
+            index = m_dirty[nextDirty++];
+
+            // Dirty node that is also the child of an updated node
+            if (hasChild && index == current)
+                ++current;
+        }
+        else
+        {
+            index = current++;
+        }
+
+        m_isDirty[index] = 0u;
+        updateNode(index);
+
+        if (m_childCount[index] == 0u)
+            continue;
+
+        const u32 first{m_firstChild[index]};
+        const u32 last {first + m_childCount[index]};
+
+        // Siblings have adjacent children ranges: extend the last queued range when possible
+        if (nextRange < m_pendingRanges.size() && m_pendingRanges.back() == first)
+        {
+            m_pendingRanges.back() = last;
+        }
+        else if (nextRange == m_pendingRanges.size() && end == first)
+        {
+            end = last;
+        }
+        else
+        {
+            m_pendingRanges.push_back(first);
+            m_pendingRanges.push_back(last);
+        }
+    }
+
+    m_dirty.clear();
+}
+
+
+inline void TransformHierarchy::updateWorld(JobSystem& jobs)
+{
+    // Below this many nodes, a range isn't worth sending to another thread
+    constexpr u32 minRangeSize{256u};
+
+    if (m_needsSort)
+    {
+        sortBreadthFirst();
+
+        for (size_t level{0u}; level + 1u < m_levelOffsets.size(); ++level)
+        {
+            const u32 first{m_levelOffsets[level]};
+
+            jobs.parallelFor(m_levelOffsets[level + 1u] - first, minRangeSize, [this, first](const u32 begin, const u32 end)
+            {
+                for (u32 i{begin}; i < end; ++i)
+                    updateNode(first + i);
+            });
+        }
+
+        std::fill(m_isDirty.begin(), m_isDirty.end(), u8{0u});
+        m_dirty.clear();
+        m_needsSort = false;
+        return;
+    }
+
+    if (m_dirty.empty())
+        return;
+
+    // Same merge as the single-threaded update, done one depth level at a time:
+    // the nodes to update at depth d are the dirty nodes of depth d and the
+    // children of the nodes updated at depth d - 1. Each level is gathered
+    // into m_updateList, then updated in parallel.
+    std::sort(m_dirty.begin(), m_dirty.end());
+    m_updateList.clear();
+
+    size_t nextDirty {0u};
+    size_t prevBegin {0u};
+    size_t prevEnd   {0u};
+    size_t level     {0u};
+
+    for (;;)
+    {
+        // Nothing left to propagate: skip to the level of the next dirty node
+        if (prevBegin == prevEnd || level + 1u == m_levelOffsets.size())
+        {
+            if (nextDirty == m_dirty.size())
+                break;
+
+            level = static_cast<size_t>(std::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), m_dirty[nextDirty]) - m_levelOffsets.begin()) - 1u;
+        }
+
+        const u32    levelEnd{m_levelOffsets[level + 1u]};
+        const size_t begin   {m_updateList.size()};
+        size_t       parent  {prevBegin};
+        u32          current {0u};
+        u32          end     {0u};
+
+        for (;;)
+        {
+            while (current == end && parent < prevEnd)
+            {
+                const u32 index{m_updateList[parent++]};
+
+                current = m_firstChild[index];
+                end     = current + m_childCount[index];
+            }
+
+            const bool hasChild{current != end};
+            const bool hasDirty{nextDirty < m_dirty.size() && m_dirty[nextDirty] < levelEnd};
+
+            if (!hasChild && !hasDirty)
+                break;
+
+            u32 index;
+            if (hasDirty && (!hasChild || m_dirty[nextDirty] <= current))
+            {
+                index = m_dirty[nextDirty++];
+
+                if (hasChild && index == current)
+                    ++current;
+            }
+            else
+            {
+                index = current++;
+            }
+
+            m_isDirty[index] = 0u;
+            m_updateList.push_back(index);
+        }
+
+        const u32* nodes{m_updateList.data() + begin};
+
+        jobs.parallelFor(static_cast<u32>(m_updateList.size() - begin), minRangeSize, [this, nodes](const u32 first, const u32 last)
+        {
+            for (u32 i{first}; i < last; ++i)
+                updateNode(nodes[i]);
+        });
+
+        prevBegin = begin;
+        prevEnd   = m_updateList.size();
+        ++level;
+    }
+
+    m_dirty.clear();
+}
+
+
+inline u32 TransformHierarchy::getParent(const u32 node) const noexcept
+{
+    const u32 parent{m_parents[m_indexOf[node]]};
+
+    return parent == invalidNode ? invalidNode : m_handleOf[parent];
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "Types.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+namespace GPM
+{
+
+namespace VectorDetail
+{
+
+// Components of the generic vectors. Up to 4 dimensions, e is aliased by
+// x, y, z and w like in Vector2, Vector3 and Vector4.
+template<size_t N, typename T>
+struct Components
+{
+    T e[N];
+};
+
+template<typename T>
+struct Components<1u, T>
+{
+    union
+    {
+        T e[1];
+        struct { T x; };
+    };
+};
+
+template<typename T>
+struct Components<2u, T>
+{
+    union
+    {
+        T e[2];
+        struct { T x; T y; };
+    };
+};
+
+template<typename T>
+struct Components<3u, T>
+{
+    union
+    {
+        T e[3];
+        struct { T x; T y; T z; };
+    };
+};
+
+template<typename T>
+struct Components<4u, T>
+{
+    union
+    {
+        T e[4];
+        struct { T x; T y; T z; T w; };
+    };
+};
+
+} // End of namespace VectorDetail
+
+
+// Vector of any dimension and element type (f64, s32, ...), with constexpr kernels.
+// Vector<2u, f32>, Vector<3u, f32> and Vector<4u, f32> are specialised by
+// Vector2, Vector3 and Vector4 and their SIMD paths. Methods that need a square
+// root or a division by the length are only available for floating point elements.
+template<size_t N, typename T>
+struct Vector : VectorDetail::Components<N, T>
+{
+    static_assert(N > 0u, "A vector needs at least one component");
+
+    using VectorDetail::Components<N, T>::e;
+
+    // Constructors. The default constructor leaves the components uninitialized,
+    // like the single-precision vectors; Vector{} zeroes them.
+    Vector()                                                                = default;
+    explicit constexpr Vector(const T k)                                    noexcept;
+    template<typename... Args, typename = std::enable_if_t<(N > 1u) && sizeof...(Args) == N>>
+    constexpr Vector(const Args... coefs)                                   noexcept;
+    template<typename U>
+    explicit constexpr Vector(const U (&coefs)[N])                          noexcept;
+
+    // Static methods (pseudo-constructors)
+    static constexpr Vector zero            ()                              noexcept;
+    static constexpr Vector one             ()                              noexcept;
+    static constexpr Vector min             (const Vector& lhs,
+                                             const Vector& rhs)             noexcept;
+    static constexpr Vector max             (const Vector& lhs,
+                                             const Vector& rhs)             noexcept;
+
+    // Component access
+    constexpr T&        operator[]          (const size_t i)                noexcept       { return e[i]; }
+    constexpr const T&  operator[]          (const size_t i)                const noexcept { return e[i]; }
+
+    // Methods
+    template<typename U>
+    constexpr Vector<N, U> cast             ()                              const noexcept;
+    constexpr T         dot                 (const Vector& v)               const noexcept;
+    constexpr Vector    cross               (const Vector& v)               const noexcept;
+    constexpr T         sqrLength           ()                              const noexcept;
+    T                   length              ()                              const noexcept;
+    constexpr T         sqrDistanceTo       (const Vector& v)               const noexcept;
+    T                   distanceTo          (const Vector& v)               const noexcept;
+    Vector              normalized          ()                              const noexcept;
+    void                normalize           ()                              noexcept;
+    constexpr Vector    lerp                (const Vector& v, const T t)    const noexcept;
+    constexpr Vector    abs                 ()                              const noexcept;
+    constexpr bool      isNull              ()                              const noexcept;
+    bool                isEqualTo           (const Vector& v,
+                                             const T eps = T(1e-6))         const noexcept;
+
+    // Operator overloads
+    constexpr Vector&   operator+=          (const Vector& v)               noexcept;
+    constexpr Vector&   operator-=          (const Vector& v)               noexcept;
+    constexpr Vector&   operator*=          (const Vector& v)               noexcept;
+    constexpr Vector&   operator/=          (const Vector& v)               noexcept;
+    constexpr Vector&   operator*=          (const T k)                     noexcept;
+    constexpr Vector&   operator/=          (const T k)                     noexcept;
+    constexpr bool      operator==          (const Vector& v)               const noexcept;
+    constexpr bool      operator!=          (const Vector& v)               const noexcept;
+    constexpr Vector    operator+           (const Vector& v)               const noexcept;
+    constexpr Vector    operator-           (const Vector& v)               const noexcept;
+    constexpr Vector    operator*           (const Vector& v)               const noexcept;
+    constexpr Vector    operator/           (const Vector& v)               const noexcept;
+    constexpr Vector    operator-           ()                              const noexcept;
+    constexpr Vector    operator*           (const T k)                     const noexcept;
+    constexpr Vector    operator/           (const T k)                     const noexcept;
+};
+
+template<size_t N, typename T>
+constexpr Vector<N, T> operator*(const T k, const Vector<N, T>& v) noexcept;
+
+
+// Vec<3u, f32> is Vector3, so code written against Vec<N, T> or Vector<N, T>
+// also takes the single-precision vectors
+template<size_t N, typename T>
+using Vec = Vector<N, T>;
+
+using Vec2d = Vec<2u, f64>;
+using Vec3d = Vec<3u, f64>;
+using Vec4d = Vec<4u, f64>;
+using Vec2i = Vec<2u, s32>;
+using Vec3i = Vec<3u, s32>;
+using Vec4i = Vec<4u, s32>;
+
+#include "Vector.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,336 @@
+/* =================== Constructors =================== */
+template<size_t N, typename T>
+inline constexpr Vector<N, T>::Vector(const T k) noexcept
+    : VectorDetail::Components<N, T>{}
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] = k;
+}
+
+
+template<size_t N, typename T>
+template<typename... Args, typename>
+inline constexpr Vector<N, T>::Vector(const Args... coefs) noexcept
+    : VectorDetail::Components<N, T>{static_cast<T>(coefs)...}
+{}
+
+
+template<size_t N, typename T>
+template<typename U>
+inline constexpr Vector<N, T>::Vector(const U (&coefs)[N]) noexcept
+    : VectorDetail::Components<N, T>{}
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] = static_cast<T>(coefs[i]);
+}
+
+
+
+
+/* =================== Static methods =================== */
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::zero() noexcept
+{
+    return Vector{T(0)};
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::one() noexcept
+{
+    return Vector{T(1)};
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::min(const Vector& lhs, const Vector& rhs) noexcept
+{
+    Vector res{};
+    for (size_t i{0u}; i < N; ++i)
+        res.e[i] = rhs.e[i] < lhs.e[i] ? rhs.e[i] : lhs.e[i];
+
+    return res;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::max(const Vector& lhs, const Vector& rhs) noexcept
+{
+    Vector res{};
+    for (size_t i{0u}; i < N; ++i)
+        res.e[i] = lhs.e[i] < rhs.e[i] ? rhs.e[i] : lhs.e[i];
+
+    return res;
+}
+
+
+
+
+/* =================== Methods =================== */
+template<size_t N, typename T>
+template<typename U>
+inline constexpr Vector<N, U> Vector<N, T>::cast() const noexcept
+{
+    Vector<N, U> res{};
+    for (size_t i{0u}; i < N; ++i)
+        res.e[i] = static_cast<U>(e[i]);
+
+    return res;
+}
+
+
+template<size_t N, typename T>
+inline constexpr T Vector<N, T>::dot(const Vector& v) const noexcept
+{
+    T res{0};
+    for (size_t i{0u}; i < N; ++i)
+        res += e[i] * v.e[i];
+
+    return res;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::cross(const Vector& v) const noexcept
+{
+    static_assert(N == 3u, "The cross product is only defined in 3 dimensions");
+
+    return Vector{e[1] * v.e[2] - e[2] * v.e[1],
+                  e[2] * v.e[0] - e[0] * v.e[2],
+                  e[0] * v.e[1] - e[1] * v.e[0]};
+}
+
+
+template<size_t N, typename T>
+inline constexpr T Vector<N, T>::sqrLength() const noexcept
+{
+    return dot(*this);
+}
+
+
+template<size_t N, typename T>
+inline T Vector<N, T>::length() const noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "length() needs floating point components");
+    return std::sqrt(sqrLength());
+}
+
+
+template<size_t N, typename T>
+inline constexpr T Vector<N, T>::sqrDistanceTo(const Vector& v) const noexcept
+{
+    return (v - *this).sqrLength();
+}
+
+
+template<size_t N, typename T>
+inline T Vector<N, T>::distanceTo(const Vector& v) const noexcept
+{
+    return (v - *this).length();
+}
+
+
+template<size_t N, typename T>
+inline Vector<N, T> Vector<N, T>::normalized() const noexcept
+{
+    return *this / length();
+}
+
+
+template<size_t N, typename T>
+inline void Vector<N, T>::normalize() noexcept
+{
+    *this /= length();
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::lerp(const Vector& v, const T t) const noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "lerp() needs floating point components");
+    return *this + (v - *this) * t;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::abs() const noexcept
+{
+    Vector res{};
+    for (size_t i{0u}; i < N; ++i)
+        res.e[i] = e[i] < T(0) ? -e[i] : e[i];
+
+    return res;
+}
+
+
+template<size_t N, typename T>
+inline constexpr bool Vector<N, T>::isNull() const noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+    {
+        if (e[i] != T(0))
+            return false;
+    }
+
+    return true;
+}
+
+
+template<size_t N, typename T>
+inline bool Vector<N, T>::isEqualTo(const Vector& v, const T eps) const noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+    {
+        if (std::abs(e[i] - v.e[i]) > eps)
+            return false;
+    }
+
+    return true;
+}
+
+
+
+
+/* =================== Operator overloads =================== */
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator+=(const Vector& v) noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] += v.e[i];
+
+    return *this;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator-=(const Vector& v) noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] -= v.e[i];
+
+    return *this;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator*=(const Vector& v) noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] *= v.e[i];
+
+    return *this;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator/=(const Vector& v) noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] /= v.e[i];
+
+    return *this;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator*=(const T k) noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+        e[i] *= k;
+
+    return *this;
+}
+
+
+// Integer vectors divide component-wise, floating point ones multiply by the inverse
+template<size_t N, typename T>
+inline constexpr Vector<N, T>& Vector<N, T>::operator/=(const T k) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return *this *= T(1) / k;
+
+    for (size_t i{0u}; i < N; ++i)
+        e[i] /= k;
+
+    return *this;
+}
+
+
+template<size_t N, typename T>
+inline constexpr bool Vector<N, T>::operator==(const Vector& v) const noexcept
+{
+    for (size_t i{0u}; i < N; ++i)
+    {
+        if (e[i] != v.e[i])
+            return false;
+    }
+
+    return true;
+}
+
+
+template<size_t N, typename T>
+inline constexpr bool Vector<N, T>::operator!=(const Vector& v) const noexcept
+{
+    return !(*this == v);
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator+(const Vector& v) const noexcept
+{
+    return Vector{*this} += v;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator-(const Vector& v) const noexcept
+{
+    return Vector{*this} -= v;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator*(const Vector& v) const noexcept
+{
+    return Vector{*this} *= v;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator/(const Vector& v) const noexcept
+{
+    return Vector{*this} /= v;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator-() const noexcept
+{
+    Vector res{};
+    for (size_t i{0u}; i < N; ++i)
+        res.e[i] = -e[i];
+
+    return res;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator*(const T k) const noexcept
+{
+    return Vector{*this} *= k;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> Vector<N, T>::operator/(const T k) const noexcept
+{
+    return Vector{*this} /= k;
+}
+
+
+template<size_t N, typename T>
+inline constexpr Vector<N, T> operator*(const T k, const Vector<N, T>& v) noexcept
+{
+    return v * k;
+}
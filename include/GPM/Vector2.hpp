@@ -14,16 +14,22 @@
 namespace GPM
 {
 
-union Vector2
+using Vector2 = Vector<2u, f32>;
+
+template<>
+struct Vector<2u, f32>
 {
     // Data members
-    struct { f32 x; f32 y; };
-    f32 e[2];
+    union
+    {
+        struct { f32 x; f32 y; };
+        f32 e[2];
+    };
 
-    Vector2() = default;
-    constexpr Vector2(const f32 k)                              noexcept;
-    constexpr Vector2(const f32 x, const f32 y = .0f)           noexcept;
-    constexpr Vector2(const f32 coef[2])                        noexcept;
+    Vector() = default;
+    constexpr Vector(const f32 k)                               noexcept;
+    constexpr Vector(const f32 x, const f32 y = .0f)            noexcept;
+    constexpr Vector(const f32 coef[2])                         noexcept;
     
     // Static methods (pseudo-constructors)
     static constexpr Vector2 zero   ()                          noexcept;
@@ -14,7 +14,10 @@
 namespace GPM
 {
 
-union Vector3
+using Vector3 = Vector<3u, f32>;
+
+template<>
+struct Vector<3u, f32>
 {
     // Data members. The following data members can be accessed publicly:
     // - Vec2 xy
@@ -22,25 +25,28 @@ union Vector3
     // - f32 y, which is the same as xy.y
     // - f32 z
     // - f32 e[3], which is the same as {x, y, z}
-    struct
+    union
     {
-        union
+        struct
         {
-            Vec2 xy;
-            struct { f32 x; f32 y; };
+            union
+            {
+                Vec2 xy;
+                struct { f32 x; f32 y; };
+            };
+
+            f32 z;
         };
-        
-        f32 z;
-    };
 
-    f32 e[3];
+        f32 e[3];
+    };
 
     // Constructors
-    Vector3() = default;
-    constexpr Vector3(const f32 k)                                          noexcept;
-    constexpr Vector3(const f32 x, const f32 y, const f32 z = .0f)          noexcept;
-    constexpr Vector3(const Vec2 v, const f32 z = .0f)                      noexcept;
-    constexpr Vector3(const f32 coef[3])                                    noexcept;
+    Vector() = default;
+    constexpr Vector(const f32 k)                                           noexcept;
+    constexpr Vector(const f32 x, const f32 y, const f32 z = .0f)           noexcept;
+    constexpr Vector(const Vec2 v, const f32 z = .0f)                       noexcept;
+    constexpr Vector(const f32 coef[3])                                     noexcept;
 
     // Static methods (pseudo-constructors)
     static constexpr Vector3 zero           ()                              noexcept;
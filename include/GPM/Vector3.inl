@@ -1,20 +1,20 @@
 /* =================== Constructors =================== */
-inline constexpr Vector3::Vector3(const f32 k) noexcept
+inline constexpr Vector3::Vector(const f32 k) noexcept
     : x{k}, y{k}, z{k}
 {}
 
 
-inline constexpr Vector3::Vector3(const f32 x_, const f32 y_, const f32 z_) noexcept
+inline constexpr Vector3::Vector(const f32 x_, const f32 y_, const f32 z_) noexcept
     : x{x_}, y{y_}, z{z_}
 {}
 
 
-inline constexpr Vector3::Vector3(const Vec2 v, const f32 z_) noexcept
+inline constexpr Vector3::Vector(const Vec2 v, const f32 z_) noexcept
     : xy{v}, z{z_}
 {}
 
 
-inline constexpr Vector3::Vector3(const f32 coef[3]) noexcept
+inline constexpr Vector3::Vector(const f32 coef[3]) noexcept
     : e{coef[0], coef[1], coef[2]}
 {}
 
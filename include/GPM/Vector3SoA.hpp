@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2021 Amara Sami, Dallard Thomas, Nardone William, Six Jonathan
+ * This file is subject to the LGNU license terms in the LICENSE file
+ * found in the top-level directory of this distribution.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+#include "SIMD.hpp"
+#include "SoAStorage.hpp"
+
+namespace GPM
+{
+
+// Structure-of-arrays stream of Vector3: the x, y and z components live in
+// three separate arrays, each aligned to GPM_SIMD_ALIGNMENT and padded to a
+// multiple of the SIMD width, so that the batched kernels only do aligned
+// full-width loads with no shuffles.
+class Vector3SoA : public SoAStorage<3u>
+{
+public:
+    // Constructors
+    Vector3SoA()                                                            = default;
+    explicit Vector3SoA(const size_t count);
+    Vector3SoA(const Vec3* values, const size_t count);
+
+    // Storage
+    f32*        x           ()                                              noexcept       { return component(0u); }
+    f32*        y           ()                                              noexcept       { return component(1u); }
+    f32*        z           ()                                              noexcept       { return component(2u); }
+    const f32*  x           ()                                              const noexcept { return component(0u); }
+    const f32*  y           ()                                              const noexcept { return component(1u); }
+    const f32*  z           ()                                              const noexcept { return component(2u); }
+
+    void        resize      (const size_t count);
+    void        pushBack    (const Vec3& v);
+
+    // Element access and conversion from/to arrays of Vector3
+    Vec3        get         (const size_t i)                                const noexcept;
+    void        set         (const size_t i, const Vec3& v)                 noexcept;
+    void        assign      (const Vec3* values, const size_t count);
+    void        copyTo      (Vec3* out)                                     const noexcept;
+
+    // Batched kernels. They apply the Vector3 method of the same name to every
+    // element: arrays passed as out must hold size() floats, SoA arguments must
+    // hold at least size() elements and SoA results are resized to size().
+    void        sqrLength   (f32* out)                                      const noexcept;
+    void        length      (f32* out)                                      const noexcept;
+    void        dot         (const Vector3SoA& v, f32* out)                 const noexcept;
+    void        dot         (const Vec3& v, f32* out)                       const noexcept;
+    void        cross       (const Vector3SoA& v, Vector3SoA& out)          const;
+    void        sqrDistanceTo(const Vector3SoA& v, f32* out)                const noexcept;
+    void        distanceTo  (const Vector3SoA& v, f32* out)                 const noexcept;
+    void        distanceTo  (const Vec3& v, f32* out)                       const noexcept;
+    void        normalize   ()                                              noexcept;
+    void        lerp        (const Vector3SoA& v, const f32 t,
+                             Vector3SoA& out)                               const;
+};
+
+using Vec3SoA = Vector3SoA;
+
+// SoA versions of transformPoints() and transformDirections() declared in Matrix4.hpp.
+// out is resized to in.size() and may be the same stream as in.
+void transformPoints    (const Matrix4& m, const Vector3SoA& in, Vector3SoA& out);
+void transformDirections(const Matrix4& m, const Vector3SoA& in, Vector3SoA& out);
+
+#include "Vector3SoA.inl"
+
+} // End of namespace GPM
@@ -0,0 +1,323 @@
+/* =================== Constructors =================== */
+inline Vector3SoA::Vector3SoA(const size_t count)
+{
+    resize(count);
+}
+
+
+inline Vector3SoA::Vector3SoA(const Vec3* values, const size_t count)
+{
+    assign(values, count);
+}
+
+
+
+
+/* =================== Storage =================== */
+inline void Vector3SoA::resize(const size_t count)
+{
+    SoAStorage::resize(count, {.0f, .0f, .0f});
+}
+
+
+inline void Vector3SoA::pushBack(const Vec3& v)
+{
+    grow();
+    set(m_size++, v);
+}
+
+
+
+
+/* =================== Element access =================== */
+inline Vec3 Vector3SoA::get(const size_t i) const noexcept
+{
+    return {x()[i], y()[i], z()[i]};
+}
+
+
+inline void Vector3SoA::set(const size_t i, const Vec3& v) noexcept
+{
+    x()[i] = v.x;
+    y()[i] = v.y;
+    z()[i] = v.z;
+}
+
+
+inline void Vector3SoA::assign(const Vec3* values, const size_t count)
+{
+    m_size = 0u;
+    reserve(count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        set(i, values[i]);
+    }
+
+    m_size = count;
+}
+
+
+inline void Vector3SoA::copyTo(Vec3* out) const noexcept
+{
+    for (size_t i{0u}; i < m_size; ++i)
+    {
+        out[i] = get(i);
+    }
+}
+
+
+
+
+/* =================== Batched kernels =================== */
+// Every kernel processes whole registers with aligned loads from the
+// component arrays, then finishes the last size() % GPM_SIMD_WIDTH elements
+// with the scalar Vector3 method.
+inline void Vector3SoA::sqrLength(f32* out) const noexcept
+{
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v vx{SIMD::load(x() + i)}, vy{SIMD::load(y() + i)}, vz{SIMD::load(z() + i)};
+        SIMD::storeu(out + i, SIMD::mulAdd(vx, vx, SIMD::mulAdd(vy, vy, SIMD::mul(vz, vz))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).sqrLength();
+    }
+}
+
+
+inline void Vector3SoA::length(f32* out) const noexcept
+{
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v vx{SIMD::load(x() + i)}, vy{SIMD::load(y() + i)}, vz{SIMD::load(z() + i)};
+        SIMD::storeu(out + i, SIMD::sqrt(SIMD::mulAdd(vx, vx, SIMD::mulAdd(vy, vy, SIMD::mul(vz, vz)))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).length();
+    }
+}
+
+
+inline void Vector3SoA::dot(const Vector3SoA& v, f32* out) const noexcept
+{
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        SIMD::storeu(out + i, SIMD::mulAdd(SIMD::load(x() + i), SIMD::load(v.x() + i),
+                              SIMD::mulAdd(SIMD::load(y() + i), SIMD::load(v.y() + i),
+                              SIMD::mul   (SIMD::load(z() + i), SIMD::load(v.z() + i)))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).dot(v.get(i));
+    }
+}
+
+
+inline void Vector3SoA::dot(const Vec3& v, f32* out) const noexcept
+{
+    const SIMD::f32v vx{SIMD::set1(v.x)}, vy{SIMD::set1(v.y)}, vz{SIMD::set1(v.z)};
+    size_t           i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        SIMD::storeu(out + i, SIMD::mulAdd(SIMD::load(x() + i), vx,
+                              SIMD::mulAdd(SIMD::load(y() + i), vy,
+                              SIMD::mul   (SIMD::load(z() + i), vz))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).dot(v);
+    }
+}
+
+
+inline void Vector3SoA::cross(const Vector3SoA& v, Vector3SoA& out) const
+{
+    out.resize(m_size);
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v ax{SIMD::load(x() + i)},   ay{SIMD::load(y() + i)},   az{SIMD::load(z() + i)},
+                         bx{SIMD::load(v.x() + i)}, by{SIMD::load(v.y() + i)}, bz{SIMD::load(v.z() + i)};
+
+        SIMD::store(out.x() + i, SIMD::sub(SIMD::mul(bz, ay), SIMD::mul(az, by)));
+        SIMD::store(out.y() + i, SIMD::sub(SIMD::mul(bx, az), SIMD::mul(ax, bz)));
+        SIMD::store(out.z() + i, SIMD::sub(SIMD::mul(by, ax), SIMD::mul(ay, bx)));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out.set(i, get(i).cross(v.get(i)));
+    }
+}
+
+
+inline void Vector3SoA::sqrDistanceTo(const Vector3SoA& v, f32* out) const noexcept
+{
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v dx{SIMD::sub(SIMD::load(x() + i), SIMD::load(v.x() + i))},
+                         dy{SIMD::sub(SIMD::load(y() + i), SIMD::load(v.y() + i))},
+                         dz{SIMD::sub(SIMD::load(z() + i), SIMD::load(v.z() + i))};
+
+        SIMD::storeu(out + i, SIMD::mulAdd(dx, dx, SIMD::mulAdd(dy, dy, SIMD::mul(dz, dz))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).sqrDistanceTo(v.get(i));
+    }
+}
+
+
+inline void Vector3SoA::distanceTo(const Vector3SoA& v, f32* out) const noexcept
+{
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v dx{SIMD::sub(SIMD::load(x() + i), SIMD::load(v.x() + i))},
+                         dy{SIMD::sub(SIMD::load(y() + i), SIMD::load(v.y() + i))},
+                         dz{SIMD::sub(SIMD::load(z() + i), SIMD::load(v.z() + i))};
+
+        SIMD::storeu(out + i, SIMD::sqrt(SIMD::mulAdd(dx, dx, SIMD::mulAdd(dy, dy, SIMD::mul(dz, dz)))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).distanceTo(v.get(i));
+    }
+}
+
+
+inline void Vector3SoA::distanceTo(const Vec3& v, f32* out) const noexcept
+{
+    const SIMD::f32v vx{SIMD::set1(v.x)}, vy{SIMD::set1(v.y)}, vz{SIMD::set1(v.z)};
+    size_t           i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v dx{SIMD::sub(SIMD::load(x() + i), vx)},
+                         dy{SIMD::sub(SIMD::load(y() + i), vy)},
+                         dz{SIMD::sub(SIMD::load(z() + i), vz)};
+
+        SIMD::storeu(out + i, SIMD::sqrt(SIMD::mulAdd(dx, dx, SIMD::mulAdd(dy, dy, SIMD::mul(dz, dz)))));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out[i] = get(i).distanceTo(v);
+    }
+}
+
+
+inline void Vector3SoA::normalize() noexcept
+{
+    const SIMD::f32v one{SIMD::set1(1.f)};
+    size_t           i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v vx{SIMD::load(x() + i)}, vy{SIMD::load(y() + i)}, vz{SIMD::load(z() + i)};
+        const SIMD::f32v reciprocal{SIMD::div(one, SIMD::sqrt(SIMD::mulAdd(vx, vx, SIMD::mulAdd(vy, vy, SIMD::mul(vz, vz)))))};
+
+        SIMD::store(x() + i, SIMD::mul(vx, reciprocal));
+        SIMD::store(y() + i, SIMD::mul(vy, reciprocal));
+        SIMD::store(z() + i, SIMD::mul(vz, reciprocal));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        set(i, get(i).normalized());
+    }
+}
+
+
+inline void Vector3SoA::lerp(const Vector3SoA& v, const f32 t, Vector3SoA& out) const
+{
+    out.resize(m_size);
+
+    const SIMD::f32v vt{SIMD::set1(t)}, tmp{SIMD::set1(1.f - t)};
+    size_t           i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= m_size; i += GPM_SIMD_WIDTH)
+    {
+        SIMD::store(out.x() + i, SIMD::mulAdd(SIMD::load(x() + i), tmp, SIMD::mul(SIMD::load(v.x() + i), vt)));
+        SIMD::store(out.y() + i, SIMD::mulAdd(SIMD::load(y() + i), tmp, SIMD::mul(SIMD::load(v.y() + i), vt)));
+        SIMD::store(out.z() + i, SIMD::mulAdd(SIMD::load(z() + i), tmp, SIMD::mul(SIMD::load(v.z() + i), vt)));
+    }
+
+    for (; i < m_size; ++i)
+    {
+        out.set(i, get(i).lerp(v.get(i), t));
+    }
+}
+
+
+
+
+/* =================== Batched transforms =================== */
+namespace SoA
+{
+
+// The matrix coefficients are broadcast once, then each register of the
+// stream costs 9 multiply-adds with no shuffle at all
+template<bool IsPoint>
+inline void transform(const Matrix4& m, const Vector3SoA& in, Vector3SoA& out)
+{
+    const size_t count{in.size()};
+    out.resize(count);
+
+    const SIMD::f32v m0{SIMD::set1(m.e[0])}, m1{SIMD::set1(m.e[1])}, m2 {SIMD::set1(m.e[2])},
+                     m4{SIMD::set1(m.e[4])}, m5{SIMD::set1(m.e[5])}, m6 {SIMD::set1(m.e[6])},
+                     m8{SIMD::set1(m.e[8])}, m9{SIMD::set1(m.e[9])}, m10{SIMD::set1(m.e[10])},
+                     tx{SIMD::set1(IsPoint ? m.e[12] : .0f)},
+                     ty{SIMD::set1(IsPoint ? m.e[13] : .0f)},
+                     tz{SIMD::set1(IsPoint ? m.e[14] : .0f)};
+
+    size_t i{0u};
+
+    for (; i + GPM_SIMD_WIDTH <= count; i += GPM_SIMD_WIDTH)
+    {
+        const SIMD::f32v x{SIMD::load(in.x() + i)}, y{SIMD::load(in.y() + i)}, z{SIMD::load(in.z() + i)};
+
+        SIMD::store(out.x() + i, SIMD::mulAdd(m0, x, SIMD::mulAdd(m4, y, SIMD::mulAdd(m8,  z, tx))));
+        SIMD::store(out.y() + i, SIMD::mulAdd(m1, x, SIMD::mulAdd(m5, y, SIMD::mulAdd(m9,  z, ty))));
+        SIMD::store(out.z() + i, SIMD::mulAdd(m2, x, SIMD::mulAdd(m6, y, SIMD::mulAdd(m10, z, tz))));
+    }
+
+    for (; i < count; ++i)
+    {
+        out.set(i, (m * Vec4{in.get(i), IsPoint ? 1.f : .0f}).xyz);
+    }
+}
+
+} // End of namespace SoA
+
+
+inline void transformPoints(const Matrix4& m, const Vector3SoA& in, Vector3SoA& out)
+{
+    SoA::transform<true>(m, in, out);
+}
+
+
+inline void transformDirections(const Matrix4& m, const Vector3SoA& in, Vector3SoA& out)
+{
+    SoA::transform<false>(m, in, out);
+}
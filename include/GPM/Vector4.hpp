@@ -14,7 +14,10 @@
 namespace GPM
 {
 
-union alignas(16) Vector4
+using Vector4 = Vector<4u, f32>;
+
+template<>
+struct alignas(16) Vector<4u, f32>
 {
     // Data members. The following data members can be accessed publicly:
     // - Vec2 xyz, which is the same as {x, y, z}
@@ -23,35 +26,38 @@ union alignas(16) Vector4
     // - f32 z, which is the same as xyz.z or xy.z
     // - f32 w
     // - f32 e[4], which is the same as {x, y, z, w}
-    struct
+    union
     {
-        union 
+        struct
         {
-            Vec3 xyz;
-
-            struct
+            union
             {
-                union
+                Vec3 xyz;
+
+                struct
                 {
-                    Vec2 xy;
-                    struct { f32 x; f32 y; };
-                };
+                    union
+                    {
+                        Vec2 xy;
+                        struct { f32 x; f32 y; };
+                    };
 
-                f32 z;
+                    f32 z;
+                };
             };
+
+            f32 w;
         };
 
-        f32 w;
+        f32 e[4];
     };
 
-    f32 e[4];
-
-    Vector4() noexcept = default;
-    constexpr Vector4(const f32 k)                                              noexcept;
-    constexpr Vector4(const f32 x, const f32 y, const f32 z, const f32 w = 1.f) noexcept;
-    constexpr Vector4(const Vec2& v, const f32 z = .0f, const f32 w = 1.f)      noexcept;
-    constexpr Vector4(const Vec3& v, const f32 w = 1.f)                         noexcept;
-    constexpr Vector4(const f32 coef[4])                                        noexcept;
+    Vector() noexcept = default;
+    constexpr Vector(const f32 k)                                               noexcept;
+    constexpr Vector(const f32 x, const f32 y, const f32 z, const f32 w = 1.f)  noexcept;
+    constexpr Vector(const Vec2& v, const f32 z = .0f, const f32 w = 1.f)       noexcept;
+    constexpr Vector(const Vec3& v, const f32 w = 1.f)                          noexcept;
+    constexpr Vector(const f32 coef[4])                                         noexcept;
 
     // Methods
     inline constexpr f32       sqrLength           ()                              const noexcept;
@@ -102,11 +102,13 @@ inline SplitTransform toSplitTransform(const Transform& transfo) noexcept
 
 inline Transform toTransform(const SplitTransform& transfo) noexcept
 {
-    return
-    {
-        Transform::translation(transfo.position) *
-        toMatrix4(transfo.rotation) *
-        Transform::scaling(transfo.scale)
-    };
+    Mat4 model{toMatrix4(transfo.rotation)};
+
+    model.c[0].xyz *= transfo.scale.x;
+    model.c[1].xyz *= transfo.scale.y;
+    model.c[2].xyz *= transfo.scale.z;
+    model.c[3].xyz  = transfo.position;
+
+    return {model};
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace GPM
@@ -22,10 +23,20 @@ using s64  = std::int64_t;
 using s32f = std::int_fast32_t;
 using u32f = std::uint_fast32_t;
 using f32  = float;
+using f64  = double;
 union f32u
 {
     f32 f;
     s32 bits;
 };
 
+// Vectors and matrices of any size and element type, defined in Vector.hpp and
+// Matrix.hpp. Vector2, Vector3, Vector4, Matrix3 and Matrix4 are their
+// single-precision specialisations.
+template<size_t N, typename T>
+struct Vector;
+
+template<size_t R, size_t C, typename T>
+struct Matrix;
+
 } // End of namespace GPM
\ No newline at end of file
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <math.h>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/Calc.hpp"
+
+namespace GPM
+{
+
+// Largest errors of a function against its double precision reference
+struct MaxError
+{
+    f64 ulp     {.0};
+    f64 absolute{.0};
+    f64 relative{.0};
+
+    void add(const f32 value, const f64 reference)
+    {
+        const f64 error   {fabs(static_cast<f64>(value) - reference)};
+        const f32 rounded {fmaxf(fabsf(static_cast<f32>(reference)), FLT_MIN)};
+        const f64 ulpValue{static_cast<f64>(nextafterf(rounded, INFINITY)) - rounded};
+
+        ulp      = fmax(ulp, error / ulpValue);
+        absolute = fmax(absolute, error);
+        if (reference != .0)
+            relative = fmax(relative, error / fabs(reference));
+    }
+};
+
+
+// Maximum errors over the domains, against the table of Calc.hpp
+template<EPrecision P>
+void testMathAccuracy(const bool precise)
+{
+    MaxError sinSmall, sinCos, acos, atan2, exp, log, rsqrt;
+
+    for (f64 x{-8192.}; x <= 8192.; x += .0371)
+    {
+        const f32 f{static_cast<f32>(x)};
+        f32       s, c;
+        Math::sincos<P>(f, s, c);
+
+        sinCos.add(Math::sin<P>(f), sin(static_cast<f64>(f)));
+        sinCos.add(Math::cos<P>(f), cos(static_cast<f64>(f)));
+        sinCos.add(s, sin(static_cast<f64>(f)));
+        sinCos.add(c, cos(static_cast<f64>(f)));
+
+        if (fabsf(f) < 4.f)
+            sinSmall.add(Math::sin<P>(f), sin(static_cast<f64>(f)));
+    }
+
+    for (f64 x{-1.}; x <= 1.; x += 1e-5)
+        acos.add(Math::acos<P>(static_cast<f32>(x)), ::acos(static_cast<f64>(static_cast<f32>(x))));
+
+    for (f64 angle{-3.2}; angle < 3.2; angle += 1e-3)
+    {
+        for (const f64 radius : {1e-3, 1., 1e4})
+        {
+            const f32 y{static_cast<f32>(radius * sin(angle))};
+            const f32 x{static_cast<f32>(radius * cos(angle))};
+            atan2.add(Math::atan2<P>(y, x), ::atan2(static_cast<f64>(y), static_cast<f64>(x)));
+        }
+    }
+
+    for (f64 x{-87.}; x <= 88.7; x += 1e-3)
+        exp.add(Math::exp<P>(static_cast<f32>(x)), ::exp(static_cast<f64>(static_cast<f32>(x))));
+
+    for (s32 exponent{-126}; exponent < 128; ++exponent)
+    {
+        for (s32 i{0}; i < 1000; ++i)
+        {
+            const f32 x{ldexpf(1.f + static_cast<f32>(i) / 1000.f, exponent)};
+            log.add(Math::log<P>(x), ::log(static_cast<f64>(x)));
+            rsqrt.add(Math::rsqrt<P>(x), 1. / sqrt(static_cast<f64>(x)));
+        }
+    }
+
+    if (precise)
+    {
+        TEST("Math::sin/cos/sincos<Precise>: 1.5 ulp for |x| < 4, 1e-7 absolute",
+             sinSmall.ulp <= 1.5 && sinCos.absolute <= 1e-7);
+        TEST("Math::acos<Precise>: 1.5 ulp",  acos.ulp  <= 1.5);
+        TEST("Math::atan2<Precise>: 3.5 ulp", atan2.ulp <= 3.5);
+        TEST("Math::exp<Precise>: 1.5 ulp",   exp.ulp   <= 1.5);
+        TEST("Math::log<Precise>: 1 ulp",     log.ulp   <= 1.);
+        TEST("Math::rsqrt<Precise>: 1.5 ulp", rsqrt.ulp <= 1.5);
+    }
+    else
+    {
+        TEST("Math::sin/cos/sincos<Fast>: 1.5e-6 absolute",        sinCos.absolute <= 1.5e-6);
+        TEST("Math::acos<Fast>: 7e-5 absolute",                     acos.absolute   <= 7e-5);
+        TEST("Math::atan2<Fast>: 1.2e-5 absolute",                  atan2.absolute  <= 1.2e-5);
+        TEST("Math::exp<Fast>: 6e-6 relative",                      exp.relative    <= 6e-6);
+        TEST("Math::log<Fast>: 1.3e-5 relative, 1.2e-5 absolute",   log.relative    <= 1.3e-5 && log.absolute <= 1.2e-5);
+        TEST("Math::rsqrt<Fast>: 5e-6 relative",                    rsqrt.relative  <= 5e-6);
+    }
+}
+
+
+// The batched versions agree with the scalar ones, remainder included. Compilers
+// may contract the scalar lanes into FMAs differently, hence the 2 ulp tolerance,
+// counted on the floats ordered as integers so that it holds near zero as well.
+bool nearlyEqual(const f32 a, const f32 b)
+{
+    const auto ordered = [](const f32 f)
+    {
+        const s64 bits{f32u{f}.bits};
+        return bits < 0 ? INT32_MIN - bits : bits;
+    };
+
+    const s64 distance{ordered(a) - ordered(b)};
+    return distance >= -2 && distance <= 2;
+}
+
+
+template<EPrecision P>
+bool mathBatchedMatchesScalar()
+{
+    constexpr size_t count{37u};
+
+    f32 in[count], positive[count], unit[count], out[count], outCos[count];
+    for (size_t i{0u}; i < count; ++i)
+    {
+        in[i]       = randomf32(-10.f, 10.f);
+        positive[i] = randomf32(1e-3f, 1e3f);
+        unit[i]     = randomf32(-1.f, 1.f);
+    }
+
+    bool equal{true};
+
+    Math::sin<P>(in, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::sin<P>(in[i]));
+
+    Math::cos<P>(in, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::cos<P>(in[i]));
+
+    Math::sincos<P>(in, out, outCos, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::sin<P>(in[i])) && nearlyEqual(outCos[i], Math::cos<P>(in[i]));
+
+    Math::acos<P>(unit, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::acos<P>(unit[i]));
+
+    Math::atan2<P>(in, positive, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::atan2<P>(in[i], positive[i]));
+
+    Math::exp<P>(in, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::exp<P>(in[i]));
+
+    Math::log<P>(positive, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::log<P>(positive[i]));
+
+    Math::rsqrt<P>(positive, out, count);
+    for (size_t i{0u}; i < count; ++i)
+        equal = equal && nearlyEqual(out[i], Math::rsqrt<P>(positive[i]));
+
+    return equal;
+}
+
+
+void testMath()
+{
+    fprintf(stderr, "\nMath functions unit tests:\n");
+
+    testMathAccuracy<EPrecision::Precise>(true);
+    testMathAccuracy<EPrecision::Fast>(false);
+
+    TEST("Math batched functions, Precise", mathBatchedMatchesScalar<EPrecision::Precise>());
+    TEST("Math batched functions, Fast",    mathBatchedMatchesScalar<EPrecision::Fast>());
+
+    TEST("Math special values",
+         Math::log(.0f) == -INFINITY && Math::log(-1.f) != Math::log(-1.f) &&
+         Math::exp(-200.f) == .0f && Math::exp(200.f) == INFINITY &&
+         Math::atan2(.0f, .0f) == .0f && f32AreEqual(Math::acos(2.f), .0f));
+}
+
+} // End of namespace GPM
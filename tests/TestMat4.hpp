@@ -2,6 +2,7 @@
 
 #include "TestingTools.hpp"
 #include "../include/GPM/Matrix4.hpp"
+#include "../include/GPM/Matrix.hpp"
 #include "../include/GPM/Calc.hpp"
 #include "../include/GPM/DebugOutput.hpp"
 
@@ -23,6 +24,122 @@ void testMat4Methods()
     
     TEST("Matrix4::inversed() and Matrix4::operator*(const Matrix4& m)",
          (m1.inversed() * m1).isEqualTo(m1 * m1.inversed(), 1e-3));
+
+    // Diagonally dominant, hence well-conditioned: both products are the identity
+    bool inverses{true};
+    for (u32 i{0u}; i < 100u; ++i)
+    {
+        Mat4 m{randomMatrix4(-1.f, 1.f)};
+        for (u32 d{0u}; d < 4u; ++d)
+            m.e[d * 5u] += randomf32(0.f, 1.f) < .5f ? -5.f : 5.f;
+
+        const Mat4 inv{m.inversed()};
+        inverses = inverses && (m * inv).isEqualTo(Mat4::identity(), 1e-5f) &&
+                               (inv * m).isEqualTo(Mat4::identity(), 1e-5f);
+    }
+    TEST("Matrix4::inversed() of well-conditioned matrices", inverses);
+
+    TEST("Matrix4::inversedAffine() and Matrix4::multiplyAffine(const Matrix4& m)",
+         m2.multiplyAffine(m2.inversedAffine()).isEqualTo(Mat4::identity(), 1e-3) &&
+         m2.cofactorAffine().isEqualTo(m2.cofactor(), 1e-1));
+
+    const Vec4 v[3]{{randomVector3(-10.f, 10.f)}, {randomVector3(-10.f, 10.f), .0f}, {randomVector3(-10.f, 10.f)}};
+    Vec4       transformed[3];
+    transform(m1, v, transformed, 3u);
+
+    TEST("transform(const Matrix4& m, const Vec4* in, Vec4* out, const size_t count)",
+         transformed[0].isEqualTo(m1 * v[0], 1e-3) &&
+         transformed[1].isEqualTo(m1 * v[1], 1e-3) &&
+         transformed[2].isEqualTo(m1 * v[2], 1e-3));
+}
+
+
+// Matrix<R, C, T> in double precision against Matrix4, and in integers
+void testMatTemplate()
+{
+    fprintf(stderr, "\nMatrix<R, C, T>'s unit tests:\n");
+
+    static_assert(std::is_same_v<Mat<4u, 4u, f32>, Matrix4> && std::is_same_v<Matrix<3u, 3u, f32>, Mat3>,
+                  "The single-precision matrices are specialisations of Matrix<R, C, T>");
+    static_assert(std::is_same_v<decltype(Matrix<4u, 3u, f32>{} * Matrix<3u, 4u, f32>{}), Mat4>,
+                  "Generic products of single-precision matrices return Matrix4");
+
+    const auto toDouble = [](const Mat4& m)
+    {
+        Mat4d res;
+        for (u32 i{0u}; i < 16u; ++i)
+            res.e[i] = m.e[i];
+
+        return res;
+    };
+    const auto closeTo = [](const Mat4d& a, const Mat4& b, const f64 eps)
+    {
+        for (u32 i{0u}; i < 16u; ++i)
+        {
+            if (std::abs(a.e[i] - static_cast<f64>(b.e[i])) > eps * (1. + std::abs(a.e[i])))
+                return false;
+        }
+
+        return true;
+    };
+
+    bool products{true}, inverses{true}, transforms{true};
+    for (u32 i{0u}; i < 100u; ++i)
+    {
+        const Mat4  m1{randomMatrix4(-10.f, 10.f)}, m2{randomTransformMatrix4(-10.f, 10.f)};
+        const Mat4d d1{toDouble(m1)},               d2{toDouble(m2)};
+
+        Mat4  inPlace {m1};
+        Mat4d dInPlace{d1};
+        inPlace  *= m2;
+        dInPlace *= d2;
+
+        const Vec4  v {randomVector3(-10.f, 10.f), randomf32(-10.f, 10.f)};
+        const Vec4d dv{v.x, v.y, v.z, v.w};
+        const Vec4  mv{m1 * v};
+        const Vec4d dmv{d1 * dv};
+
+        products = products && closeTo(d1 * d2, m1 * m2, 1e-4) && closeTo(dInPlace, inPlace, 1e-4) &&
+                               closeTo(d1.transposed(), m1.transposed(), 0.) &&
+                               std::abs(dmv.x - mv.x) + std::abs(dmv.y - mv.y) + std::abs(dmv.z - mv.z) +
+                               std::abs(dmv.w - mv.w) <= 1e-3 && std::abs(d1.trace() - m1.trace()) <= 1e-5;
+
+        // Diagonally dominant, see testMat4Methods()
+        Mat4 m{randomMatrix4(-1.f, 1.f)};
+        for (u32 d{0u}; d < 4u; ++d)
+            m.e[d * 5u] += randomf32(0.f, 1.f) < .5f ? -5.f : 5.f;
+
+        const Mat4d dm{toDouble(m)};
+        inverses = inverses && closeTo(dm.inversed(), m.inversed(), 1e-5) &&
+                               std::abs(dm.det() - m.det()) <= 1e-5 * std::abs(dm.det()) &&
+                               (dm * dm.inversed()).isEqualTo(Mat4d::identity(), 1e-12);
+
+        const Vec3  p {randomVector3(-10.f, 10.f)};
+        const Vec3d dp{p.x, p.y, p.z};
+        const Vec3  point    {(m2 * Vec4{p, 1.f}).xyz}, direction{(m2 * Vec4{p, .0f}).xyz};
+        const Vec3d dPoint   {d2.transformPoint(dp)},   dDirection{d2.transformDirection(dp)};
+        transforms = transforms && (dPoint - Vec3d{point.x, point.y, point.z}).length() <= 1e-3 &&
+                                   (dDirection - Vec3d{direction.x, direction.y, direction.z}).length() <= 1e-3;
+    }
+
+    TEST("Matrix<4u, 4u, f64>'s products and operator*= against Matrix4", products);
+    TEST("Matrix<4u, 4u, f64>::inversed() and det() against Matrix4", inverses);
+    TEST("Matrix<4u, 4u, f64>::transformPoint() and transformDirection() against Matrix4", transforms);
+
+    // Far from the origin, where single precision has a 2 m spacing
+    const Vec3d origin{3e7, -4e7, 1e7};
+    const Mat4d t     {Mat4d::translation(origin) * Mat4d::scaling(Vec3d{2., 2., 2.})};
+    TEST("Matrix<4u, 4u, f64> large-world transforms",
+         t.transformPoint(Vec3d{.25, .5, -.125}) == origin + Vec3d(.5, 1., -.25) &&
+         t.inversed().transformPoint(origin) == Vec3d::zero() && t.c[3] == Vec4d(origin.x, origin.y, origin.z, 1.));
+
+    const Matrix<2u, 3u, s32> a{1, 4, 2, 5, 3, 6};
+    const Matrix<3u, 2u, s32> b{7, 9, 11, 8, 10, 12};
+    const Matrix<2u, 2u, s32> ab{58, 139, 64, 154};
+    const Matrix<3u, 2u, s32> at{1, 2, 3, 4, 5, 6};
+    TEST("Matrix<R, C, s32>'s products, transposed() and det()",
+         a * b == ab && a.transposed() == at && (b * a).det() == 0 &&
+         (a * b).det() == 58 * 154 - 64 * 139 && a.row(1u) == Vec3i(4, 5, 6));
 }
 
 } // End of namespace GPM
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <math.h>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/Noise.hpp"
+
+namespace GPM
+{
+
+constexpr u32 noiseCount{203u};
+constexpr f32 noiseRange{100.f};
+
+// Batched and scalar noise agree up to the FMA contractions of the compiler, whose
+// rounding errors grow with the coordinates at the highest frequency
+f32 noiseTolerance(const f32 frequency)
+{
+    return 2e-6f * fmaxf(1.f, noiseRange * frequency);
+}
+
+
+template<ENoise N, typename P>
+bool noiseBatchedMatchesScalar(const P* points, const u32 seed)
+{
+    f32 batched[noiseCount], layered[noiseCount];
+
+    const Fractal ridged   {ELayering::Ridged, 4u, .7f};
+    const f32     tolerance{noiseTolerance(1.f)}, layeredTolerance{noiseTolerance(.7f * 8.f)};
+
+    Noise::evaluate<N>(points, batched, noiseCount, seed);
+    Noise::fractal<N>(points, layered, noiseCount, ridged, seed);
+
+    bool equal{true};
+    for (u32 i{0u}; i < noiseCount; ++i)
+    {
+        equal = equal && fabsf(batched[i] - Noise::evaluate<N>(points[i], seed)) < tolerance &&
+                fabsf(layered[i] - Noise::fractal<N>(points[i], ridged, seed)) < layeredTolerance &&
+                batched[i] >= -1.f && batched[i] <= 1.f && layered[i] >= -1.f && layered[i] <= 1.f;
+    }
+
+    return equal;
+}
+
+
+// The analytic gradient matches central differences
+template<ENoise N>
+bool noiseGradientMatches(const Vec3* points)
+{
+    constexpr f32 h{1e-2f};
+
+    bool equal{true};
+    for (u32 i{0u}; i < noiseCount; ++i)
+    {
+        Vec3      gradient;
+        const f32 value{Noise::evaluate<N>(points[i], gradient, seed)};
+
+        for (u32 axis{0u}; axis < 3u; ++axis)
+        {
+            Vec3 forward{points[i]}, backward{points[i]};
+            forward.e[axis]  += h;
+            backward.e[axis] -= h;
+
+            const f32 difference{(Noise::evaluate<N>(forward, seed) - Noise::evaluate<N>(backward, seed)) / (2.f * h)};
+            equal = equal && fabsf(gradient.e[axis] - difference) < 2e-2f * fmaxf(1.f, fabsf(difference));
+        }
+
+        equal = equal && value == Noise::evaluate<N>(points[i], seed);
+    }
+
+    return equal;
+}
+
+
+void testNoise()
+{
+    fprintf(stderr, "\nNoise unit tests:\n");
+
+    f32  points1[noiseCount];
+    Vec2 points2[noiseCount];
+    Vec3 points3[noiseCount];
+    Vec4 points4[noiseCount];
+
+    for (u32 i{0u}; i < noiseCount; ++i)
+    {
+        points1[i] = randomf32(-noiseRange, noiseRange);
+        points2[i] = Vec2{randomf32(-noiseRange, noiseRange), randomf32(-noiseRange, noiseRange)};
+        points3[i] = randomVector3(-noiseRange, noiseRange);
+        points4[i] = Vec4{randomVector3(-noiseRange, noiseRange), randomf32(-noiseRange, noiseRange)};
+    }
+
+    TEST("Noise::evaluate<ENoise::Value>(const P* in, ...) and Noise::fractal<ENoise::Value>(const P* in, ...)",
+         noiseBatchedMatchesScalar<ENoise::Value>(points1, seed) && noiseBatchedMatchesScalar<ENoise::Value>(points2, seed) &&
+         noiseBatchedMatchesScalar<ENoise::Value>(points3, seed) && noiseBatchedMatchesScalar<ENoise::Value>(points4, seed));
+    TEST("Noise::evaluate<ENoise::Perlin>(const P* in, ...) and Noise::fractal<ENoise::Perlin>(const P* in, ...)",
+         noiseBatchedMatchesScalar<ENoise::Perlin>(points1, seed) && noiseBatchedMatchesScalar<ENoise::Perlin>(points2, seed) &&
+         noiseBatchedMatchesScalar<ENoise::Perlin>(points3, seed) && noiseBatchedMatchesScalar<ENoise::Perlin>(points4, seed));
+    TEST("Noise::evaluate<ENoise::Simplex>(const P* in, ...) and Noise::fractal<ENoise::Simplex>(const P* in, ...)",
+         noiseBatchedMatchesScalar<ENoise::Simplex>(points2, seed) && noiseBatchedMatchesScalar<ENoise::Simplex>(points3, seed) &&
+         noiseBatchedMatchesScalar<ENoise::Simplex>(points4, seed));
+
+    TEST("Noise::evaluate<N>(const Vec3& p, Vec3& gradient, const u32 seed)",
+         noiseGradientMatches<ENoise::Value>(points3) && noiseGradientMatches<ENoise::Perlin>(points3) &&
+         noiseGradientMatches<ENoise::Simplex>(points3));
+
+    // A tile not multiple of the SIMD width, against the scalar fractal. The steps
+    // and frequencies are powers of 2, for the same points on both sides.
+    constexpr u32 width{37u}, height{5u};
+
+    const Fractal fBm   {ELayering::FBm, 5u, .125f};
+    const Vec2    origin{floorf(randomf32(-noiseRange, .0f)), floorf(randomf32(-noiseRange, .0f))};
+    const Vec2    step  {.25f, .5f};
+    f32           tile[width * height];
+
+    Noise::fractalGrid<ENoise::Simplex>(origin, step, width, height, tile, fBm, seed);
+
+    bool equal{true};
+    for (u32 y{0u}; y < height; ++y)
+    {
+        for (u32 x{0u}; x < width; ++x)
+        {
+            const Vec2 p{origin.x + static_cast<f32>(x) * step.x, origin.y + static_cast<f32>(y) * step.y};
+            equal = equal && fabsf(tile[y * width + x] - Noise::fractal<ENoise::Simplex>(p, fBm, seed)) < noiseTolerance(2.f);
+        }
+    }
+
+    TEST("Noise::fractalGrid(const Vec2& origin, const Vec2& step, ...)", equal);
+
+    // Seeds give unrelated noise, and the lattice hash doesn't repeat
+    u32 sameSeed{0u}, samePeriod{0u};
+    for (u32 i{0u}; i < noiseCount; ++i)
+    {
+        const Vec3 p{points3[i]};
+        sameSeed   += Noise::evaluate<ENoise::Perlin>(p, seed) == Noise::evaluate<ENoise::Perlin>(p, seed + 1u) ? 1u : 0u;
+        samePeriod += fabsf(Noise::evaluate<ENoise::Perlin>(p, seed) - Noise::evaluate<ENoise::Perlin>(p + Vec3{289.f, .0f, .0f}, seed)) < 1e-3f ? 1u : 0u;
+    }
+
+    TEST("Noise seeds and period", sameSeed < noiseCount / 10u && samePeriod < noiseCount / 10u);
+
+    // Simplex noise starts at 2 dimensions, the 1D overloads default to Perlin noise
+    const f32 x[3]{randomf32(-100.f, 100.f), randomf32(-100.f, 100.f), randomf32(-100.f, 100.f)};
+    f32       defaults[6], perlin[6], derivative, perlinDerivative;
+    Noise::evaluate(x, defaults, 3u, seed);
+    Noise::evaluate<ENoise::Perlin>(x, perlin, 3u, seed);
+    Noise::fractal(x, defaults + 3, 3u, Fractal{}, seed);
+    Noise::fractal<ENoise::Perlin>(x, perlin + 3, 3u, Fractal{}, seed);
+
+    bool batched{true};
+    for (u32 i{0u}; i < 6u; ++i)
+        batched = batched && defaults[i] == perlin[i];
+
+    TEST("Noise's 1D overloads default to ENoise::Perlin",
+         Noise::evaluate(x[0], seed) == Noise::evaluate<ENoise::Perlin>(x[0], seed) &&
+         Noise::evaluate(x[1], derivative, seed) == Noise::evaluate<ENoise::Perlin>(x[1], perlinDerivative, seed) &&
+         derivative == perlinDerivative &&
+         Noise::fractal(x[2], Fractal{}, seed) == Noise::fractal<ENoise::Perlin>(x[2], Fractal{}, seed) && batched);
+}
+
+} // End of namespace GPM
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "TestingTools.hpp"
+#include "../include/GPM/Quantization.hpp"
+
+namespace GPM
+{
+
+// Every half goes through fromHalf() and back to the same bits, NaNs staying NaNs.
+// The halves are read from volatiles: compilers don't track the MXCSR, and could
+// otherwise fold the conversions or reuse them across _mm_setcsr().
+bool halfRoundTrips()
+{
+    for (volatile u32 h{0u}; h < 0x10000u; ++h)
+    {
+        const f32 f{fromHalf(static_cast<u16>(h))};
+        const u16 back{toHalf(f)};
+
+        if (f != f ? (back & 0x7fffu) <= 0x7c00u : back != h)
+            return false;
+    }
+
+    return true;
+}
+
+
+// The batched unpack() gives the bits of fromHalf() for every half
+bool halfUnpackMatchesScalar()
+{
+    constexpr u32 count{(0x10000u + 2u) / 3u};
+
+    PackedVec3Half packed[count];
+    Vec3           unpacked[count];
+
+    for (volatile u32 i{0u}; i < 3u * count; ++i)
+        packed[i / 3u].e[i % 3u] = static_cast<u16>(i);
+
+    unpack(packed, unpacked, count);
+
+    for (u32 i{0u}; i < 3u * count; ++i)
+    {
+        f32u expected{fromHalf(static_cast<u16>(i))}, actual{unpacked[i / 3u].e[i % 3u]};
+        if (expected.bits != actual.bits)
+            return false;
+    }
+
+    return true;
+}
+
+
+// Random unit quaternion, or one close to the worst case of the smallest three
+// encoding, where the four components are close to +-1/2
+Quat randomQuantizedQuat(const bool nearWorstCase)
+{
+    Quat q;
+    for (u32 j{0u}; j < 4u; ++j)
+    {
+        const f32 sign{rand() & 1 ? -1.f : 1.f};
+        q.e[j] = nearWorstCase ? sign * randomf32(.48f, .52f) : randomf32(-1.f, 1.f);
+    }
+
+    return q.normalized();
+}
+
+
+// Largest difference between the components of q and its decoded value,
+// which can be the opposite quaternion
+f32 quatError(const Quat& q, const Quat& decoded)
+{
+    const f32 sign{q.dot(decoded) < .0f ? -1.f : 1.f};
+    f32       error{.0f};
+    for (u32 j{0u}; j < 4u; ++j)
+        error = fmaxf(error, fabsf(q.e[j] * sign - decoded.e[j]));
+
+    return error;
+}
+
+
+// The batched pack() gives the bits of the single value versions, SIMD body
+// and scalar tail alike, and the batched unpack() the same values
+bool codecsMatchScalar()
+{
+    constexpr u32 count{1003u};
+
+    const Vec3 min{randomVector3(-100.f, 0.f)}, max{min + Vec3{randomf32(1.f, 100.f), randomf32(1.f, 100.f), randomf32(1.f, 100.f)}};
+
+    Quat quats[count];
+    Vec3 points[count], normals[count];
+    for (u32 i{0u}; i < count; ++i)
+    {
+        quats[i]   = randomQuantizedQuat(i % 4u == 0u);
+        points[i]  = randomVector3(-110.f, 110.f);
+        normals[i] = i % 7u == 0u ? Vec3{.0f, .0f, rand() & 1 ? -1.f : 1.f} : randomVector3(-1.f, 1.f);
+        if (normals[i].sqrLength() == .0f)
+            normals[i] = Vec3::up();
+    }
+
+    PackedQuat32    quats32 [count];
+    PackedQuat48    quats48 [count];
+    PackedVec3Fixed fixed   [count];
+    PackedNormal    octahedral[count];
+    pack(quats,   quats32,    count);
+    pack(quats,   quats48,    count);
+    pack(points,  fixed,      count, min, max);
+    pack(normals, octahedral, count);
+
+    Quat unpacked32[count], unpacked48[count];
+    Vec3 unpackedFixed[count], unpackedNormals[count];
+    unpack(quats32,    unpacked32,      count);
+    unpack(quats48,    unpacked48,      count);
+    unpack(fixed,      unpackedFixed,   count, min, max);
+    unpack(octahedral, unpackedNormals, count);
+
+    for (u32 i{0u}; i < count; ++i)
+    {
+        const PackedQuat48    q48   {toPackedQuat48(quats[i])};
+        const PackedVec3Fixed p     {toPackedVec3Fixed(points[i], min, max)};
+        const PackedNormal    normal{toPackedNormal(normals[i])};
+
+        if (quats32[i].bits != toPackedQuat32(quats[i]).bits ||
+            quats48[i].e[0] != q48.e[0] || quats48[i].e[1] != q48.e[1] || quats48[i].e[2] != q48.e[2] ||
+            fixed[i].e[0] != p.e[0] || fixed[i].e[1] != p.e[1] || fixed[i].e[2] != p.e[2] ||
+            octahedral[i].x != normal.x || octahedral[i].y != normal.y)
+            return false;
+
+        // Decoding may still round once differently with FMA contraction
+        if (quatError(unpacked32[i], toQuaternion(quats32[i])) > 1e-6f ||
+            quatError(unpacked48[i], toQuaternion(quats48[i])) > 1e-6f ||
+            !unpackedFixed[i].isEqualTo(toVector3(fixed[i], min, max), 1e-4f) ||
+            !unpackedNormals[i].isEqualTo(toVector3(octahedral[i]), 1e-6f))
+            return false;
+    }
+
+    return true;
+}
+
+
+// Worst errors of the encodings against the bounds documented in Quantization.hpp
+bool codecsWithinBounds()
+{
+    f32 error32{.0f}, error48{.0f}, normalError{.0f}, fixedError{.0f};
+
+    const Vec3 min{-50.f, -10.f, 0.f}, max{50.f, 30.f, 1.f};
+    const Vec3 halfStep{(max - min) * (.5f / 65535.f)};
+
+    for (u32 i{0u}; i < 100000u; ++i)
+    {
+        const Quat q{randomQuantizedQuat(i % 2u == 0u)};
+        error32 = fmaxf(error32, quatError(q, toQuaternion(toPackedQuat32(q))));
+        error48 = fmaxf(error48, quatError(q, toQuaternion(toPackedQuat48(q))));
+
+        Vec3 n{randomVector3(-1.f, 1.f)};
+        if (n.sqrLength() < 1e-6f)
+            continue;
+        n.normalize();
+
+        const Vec3 decoded{toVector3(toPackedNormal(n))};
+        normalError = fmaxf(normalError, atan2f(n.cross(decoded).length(), n.dot(decoded)));
+
+        const Vec3 p{randomf32(min.x, max.x), randomf32(min.y, max.y), randomf32(min.z, max.z)};
+        const Vec3 d{toVector3(toPackedVec3Fixed(p, min, max), min, max) - p};
+        fixedError = fmaxf(fixedError, fmaxf(fabsf(d.x) / halfStep.x, fmaxf(fabsf(d.y) / halfStep.y, fabsf(d.z) / halfStep.z)));
+    }
+
+    // Fixed point: half a step, plus the float rounding of the decoding
+    return error32 < 2.1e-3f && error48 < 6.5e-5f && normalError < 7e-5f && fixedError < 1.01f;
+}
+
+
+// NaNs of any payload become the quiet NaN 0x7e00 with their sign, in both paths
+bool halfNaNsMatchScalar()
+{
+    constexpr u32 count{6u};
+
+    Vec3 nans[count];
+    for (u32 i{0u}; i < 3u * count; ++i)
+    {
+        f32u value;
+        value.bits = static_cast<s32>((i & 1u ? 0xff800000u : 0x7f800000u) | (1u + (static_cast<u32>(rand()) & 0x7fffffu)) % 0x800000u);
+        if ((value.bits & 0x7fffff) == 0)
+            value.bits |= 1;
+        nans[i / 3u].e[i % 3u] = value.f;
+    }
+
+    PackedVec3Half packed[count];
+    pack(nans, packed, count);
+
+    for (u32 i{0u}; i < 3u * count; ++i)
+    {
+        const u16 expected{static_cast<u16>(i & 1u ? 0xfe00u : 0x7e00u)};
+        if (packed[i / 3u].e[i % 3u] != expected || toHalf(nans[i / 3u].e[i % 3u]) != expected)
+            return false;
+    }
+
+    return true;
+}
+
+
+void testQuantization()
+{
+    fprintf(stderr, "\nQuantization unit tests:\n");
+
+    TEST("toHalf(fromHalf(h)) for the 65536 halves", halfRoundTrips());
+    TEST("unpack(const PackedVec3Half* in, Vec3* out, const size_t count)", halfUnpackMatchesScalar());
+
+#ifdef GPM_USE_SSE
+    // Denormals are zero: the subnormal halves must not be decoded from denormal floats
+    const u32 csr{_mm_getcsr()};
+    _mm_setcsr(csr | 0x0040u);
+
+    const volatile u16 smallest{0x8001u};
+    const bool         daz     {halfRoundTrips() && halfUnpackMatchesScalar() && fromHalf(smallest) == -ldexpf(1.f, -24)};
+
+    _mm_setcsr(csr);
+
+    TEST("fromHalf(const u16 h) with denormals are zero", daz);
+#endif
+
+    const Vec3 v{randomVector3(-1e4f, 1e4f)};
+    const Vec3 unpacked{toVector3(toPackedVec3Half(v))};
+
+    TEST("toPackedVec3Half(const Vec3& v) and toVector3(const PackedVec3Half& p)",
+         unpacked.isEqualTo(v, 1e4f * ldexpf(1.f, -11)));
+    TEST("pack(const Vec3* in, PackedVec3Half* out, const size_t count) of NaNs", halfNaNsMatchScalar());
+
+    TEST("pack() and unpack() of PackedQuat32, PackedQuat48, PackedVec3Fixed and PackedNormal against the single values",
+         codecsMatchScalar());
+    TEST("PackedQuat32, PackedQuat48, PackedVec3Fixed and PackedNormal error bounds", codecsWithinBounds());
+}
+
+} // End of namespace GPM
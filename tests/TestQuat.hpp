@@ -1,7 +1,10 @@
 #pragma once
 
 #include "TestingTools.hpp"
+#include <math.h>
+
 #include "../include/GPM/Quaternion.hpp"
+#include "../include/GPM/QuaternionSoA.hpp"
 #include "../include/GPM/Calc.hpp"
 
 namespace GPM
@@ -49,7 +52,22 @@ void testQuatMethods()
     TEST("Quaternion::angle()", f32AreEqual(q1.angle(), inversed ? -angle : angle, 1e-4));
     TEST("Quaternion::slerp(const Quaternion& target, const f32 t)",
          q1.slerp(q2, 1.f).isEqualTo(q2) && q1.slerp(q2, .0f).isEqualTo(q1));
-    
+
+    const Quat from[3]{q1, q2, -q1};
+    const Quat to[3]  {q2, q2, q2};
+    Quat       blended[3];
+    slerp(from, to, .3f, blended, 3u);
+
+    bool batchedSlerp{true};
+    for (u32 i{0u}; i < 3u; ++i)
+    {
+        const Quat expected{from[i].dot(to[i]) > .999f ? from[i].nlerp(to[i], .3f) : from[i].slerp(to[i], .3f)};
+        for (u32 j{0u}; j < 4u; ++j)
+            batchedSlerp = batchedSlerp && f32AreEqual(blended[i].e[j], expected.e[j], 1e-5f);
+    }
+
+    TEST("slerp(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count)", batchedSlerp);
+
     TEST("Quaternion::rotate(const Vector3& v)",
          f32AreEqual(v1.angleWith(q1.rotate(v2)), v1.angleWith(v2), 1e-5));
 }
@@ -70,11 +88,149 @@ void testQuatOperators()
 }
 
 
+Quat randomUnitQuat()
+{
+    return Quat::angleAxis(randomf32(-PI, PI), randomVector3(-1.f, 1.f));
+}
+
+
+// Shortest-path slerp and nlerp, computed in double precision
+Quat slerpReference(const Quat& from, const Quat& to, const f32 t, const bool normalizedLerp)
+{
+    f64 dot{0.};
+    for (u32 j{0u}; j < 4u; ++j)
+        dot += f64(from.e[j]) * f64(to.e[j]);
+
+    // Like the batched versions, from is the one negated for the shortest path
+    const f64 sign {dot < 0. ? -1. : 1.};
+    const f64 theta{acos(fmin(fabs(dot), 1.))};
+    f64       a    {sign * (1. - t)}, b{t};
+    if (!normalizedLerp && theta > 1e-6)
+    {
+        a = sign * sin((1. - t) * theta) / sin(theta);
+        b = sin(t * theta) / sin(theta);
+    }
+
+    f64 q[4], sqrLength{0.};
+    for (u32 j{0u}; j < 4u; ++j)
+    {
+        q[j]       = a * from.e[j] + b * to.e[j];
+        sqrLength += q[j] * q[j];
+    }
+
+    const f64 length{sqrt(sqrLength)};
+    return {Vec3{f32(q[0] / length), f32(q[1] / length), f32(q[2] / length)}, f32(q[3] / length)};
+}
+
+
+// Angle of the rotation from a to b, in radians. Computed from the chord
+// between the two unit quaternions, which unlike acos(dot) stays accurate
+// for close rotations.
+f64 rotationAngle(const Quat& a, const Quat& b)
+{
+    f64 dot{0.};
+    for (u32 j{0u}; j < 4u; ++j)
+        dot += f64(a.e[j]) * f64(b.e[j]);
+
+    const f64 sign{dot < 0. ? -1. : 1.};
+    f64       sqrChord{0.};
+    for (u32 j{0u}; j < 4u; ++j)
+        sqrChord += (f64(a.e[j]) - sign * b.e[j]) * (f64(a.e[j]) - sign * b.e[j]);
+
+    return 4. * asin(fmin(sqrt(sqrChord) * .5, 1.));
+}
+
+
+bool quatsAreEqual(const Quat& a, const Quat& b, const f32 eps)
+{
+    return f32AreEqual(a.x, b.x, eps) && f32AreEqual(a.y, b.y, eps) &&
+           f32AreEqual(a.z, b.z, eps) && f32AreEqual(a.w, b.w, eps);
+}
+
+
+// Array and QuaternionSoA blends against the double precision references, on
+// a count that leaves a scalar tail after the SIMD body
+void testQuatBatched()
+{
+    fprintf(stderr, "\nQuaternion's batched unit tests:\n");
+
+    constexpr size_t count{7u * GPM_SIMD_WIDTH + 3u};
+
+    Quat from[count], to[count];
+    for (size_t i{0u}; i < count; ++i)
+    {
+        from[i] = randomUnitQuat();
+        to[i]   = i % 5u == 0u ? -from[i] : (i % 5u == 1u ? from[i].nlerp(randomUnitQuat(), 1e-3f) : randomUnitQuat());
+    }
+
+    const QuatSoA soaFrom{from, count};
+    QuatSoA       soaTo;
+    for (size_t i{0u}; i < count; ++i)
+        soaTo.pushBack(to[i]);
+
+    f64  slerpError{0.}, fastError{0.};
+    bool nlerpMatch{true}, soaMatch{true};
+    const f32 times[4]{.0f, randomf32(0.f, 1.f), randomf32(0.f, 1.f), 1.f};
+    for (const f32 t : times)
+    {
+        Quat slerped[count], fast[count], lerped[count];
+        slerp    (from, to, t, slerped, count);
+        slerpFast(from, to, t, fast,    count);
+        nlerp    (from, to, t, lerped,  count);
+
+        QuatSoA soaSlerped, soaFast, soaLerped{soaTo};
+        soaFrom.slerp    (soaTo, t, soaSlerped);
+        soaFrom.slerpFast(soaTo, t, soaFast);
+        soaFrom.nlerp    (soaLerped, t, soaLerped);
+
+        for (size_t i{0u}; i < count; ++i)
+        {
+            const Quat expected{slerpReference(from[i], to[i], t, false)};
+
+            slerpError = fmax(slerpError, rotationAngle(slerped[i], expected));
+            fastError  = fmax(fastError,  rotationAngle(fast[i],    expected));
+            nlerpMatch = nlerpMatch && quatsAreEqual(lerped[i], slerpReference(from[i], to[i], t, true), 1e-6f);
+            soaMatch   = soaMatch && quatsAreEqual(soaSlerped.get(i), slerped[i], 1e-6f) &&
+                                     quatsAreEqual(soaFast.get(i),    fast[i],    1e-6f) &&
+                                     quatsAreEqual(soaLerped.get(i),  lerped[i],  1e-6f);
+        }
+    }
+
+    TEST("slerp(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) accuracy", slerpError < 2e-6);
+    TEST("slerpFast(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count) within 2e-3 rad", fastError < 2e-3);
+    TEST("nlerp(const Quat* from, const Quat* to, const f32 t, Quat* out, const size_t count)", nlerpMatch);
+    TEST("QuaternionSoA::slerp(), QuaternionSoA::slerpFast() and QuaternionSoA::nlerp()", soaMatch);
+
+    // Storage: resize() adds identities, copies keep the elements
+    QuatSoA grown{soaFrom};
+    grown.resize(count + 5u);
+
+    Quat copied[count + 5u];
+    QuatSoA{grown}.copyTo(copied);
+
+    QuatSoA normalized{soaFrom};
+    for (size_t i{0u}; i < count; ++i)
+        normalized.set(i, normalized.get(i) * 3.f);
+    normalized.normalize();
+
+    bool storage{grown.size() == count + 5u && soaTo.size() == count};
+    for (size_t i{0u}; i < count + 5u; ++i)
+    {
+        const Quat expected{i < count ? from[i] : Quat::identity()};
+        storage = storage && copied[i] == expected && (i >= count || soaTo.get(i) == to[i]) &&
+                             (i >= count || quatsAreEqual(normalized.get(i), from[i], 1e-6f));
+    }
+
+    TEST("QuaternionSoA storage, QuaternionSoA::resize() and QuaternionSoA::normalize()", storage);
+}
+
+
 void testQuat()
 {
     testQuatStaticMethods();
     testQuatMethods();
     testQuatOperators();
+    testQuatBatched();
 }
 
 } // End of namespace GPE
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/Random.hpp"
+#include "../include/GPM/Distributions.hpp"
+
+namespace GPM
+{
+
+template<typename T, size_t N>
+bool bitsAreEqual(const T (&values)[N], const u32 (&expected)[N])
+{
+    return memcmp(values, expected, sizeof(values)) == 0;
+}
+
+
+void testRandomGenerator()
+{
+    fprintf(stderr, "\nRandom::Generator unit tests:\n");
+
+    // Reference output of pcg32_srandom_r(42, 54) from the PCG distribution
+    Random::Generator pcg{42u, 54u};
+    u32               scalar[6];
+    for (u32& value : scalar)
+        value = pcg.next();
+
+    TEST("Random::Generator::next() known answers",
+         bitsAreEqual(scalar, {0xa15c02b7u, 0x7b47f409u, 0xba1d3330u, 0x83d2f293u, 0xbfa4784bu, 0xcbed606eu}));
+
+    // The fills must give these values on every backend, with or without FMA
+    Random::Generator bulk{1234u, 5u};
+    u32               bits[8];
+    bulk.fill(bits, 8u);
+
+    TEST("Random::Generator::fill(u32* out, const size_t count) known answers",
+         bitsAreEqual(bits, {0xf8319dd5u, 0x7766e320u, 0x8ee5d9acu, 0x869817bfu,
+                             0xb711cda9u, 0x50e44d13u, 0x18f94e08u, 0x25180535u}));
+
+    bulk.seed(1234u, 5u);
+    f32 ranged[8];
+    bulk.fill(ranged, 8u, -3.f, 1e6f);
+
+    TEST("Random::Generator::fill(f32* out, const size_t count, const f32 min, const f32 max) known answers",
+         bitsAreEqual(ranged, {0x496cb22fu, 0x48e3bd82u, 0x49084716u, 0x49005bcdu,
+                               0x492e96a8u, 0x489a49b1u, 0x47be87b1u, 0x480d7fccu}));
+
+    // Same seed and stream, same values, whatever the split of the calls
+    constexpr size_t count{1000u};
+    const f32        min  {randomf32(-1e3f, 0.f)}, max{randomf32(1.f, 1e3f)};
+
+    Random::Generator a{seed, 3u}, b{seed, 3u};
+    u32               whole[count], split[count];
+    f32               floats[count];
+
+    a.fill(whole, count);
+    b.fill(split, 400u);
+    b.fill(split + 400u, count - 400u);
+
+    bool reproducible{memcmp(whole, split, sizeof(whole)) == 0};
+
+    // Floats are the documented function of the bits
+    a.seed(seed, 3u);
+    a.fill(floats, count, min, max);
+
+    const f64 step{static_cast<f64>((max - min) * (1.f / 16777216.f))};
+    for (size_t i{0u}; i < count; ++i)
+    {
+        reproducible = reproducible && floats[i] == static_cast<f32>(static_cast<f64>(whole[i] >> 8u) * step + min) &&
+                       floats[i] >= min && floats[i] <= max;
+    }
+
+    TEST("Random::Generator::fill() reproducibility", reproducible);
+
+    Random::Generator c{seed, 4u};
+    a.seed(seed, 3u);
+
+    TEST("Random::Generator streams", a.next() != c.next() && c.stream() == 4u);
+
+    // initSeed() keeps the stream of the thread
+    u32         other;
+    std::thread thread{[&other]()
+    {
+        Random::initSeed(7u);
+        other = Random::defaultGenerator().next();
+    }};
+    thread.join();
+
+    Random::initSeed(7u);
+    const u32 first{Random::defaultGenerator().next()};
+    Random::initSeed(7u);
+
+    TEST("Random::initSeed(const u32 seed)", first == Random::defaultGenerator().next() && first != other);
+}
+
+
+
+void testRandomPhilox()
+{
+    fprintf(stderr, "\nRandom::Philox unit tests:\n");
+
+    // Known answers of Philox4x32-10 from Random123, the counter being (index, stream)
+    u32 zero[4], ones[4], pi[4];
+    Random::Philox{0u, 0u}.block(0u, zero);
+    Random::Philox{~0ull, ~0ull}.block(~0ull, ones);
+    Random::Philox{0x299f31d0a4093822ull, 0x0370734413198a2eull}.block(0x85a308d3243f6a88ull, pi);
+
+    TEST("Random::Philox::block(const u64 index, u32 out[4]) known answers",
+         bitsAreEqual(zero, {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}) &&
+         bitsAreEqual(ones, {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}) &&
+         bitsAreEqual(pi,   {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+
+    // The fills start unaligned and cross the carry of the low word of the block index
+    constexpr size_t count{100u};
+    constexpr u64    first{(1ull << 34u) - 37u};
+
+    const Random::Philox philox{seed, 9u};
+    const f32            min   {randomf32(-1e3f, 0.f)}, max{randomf32(1.f, 1e3f)};
+    u32                  bits[count];
+    f32                  unit[count], ranged[count];
+
+    philox.fill(first, bits, count);
+    philox.fill(first, unit, count);
+    philox.fill(first, ranged, count, min, max);
+
+    const f64 step{static_cast<f64>((max - min) * (1.f / 16777216.f))};
+    bool      equal{true};
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        equal = equal && bits[i] == philox.at(first + i) && unit[i] == philox.floatAt(first + i) &&
+                ranged[i] == static_cast<f32>(static_cast<f64>(bits[i] >> 8u) * step + min);
+    }
+
+    Random::Philox sequential{seed, 9u};
+    sequential.seek(first + 5u);
+
+    TEST("Random::Philox::fill() and Random::Philox::at() across the counter carry",
+         equal && sequential.next() == bits[5] && sequential.position() == first + 6u);
+}
+
+
+
+// Sample mean and variance
+struct Moments
+{
+    f64    sum   {.0};
+    f64    sqrSum{.0};
+    size_t count {0u};
+
+    void add(const f64 value)
+    {
+        sum    += value;
+        sqrSum += value * value;
+        ++count;
+    }
+
+    f64 mean()     const { return sum / static_cast<f64>(count); }
+    f64 variance() const { return sqrSum / static_cast<f64>(count) - mean() * mean(); }
+
+    // Both within 5 standard errors, the fourth moment being kurtosis * variance^2
+    bool matches(const f64 expectedMean, const f64 expectedVariance, const f64 kurtosis) const
+    {
+        const f64 n{static_cast<f64>(count)};
+        return fabs(mean() - expectedMean) < 5. * sqrt(expectedVariance / n) &&
+               fabs(variance() - expectedVariance) < 5. * expectedVariance * sqrt((kurtosis - 1.) / n);
+    }
+};
+
+
+void testDistributions()
+{
+    fprintf(stderr, "\nRandom distributions unit tests:\n");
+
+    constexpr size_t count{200000u};
+
+    Random::Generator generator{seed};
+    Random::Philox    philox   {seed};
+    std::vector<f32>  values   (count);
+
+    // Normal: moments, and the share of the tail beyond the base layer of the ziggurat
+    const f32 mean  {randomf32(-10.f, 10.f)};
+    const f32 stddev{randomf32(.1f, 10.f)};
+
+    Moments scalar, batched, batchedPhilox;
+    size_t  tail{0u};
+
+    for (size_t i{0u}; i < count; ++i)
+        scalar.add(Random::normal(mean, stddev, generator));
+
+    Random::normal(values.data(), count, mean, stddev, generator);
+    for (const f32 value : values)
+    {
+        batched.add(value);
+        tail += fabsf(value - mean) > 3.442619855899f * stddev ? 1u : 0u;
+    }
+
+    Random::normal(values.data(), count, mean, stddev, philox);
+    for (const f32 value : values)
+        batchedPhilox.add(value);
+
+    // P(|x| > 3.4426) = 5.7592e-4
+    const f64 tailShare{5.7592e-4};
+    const f64 variance {static_cast<f64>(stddev) * stddev};
+
+    TEST("Random::normal(const f32 mean, const f32 stddev, ...)", scalar.matches(mean, variance, 3.));
+    TEST("Random::normal(f32* out, const size_t count, ...)",
+         batched.matches(mean, variance, 3.) && batchedPhilox.matches(mean, variance, 3.) &&
+         fabs(static_cast<f64>(tail) - tailShare * count) < 5. * sqrt(tailShare * count));
+
+    // Exponential: mean 1 / lambda, variance 1 / lambda^2, kurtosis 9
+    const f32 lambda{randomf32(.1f, 10.f)};
+
+    Moments exponential, exponentialBatched;
+    for (size_t i{0u}; i < count; ++i)
+        exponential.add(Random::exponential(lambda, generator));
+
+    Random::exponential(values.data(), count, lambda, generator);
+    for (const f32 value : values)
+        exponentialBatched.add(value);
+
+    TEST("Random::exponential()",
+         exponential.matches(1. / lambda, 1. / (static_cast<f64>(lambda) * lambda), 9.) &&
+         exponentialBatched.matches(1. / lambda, 1. / (static_cast<f64>(lambda) * lambda), 9.));
+
+    // Poisson: mean and variance both equal to the mean, on both sides of the switch
+    bool poisson{true};
+    for (const f32 poissonMean : {3.5f, 40.f})
+    {
+        std::vector<u32> counts(count);
+        Random::poisson(counts.data(), count, poissonMean, generator);
+
+        Moments moments;
+        for (const u32 value : counts)
+            moments.add(value);
+
+        poisson = poisson && moments.matches(poissonMean, poissonMean, 3. + 1. / poissonMean);
+    }
+
+    TEST("Random::poisson()", poisson);
+}
+
+} // End of namespace GPM
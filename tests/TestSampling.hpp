@@ -0,0 +1,459 @@
+#pragma once
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/Sampling.hpp"
+#include "../include/GPM/PointSets.hpp"
+
+namespace GPM
+{
+
+// Points of the samplers, and the tolerance of the proportions they are checked
+// against: 5 standard deviations of a proportion over sampleCount points
+constexpr size_t samplingCount    {4000u};
+constexpr f32    samplingTolerance{.04f};
+
+
+f32 distanceToSegment(const Vec3& point, const Vec3& a, const Vec3& b)
+{
+    const Vec3 ab{b - a};
+    const f32  t {fmaxf(.0f, fminf(1.f, (point - a).dot(ab) / ab.dot(ab)))};
+
+    return (point - (a + ab * t)).length();
+}
+
+
+// Proportion of the points passing test
+template<typename F>
+f32 proportion(const Vec3* points, const size_t count, F&& test)
+{
+    size_t passed{0u};
+    for (size_t i{0u}; i < count; ++i)
+        passed += test(points[i]) ? 1u : 0u;
+
+    return static_cast<f32>(passed) / static_cast<f32>(count);
+}
+
+
+void testShapeSampling()
+{
+    fprintf(stderr, "\nRandom shape sampling unit tests:\n");
+
+    Random::Generator generator{seed};
+    Vec3              points[samplingCount];
+
+    // Boxes
+    const AABB box{randomVector3(-10.f, 10.f), 1.f, 2.f, 4.f};
+    const Vec3 extents{box.extents};
+
+    Random::sampleInside(box, points, samplingCount, generator);
+
+    TEST("Random::sampleInside(const AABB& box, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             const Vec3 local{p - box.center};
+             return fabsf(local.x) <= extents.x && fabsf(local.y) <= extents.y && fabsf(local.z) <= extents.z;
+         }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return p.z < box.center.z; }) - .5f) < samplingTolerance);
+
+    Random::sampleSurface(box, points, samplingCount, generator);
+
+    // The box is 2 x 4 x 8: faces of normal x have an area of 32 out of 32 + 16 + 8
+    TEST("Random::sampleSurface(const AABB& box, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             const Vec3 local{p - box.center};
+             const f32  face {fmaxf(fabsf(local.x) / extents.x, fmaxf(fabsf(local.y) / extents.y, fabsf(local.z) / extents.z))};
+             return fabsf(face - 1.f) < 1e-4f;
+         }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             return fabsf(fabsf(p.x - box.center.x) - extents.x) < 1e-4f;
+         }) - 32.f / 56.f) < samplingTolerance);
+
+    Referential referential;
+    referential.origin = randomVector3(-10.f, 10.f);
+    referential.unitI  = Vec3{1.f, 1.f, .0f}.normalized();
+    referential.unitJ  = Vec3{-1.f, 1.f, .0f}.normalized();
+    referential.unitK  = Vec3{.0f, .0f, 1.f};
+
+    const OrientedBox orientedBox{referential, 1.f, 2.f, 3.f};
+
+    auto localToBox = [&](const Vec3& p)
+    {
+        const Vec3 local{p - referential.origin};
+        return Vec3{fabsf(local.dot(referential.unitI)), fabsf(local.dot(referential.unitJ)), fabsf(local.dot(referential.unitK))};
+    };
+
+    Random::sampleInside(orientedBox, points, samplingCount, generator);
+    const bool inside{proportion(points, samplingCount, [&](const Vec3& p)
+    {
+        const Vec3 local{localToBox(p)};
+        return local.x <= 1.f + 1e-4f && local.y <= 2.f + 1e-4f && local.z <= 3.f + 1e-4f;
+    }) == 1.f};
+
+    Random::sampleSurface(orientedBox, points, samplingCount, generator);
+    const bool onSurface{proportion(points, samplingCount, [&](const Vec3& p)
+    {
+        const Vec3 local{localToBox(p)};
+        return fabsf(fmaxf(local.x, fmaxf(local.y * .5f, local.z / 3.f)) - 1.f) < 1e-4f;
+    }) == 1.f};
+
+    TEST("Random::sampleInside/sampleSurface(const OrientedBox& box, ...)", inside && onSurface);
+
+    // Spheres: a ball of half the radius holds 1 / 8 of the volume
+    const Sphere sphere{3.f, randomVector3(-10.f, 10.f)};
+    const Vec3   center{sphere.getCenter()};
+
+    Random::sampleInside(sphere, points, samplingCount, generator);
+
+    TEST("Random::sampleInside(const Sphere& sphere, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p) { return (p - center).length() <= 3.f * (1.f + 1e-5f); }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return (p - center).length() < 1.5f; }) - .125f) < samplingTolerance);
+
+    Random::sampleSurface(sphere, points, samplingCount, generator);
+
+    // Archimedes: equal heights of the sphere have equal areas
+    TEST("Random::sampleSurface(const Sphere& sphere, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p) { return fabsf((p - center).length() - 3.f) < 1e-4f * 3.f; }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return p.y - center.y > 1.5f; }) - .25f) < samplingTolerance);
+
+    // Cylinder of radius 1 and height 4, along a random axis
+    const Vec3     axis    {randomVector3(-1.f, 1.f).normalized()};
+    const Vec3     bottom  {randomVector3(-10.f, 10.f)};
+    const Vec3     top     {bottom + axis * 4.f};
+    const Cylinder cylinder{bottom, top, 1.f};
+
+    auto height = [&](const Vec3& p) { return (p - bottom).dot(axis); };
+    auto radial = [&](const Vec3& p) { return (p - bottom - axis * height(p)).length(); };
+
+    Random::sampleInside(cylinder, points, samplingCount, generator);
+
+    TEST("Random::sampleInside(const Cylinder& cylinder, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             return radial(p) <= 1.f + 1e-4f && height(p) >= -1e-4f && height(p) <= 4.f + 1e-4f;
+         }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return radial(p) < sqrtf(.5f); }) - .5f) < samplingTolerance);
+
+    Random::sampleSurface(cylinder, points, samplingCount, generator);
+
+    // Caps: 2 PI r^2 out of 2 PI r^2 + 2 PI r h
+    TEST("Random::sampleSurface(const Cylinder& cylinder, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             const bool side{fabsf(radial(p) - 1.f) < 1e-3f && height(p) >= -1e-3f && height(p) <= 4.f + 1e-3f};
+             const bool cap {radial(p) <= 1.f + 1e-3f && (fabsf(height(p)) < 1e-3f || fabsf(height(p) - 4.f) < 1e-3f)};
+             return side || cap;
+         }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return radial(p) < .999f; }) - .2f) < samplingTolerance);
+
+    // Capsule on the same segment: the half balls hold 4 / 3 PI r^3 out of 4 / 3 PI r^3 + PI r^2 h
+    const Capsule capsule{Segment{bottom, top}, 1.f};
+
+    Random::sampleInside(capsule, points, samplingCount, generator);
+
+    TEST("Random::sampleInside(const Capsule& capsule, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p) { return distanceToSegment(p, bottom, top) <= 1.f + 1e-4f; }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return height(p) < .0f || height(p) > 4.f; }) - 1.f / 4.f) < samplingTolerance);
+
+    Random::sampleSurface(capsule, points, samplingCount, generator);
+
+    // The half spheres have an area of 4 PI r^2 out of 4 PI r^2 + 2 PI r h
+    TEST("Random::sampleSurface(const Capsule& capsule, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p) { return fabsf(distanceToSegment(p, bottom, top) - 1.f) < 1e-3f; }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p) { return height(p) < .0f || height(p) > 4.f; }) - 1.f / 3.f) < samplingTolerance);
+
+    // Triangle: the corner triangle at a, of half edges, has 1 / 4 of the area
+    const Vec3 a{randomVector3(-10.f, 10.f)}, b{randomVector3(-10.f, 10.f)}, c{randomVector3(-10.f, 10.f)};
+    const Vec3 normal{(b - a).cross(c - a)};
+
+    auto barycentric = [&](const Vec3& p, f32& v, f32& w)
+    {
+        const f32 area{normal.dot(normal)};
+        v = (p - a).cross(c - a).dot(normal) / area;
+        w = (b - a).cross(p - a).dot(normal) / area;
+    };
+
+    Random::sampleTriangle(a, b, c, points, samplingCount, generator);
+
+    TEST("Random::sampleTriangle(const Vec3& a, const Vec3& b, const Vec3& c, ...)",
+         proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             f32 v, w;
+             barycentric(p, v, w);
+             return v >= -1e-3f && w >= -1e-3f && v + w <= 1.f + 1e-3f &&
+                    fabsf((p - a).dot(normal)) <= 1e-3f * normal.length() * (b - a).length();
+         }) == 1.f &&
+         fabsf(proportion(points, samplingCount, [&](const Vec3& p)
+         {
+             f32 v, w;
+             barycentric(p, v, w);
+             return v + w < .5f;
+         }) - .25f) < samplingTolerance);
+
+    // Mesh of two triangles, the second 3 times larger than the first
+    const Vec3 positions[6]{{.0f, .0f, .0f}, {1.f, .0f, .0f}, {.0f, 1.f, .0f}, {.0f, .0f, 1.f}, {3.f, .0f, 1.f}, {.0f, 1.f, 1.f}};
+    const u32  indices[6]  {0u, 1u, 2u, 3u, 4u, 5u};
+
+    const Random::MeshSurfaceSampler mesh{positions, indices, 2u};
+    u32                              triangles[samplingCount];
+    mesh.sample(points, samplingCount, triangles, generator);
+
+    size_t onTriangle{0u}, second{0u};
+    for (size_t i{0u}; i < samplingCount; ++i)
+    {
+        const Vec3& p{points[i]};
+        second += triangles[i];
+
+        // z = 0 on the first triangle, z = 1 on the second
+        onTriangle += (triangles[i] == 0u ? fabsf(p.z) < 1e-5f && p.x + p.y <= 1.f + 1e-5f
+                                          : fabsf(p.z - 1.f) < 1e-5f && p.x / 3.f + p.y <= 1.f + 1e-5f) &&
+                      p.x >= -1e-5f && p.y >= -1e-5f ? 1u : 0u;
+    }
+
+    TEST("Random::MeshSurfaceSampler",
+         f32AreEqual(mesh.totalArea(), 2.f, 1e-5f) && onTriangle == samplingCount &&
+         fabsf(static_cast<f32>(second) / samplingCount - .75f) < samplingTolerance);
+}
+
+
+
+// Smallest distance between two points of the set, by brute force. With wrap, the
+// distances are those of the torus [0, 1)^2.
+template<typename T>
+f32 minDistance(const std::vector<T>& points, const bool wrap = false)
+{
+    f32 res{INFINITY};
+    for (size_t i{0u}; i < points.size(); ++i)
+    {
+        for (size_t j{i + 1u}; j < points.size(); ++j)
+        {
+            f32 sqrDistance{.0f};
+            for (u32 axis{0u}; axis < sizeof(T::e) / sizeof(f32); ++axis)
+            {
+                f32 offset{fabsf(points[i].e[axis] - points[j].e[axis])};
+                if (wrap)
+                    offset = fminf(offset, 1.f - offset);
+                sqrDistance += offset * offset;
+            }
+
+            res = fminf(res, sqrDistance);
+        }
+    }
+
+    return sqrtf(res);
+}
+
+
+// Every elementary interval of 2^a * 2^(m - a) cells holds exactly one of the 2^m points
+bool isNet(const Vec2* points, const u32 m)
+{
+    const u32 count{1u << m};
+
+    for (u32 a{0u}; a <= m; ++a)
+    {
+        std::vector<u32> cells(count, 0u);
+        for (u32 i{0u}; i < count; ++i)
+        {
+            const u32 x{static_cast<u32>(points[i].x * static_cast<f32>(1u << a))};
+            const u32 y{static_cast<u32>(points[i].y * static_cast<f32>(1u << (m - a)))};
+            ++cells[(y << a) + x];
+        }
+
+        for (const u32 cell : cells)
+            if (cell != 1u)
+                return false;
+    }
+
+    return true;
+}
+
+
+// Distance between two values of [0, 1) on the circle
+f32 wrappedDistance(const f64 a, const f64 b)
+{
+    const f64 offset{fabs(a - b)};
+    return static_cast<f32>(fmin(offset, 1. - offset));
+}
+
+
+void testPointSets()
+{
+    fprintf(stderr, "\nRandom point sets unit tests:\n");
+
+    Random::Generator generator{seed};
+
+    // Poisson-disk: the minimum distance holds, and the box has no hole of radius 2 r
+    constexpr f32 radius{.5f};
+
+    const Vec2 min2{randomf32(-10.f, 0.f), randomf32(-10.f, 0.f)};
+    const Vec2 max2{min2.x + 10.f, min2.y + 6.f};
+
+    std::vector<Vec2> disk2{Vec2{-1.f, -1.f}};
+    Random::poissonDisk(min2, max2, radius, disk2, generator);
+
+    bool covered2{disk2.front().x == -1.f && disk2.size() > 1u};
+    for (f32 x{min2.x}; x <= max2.x; x += .25f)
+    {
+        for (f32 y{min2.y}; y <= max2.y; y += .25f)
+        {
+            bool near{false};
+            for (size_t i{1u}; i < disk2.size() && !near; ++i)
+                near = (disk2[i] - Vec2{x, y}).length() < 2.f * radius;
+            covered2 = covered2 && near;
+        }
+    }
+
+    disk2.erase(disk2.begin());
+
+    bool inside2{true};
+    for (const Vec2& p : disk2)
+        inside2 = inside2 && p.x >= min2.x && p.x <= max2.x && p.y >= min2.y && p.y <= max2.y;
+
+    TEST("Random::poissonDisk(const Vec2& min, const Vec2& max, const f32 radius, ...)",
+         minDistance(disk2) >= radius && inside2 && covered2);
+
+    const Vec3 min3{randomVector3(-10.f, 0.f)};
+    const Vec3 max3{min3 + Vec3{4.f, 3.f, 2.f}};
+
+    std::vector<Vec3> disk3;
+    Random::poissonDisk(min3, max3, radius, disk3, generator);
+
+    bool covered3{!disk3.empty()};
+    for (f32 x{min3.x}; x <= max3.x; x += .25f)
+    {
+        for (f32 y{min3.y}; y <= max3.y; y += .25f)
+        {
+            for (f32 z{min3.z}; z <= max3.z; z += .25f)
+            {
+                bool near{false};
+                for (size_t i{0u}; i < disk3.size() && !near; ++i)
+                    near = (disk3[i] - Vec3{x, y, z}).length() < 2.f * radius;
+                covered3 = covered3 && near;
+            }
+        }
+    }
+
+    bool inside3{true};
+    for (const Vec3& p : disk3)
+    {
+        inside3 = inside3 && p.x >= min3.x && p.x <= max3.x && p.y >= min3.y && p.y <= max3.y &&
+                  p.z >= min3.z && p.z <= max3.z;
+    }
+
+    TEST("Random::poissonDisk(const Vec3& min, const Vec3& max, const f32 radius, ...)",
+         minDistance(disk3) >= radius && inside3 && covered3);
+
+    // Blue noise: the minimum distance holds across the seams
+    std::vector<Vec2> tile;
+    Random::blueNoiseTile(.05f, tile, generator);
+
+    bool inTile{tile.size() > 100u};
+    for (const Vec2& p : tile)
+        inTile = inTile && p.x >= .0f && p.x < 1.f && p.y >= .0f && p.y < 1.f;
+
+    TEST("Random::blueNoiseTile(const f32 radius, ...)", minDistance(tile, true) >= .05f * (1.f - 1e-5f) && inTile);
+
+    // Stratified: one point per cell, x varying fastest
+    constexpr u32 nx{7u}, ny{5u}, nz{3u};
+
+    Vec2 strata2[nx * ny];
+    Vec3 strata3[nx * ny * nz];
+    Random::stratified(strata2, nx, ny, generator);
+    Random::stratified(strata3, nx, ny, nz, generator);
+
+    auto inCell = [](const f32 value, const u32 cell, const u32 cells)
+    {
+        return value >= static_cast<f32>(cell) / static_cast<f32>(cells) * (1.f - 1e-6f) &&
+               value <= static_cast<f32>(cell + 1u) / static_cast<f32>(cells) * (1.f + 1e-6f) && value < 1.f;
+    };
+
+    bool stratified{true};
+    for (u32 y{0u}; y < ny; ++y)
+    {
+        for (u32 x{0u}; x < nx; ++x)
+        {
+            const Vec2& p{strata2[y * nx + x]};
+            stratified = stratified && inCell(p.x, x, nx) && inCell(p.y, y, ny);
+
+            for (u32 z{0u}; z < nz; ++z)
+            {
+                const Vec3& q{strata3[(z * ny + y) * nx + x]};
+                stratified = stratified && inCell(q.x, x, nx) && inCell(q.y, y, ny) && inCell(q.z, z, nz);
+            }
+        }
+    }
+
+    TEST("Random::stratified(Vec2* out, ...) and Random::stratified(Vec3* out, ...)", stratified);
+
+    // Halton: radical inverses of the index, and any first gives the same points
+    constexpr size_t count{256u};
+
+    Vec3 halton[count], haltonPart[count];
+    Random::halton(halton, count);
+    Random::halton(haltonPart, count - 100u, 100u);
+
+    bool equal{halton[0].isEqualTo(Vec3{.0f, .0f, .0f}) &&
+               f32AreEqual(halton[1].x, .5f)  && f32AreEqual(halton[1].y, 1.f / 3.f) && f32AreEqual(halton[1].z, .2f) &&
+               f32AreEqual(halton[2].x, .25f) && f32AreEqual(halton[2].y, 2.f / 3.f) && f32AreEqual(halton[2].z, .4f) &&
+               f32AreEqual(halton[11].x, .8125f) && f32AreEqual(halton[11].y, 19.f / 27.f) && f32AreEqual(halton[11].z, 7.f / 25.f)};
+
+    Vec2 halton2[count];
+    Random::halton(halton2, count);
+
+    for (size_t i{0u}; i < count; ++i)
+    {
+        equal = equal && halton2[i].x == halton[i].x && halton2[i].y == halton[i].y &&
+                (i < 100u || memcmp(&haltonPart[i - 100u], &halton[i], sizeof(Vec3)) == 0);
+    }
+
+    TEST("Random::halton()", equal);
+
+    // Sobol: (0, m, 2)-nets, with or without a digital shift, and consistent offsets
+    Vec2 sobol[count], sobolPart[count], shifted[count];
+    Vec3 sobol3[count];
+    Random::sobol(sobol, count);
+    Random::sobol(sobolPart, count - 77u, 77u);
+    Random::sobol(shifted, count, 0u, seed | 1u);
+    Random::sobol(sobol3, count);
+
+    equal = sobol[0].x == .0f && sobol[0].y == .0f && sobol[1].x == .5f && sobol[1].y == .5f &&
+            sobol[2].x == .75f && sobol[2].y == .25f;
+    for (size_t i{0u}; i < count; ++i)
+    {
+        equal = equal && sobol3[i].x == sobol[i].x && sobol3[i].y == sobol[i].y &&
+                (i < 77u || memcmp(&sobolPart[i - 77u], &sobol[i], sizeof(Vec2)) == 0);
+    }
+
+    TEST("Random::sobol()", equal && isNet(sobol, 8u) && isNet(sobol + 128u, 7u) && isNet(shifted, 8u));
+
+    // Roberts: frac(1 / 2 + n alpha)
+    const u32 first{static_cast<u32>(rand() % 100000)};
+
+    Vec2 roberts2[count];
+    Vec3 roberts3[count];
+    Random::roberts(roberts2, count, first);
+    Random::roberts(roberts3, count, first);
+
+    constexpr f64 phi2{1.32471795724474602596}, phi3{1.22074408460575947536};
+
+    equal = true;
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const f64 n{static_cast<f64>(first + i)};
+        equal = equal && wrappedDistance(roberts2[i].x, fmod(.5 + n / phi2, 1.)) < 1e-6f &&
+                wrappedDistance(roberts2[i].y, fmod(.5 + n / (phi2 * phi2), 1.)) < 1e-6f &&
+                wrappedDistance(roberts3[i].x, fmod(.5 + n / phi3, 1.)) < 1e-6f &&
+                wrappedDistance(roberts3[i].y, fmod(.5 + n / (phi3 * phi3), 1.)) < 1e-6f &&
+                wrappedDistance(roberts3[i].z, fmod(.5 + n / (phi3 * phi3 * phi3), 1.)) < 1e-6f &&
+                roberts2[i].x < 1.f && roberts2[i].y < 1.f;
+    }
+
+    TEST("Random::roberts()", equal);
+}
+
+} // End of namespace GPM
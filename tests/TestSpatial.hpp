@@ -0,0 +1,910 @@
+#pragma once
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/BVH.hpp"
+#include "../include/GPM/DynamicAABBTree.hpp"
+#include "../include/GPM/Frustum.hpp"
+#include "../include/GPM/KdTree.hpp"
+#include "../include/GPM/LooseOctree.hpp"
+#include "../include/GPM/SpatialHashGrid.hpp"
+#include "../include/GPM/SweepAndPrune.hpp"
+#include "../include/GPM/Transform.hpp"
+
+namespace GPM
+{
+
+// Objects of the spatial structures tests, in a cube of side spatialRange
+constexpr u32 spatialCount{300u};
+constexpr f32 spatialRange{100.f};
+
+
+AABB randomBox(const f32 maxExtent)
+{
+    return AABB{randomVector3(-spatialRange * .5f, spatialRange * .5f),
+                randomf32(.0f, maxExtent), randomf32(.0f, maxExtent), randomf32(.0f, maxExtent)};
+}
+
+
+// Box with corners on a grid of 1 / 8, exact in floats: the bounds derived from it,
+// fattened or not, and their overlaps are computed without rounding
+f32 randomGridf32(const f32 min, const f32 max)
+{
+    return floorf(randomf32(min, max) * 8.f) / 8.f;
+}
+
+
+AABB randomGridBox(const Vec3& center, const f32 maxExtent)
+{
+    return AABB{center, randomGridf32(.0f, maxExtent), randomGridf32(.0f, maxExtent), randomGridf32(.0f, maxExtent)};
+}
+
+
+Vec3 randomGridVector3(const f32 min, const f32 max)
+{
+    return Vec3{randomGridf32(min, max), randomGridf32(min, max), randomGridf32(min, max)};
+}
+
+
+bool gridBoxesOverlap(const AABB& a, const AABB& b)
+{
+    return fabsf(a.center.x - b.center.x) <= a.extents.x + b.extents.x &&
+           fabsf(a.center.y - b.center.y) <= a.extents.y + b.extents.y &&
+           fabsf(a.center.z - b.center.z) <= a.extents.z + b.extents.z;
+}
+
+
+// Camera somewhere in the cube, looking at another point of it
+Frustum randomFrustum()
+{
+    const Vec3 eye   {randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+    const Vec3 target{randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+
+    return Frustum::perspective(randomf32(.5f, 1.5f), randomf32(.5f, 2.f), randomf32(.1f, 1.f), randomf32(20.f, 80.f),
+                                Transform::lookAt(eye, target).inversedAffine());
+}
+
+
+// Frustum::classify() against the planes of mask one after the other
+EFrustumTest classifyPerPlane(const Frustum& frustum, const AABB& box, u32& mask)
+{
+    u32 straddled{0u};
+    for (u32 p{0u}; p < 6u; ++p)
+    {
+        if (((mask >> p) & 1u) == 0u)
+            continue;
+
+        const Vec4& plane   {frustum.getPlanes()[p]};
+        const f32   distance{plane.x * box.center.x + plane.y * box.center.y + plane.z * box.center.z + plane.w};
+        const f32   radius  {fabsf(plane.x) * box.extents.x + fabsf(plane.y) * box.extents.y + fabsf(plane.z) * box.extents.z};
+
+        if (distance + radius < .0f)
+            return EFrustumTest::Outside;
+
+        straddled |= distance - radius < .0f ? 1u << p : 0u;
+    }
+
+    mask = straddled;
+    return mask == 0u ? EFrustumTest::Inside : EFrustumTest::Intersecting;
+}
+
+
+void testFrustum()
+{
+    fprintf(stderr, "\nFrustum unit tests:\n");
+
+    const Frustum frustum{randomFrustum()};
+
+    // Any incoming mask and cached plane
+    bool equal{true};
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const AABB box{randomBox(10.f)};
+
+        u32 expectedMask{static_cast<u32>(rand()) & Frustum::allPlanes};
+        u32 mask        {expectedMask};
+        u8  lastPlane   {static_cast<u8>(rand() % 6)};
+
+        const EFrustumTest expected{classifyPerPlane(frustum, box, expectedMask)};
+        const EFrustumTest result  {frustum.classify(box, mask, lastPlane)};
+
+        equal = equal && result == expected && (result == EFrustumTest::Outside || mask == expectedMask);
+
+        // The rejecting plane is cached
+        if (result == EFrustumTest::Outside)
+        {
+            u32 plane{1u << lastPlane};
+            equal = equal && classifyPerPlane(frustum, box, plane) == EFrustumTest::Outside;
+        }
+    }
+
+    TEST("Frustum::classify(const AABB& aabb, u32& planeMask, u8& lastPlane)", equal);
+
+    // Batched culling against the scalar tests
+    Vector3SoA       centers, extents;
+    std::vector<f32> radii;
+    std::vector<u32> bits((spatialCount + 31u) / 32u), sphereBits((spatialCount + 31u) / 32u), indices(spatialCount);
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const AABB box{randomBox(10.f)};
+        centers.pushBack(box.center);
+        extents.pushBack(box.extents);
+        radii.push_back(box.extents.x);
+    }
+
+    frustum.cull(centers, extents, bits.data());
+    frustum.cull(centers, radii.data(), sphereBits.data());
+    const size_t visible{frustum.cullIndices(centers, extents, indices.data())};
+
+    size_t count{0u};
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3 center{centers.x()[i], centers.y()[i], centers.z()[i]};
+        const AABB box   {center, extents.x()[i], extents.y()[i], extents.z()[i]};
+        const bool isBoxVisible{((bits[i / 32u] >> (i % 32u)) & 1u) != 0u};
+
+        equal = equal && isBoxVisible == frustum.isVisible(box) &&
+                (((sphereBits[i / 32u] >> (i % 32u)) & 1u) != 0u) == frustum.isVisible(Sphere{radii[i], center});
+
+        if (isBoxVisible)
+            equal = equal && count < visible && indices[count++] == i;
+    }
+
+    TEST("Frustum::cull() and Frustum::cullIndices()", equal && count == visible);
+}
+
+
+// Indices of the boxes that a query accepts, tested one by one
+template<typename F>
+std::vector<u32> bruteForce(const std::vector<AABB>& boxes, F&& accepts)
+{
+    std::vector<u32> indices;
+    for (u32 i{0u}; i < boxes.size(); ++i)
+        if (accepts(boxes[i]))
+            indices.push_back(i);
+
+    return indices;
+}
+
+
+bool sameIndices(std::vector<u32> indices, const std::vector<u32>& expected)
+{
+    std::sort(indices.begin(), indices.end());
+    return indices == expected;
+}
+
+
+void testBVH()
+{
+    fprintf(stderr, "\nBVH unit tests:\n");
+
+    std::vector<AABB> boxes;
+    for (u32 i{0u}; i < spatialCount; ++i)
+        boxes.push_back(randomBox(5.f));
+
+    const BVH bvh{boxes.data(), boxes.size()};
+
+    // Hierarchical culling against every box, twice per frustum for the plane cache
+    std::vector<u32> visible(spatialCount);
+    std::vector<u8>  planeCache(bvh.nodeCount());
+    bool             equal{true};
+
+    for (u32 i{0u}; i < 20u; ++i)
+    {
+        const Frustum frustum{randomFrustum()};
+
+        const std::vector<u32> expected{bruteForce(boxes, [&](const AABB& box)
+        {
+            u32 mask     {Frustum::allPlanes};
+            u8  lastPlane{0u};
+            return frustum.classify(box.center - box.extents, box.center + box.extents, mask, lastPlane) != EFrustumTest::Outside;
+        })};
+
+        visible.resize(spatialCount);
+        visible.resize(bvh.cull(frustum, visible.data()));
+        equal = equal && sameIndices(visible, expected);
+
+        for (u32 frame{0u}; frame < 2u; ++frame)
+        {
+            visible.resize(spatialCount);
+            visible.resize(bvh.cull(frustum, visible.data(), planeCache.data()));
+            equal = equal && sameIndices(visible, expected);
+        }
+    }
+
+    TEST("BVH::cull(const Frustum& frustum, u32* out, u8* planeCache)", equal);
+
+    // Ray queries against the slab test of every box
+    std::vector<u32>    hitIndices;
+    std::vector<BVHHit> hits(spatialCount);
+    equal = true;
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3    origin   {randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+        const Vec3    direction{randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+        const Segment segment  {origin, origin + direction};
+        const f32     tMax     {randomf32(.5f, 2.f)};
+
+        f32 closest{tMax}, t;
+        const std::vector<u32> expected{bruteForce(boxes, [&](const AABB& box)
+        {
+            const bool isHit{BVHQuery::slab(box.center - box.extents, box.center + box.extents, origin,
+                                            BVHQuery::inverse(direction), tMax, t)};
+            closest = isHit && t < closest ? t : closest;
+            return isHit;
+        })};
+
+        BVHHit hit;
+        const bool isHit{bvh.raycast(origin, direction, tMax, hit)};
+        equal = equal && isHit == !expected.empty() && (!isHit || hit.t == closest);
+
+        hits.resize(bvh.raycast(origin, direction, tMax, hits.data(), hits.size()));
+        hitIndices.clear();
+        for (const BVHHit& each : hits)
+            hitIndices.push_back(each.index);
+
+        equal = equal && sameIndices(hitIndices, expected);
+
+        // The segment is the ray with tMax = 1
+        const std::vector<u32> expectedSegment{bruteForce(boxes, [&](const AABB& box)
+        {
+            return BVHQuery::slab(box.center - box.extents, box.center + box.extents, origin,
+                                  BVHQuery::inverse(direction), 1.f, t);
+        })};
+
+        hits.resize(spatialCount);
+        hits.resize(bvh.raycast(segment, hits.data(), hits.size()));
+        hitIndices.clear();
+        for (const BVHHit& each : hits)
+            hitIndices.push_back(each.index);
+
+        equal = equal && sameIndices(hitIndices, expectedSegment) && bvh.raycast(segment, hit) == !expectedSegment.empty();
+        hits.resize(spatialCount);
+    }
+
+    TEST("BVH::raycast()", equal);
+
+    // Overlaps against every box, the count going on past the capacity
+    std::vector<u32> overlapping(spatialCount);
+    equal = true;
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const AABB   query {randomBox(15.f)};
+        const Sphere sphere{randomf32(.0f, 15.f), randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+
+        const Vec3 queryMin{query.center - query.extents}, queryMax{query.center + query.extents};
+
+        const std::vector<u32> expected{bruteForce(boxes, [&](const AABB& box)
+        {
+            const Vec3 min{box.center - box.extents}, max{box.center + box.extents};
+            return min.x <= queryMax.x && max.x >= queryMin.x && min.y <= queryMax.y && max.y >= queryMin.y &&
+                   min.z <= queryMax.z && max.z >= queryMin.z;
+        })};
+
+        const std::vector<u32> expectedSphere{bruteForce(boxes, [&](const AABB& box)
+        {
+            const Vec3 min{box.center - box.extents}, max{box.center + box.extents}, center{sphere.getCenter()};
+            const Vec3 offset{fmaxf(min.x - center.x, .0f) + fmaxf(center.x - max.x, .0f),
+                              fmaxf(min.y - center.y, .0f) + fmaxf(center.y - max.y, .0f),
+                              fmaxf(min.z - center.z, .0f) + fmaxf(center.z - max.z, .0f)};
+            return offset.sqrLength() <= sphere.getRadius() * sphere.getRadius();
+        })};
+
+        overlapping.resize(spatialCount);
+        overlapping.resize(bvh.overlap(query, overlapping.data(), overlapping.size()));
+        equal = equal && sameIndices(overlapping, expected);
+
+        overlapping.resize(spatialCount);
+        overlapping.resize(bvh.overlap(sphere, overlapping.data(), overlapping.size()));
+        equal = equal && sameIndices(overlapping, expectedSphere);
+
+        equal = equal && bvh.overlap(query, overlapping.data(), expected.size() / 2u) == expected.size();
+    }
+
+    TEST("BVH::overlap()", equal);
+
+    // Both builds give the same tree, large enough for the chunked binning and several tasks
+    constexpr u32 parallelCount{70000u};
+
+    std::vector<AABB> manyBoxes;
+    for (u32 i{0u}; i < parallelCount; ++i)
+        manyBoxes.push_back(randomBox(5.f));
+
+    JobSystem jobs{3u};
+    const BVH serial  {manyBoxes.data(), manyBoxes.size()};
+    const BVH parallel{manyBoxes.data(), manyBoxes.size(), jobs};
+
+    TEST("BVH::build(const AABB* bounds, const size_t count, JobSystem& jobs)",
+         serial.nodeCount() == parallel.nodeCount() && parallel.primitiveCount() == parallelCount &&
+         memcmp(serial.nodes(), parallel.nodes(), serial.nodeCount() * sizeof(BVHNode)) == 0 &&
+         memcmp(serial.primitiveIndices(), parallel.primitiveIndices(), parallelCount * sizeof(u32)) == 0);
+}
+
+
+// Pairs of overlapping fat boxes, sorted
+std::vector<DynamicAABBTreePair> bruteForcePairs(const DynamicAABBTree& tree, const std::vector<u32>& proxies)
+{
+    std::vector<DynamicAABBTreePair> pairs;
+    for (size_t i{0u}; i < proxies.size(); ++i)
+        for (size_t j{i + 1u}; j < proxies.size(); ++j)
+            if (gridBoxesOverlap(tree.getFatAABB(proxies[i]), tree.getFatAABB(proxies[j])))
+                pairs.push_back({std::min(proxies[i], proxies[j]), std::max(proxies[i], proxies[j])});
+
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+
+void testDynamicAABBTree()
+{
+    fprintf(stderr, "\nDynamicAABBTree unit tests:\n");
+
+    // Frames of inserts, removals and moves: the reported changes are the
+    // differences between the pairs found by brute force on consecutive frames
+    DynamicAABBTree                  tree{.25f};
+    std::vector<u32>                 proxies;
+    std::vector<AABB>                boxes;
+    std::vector<DynamicAABBTreePair> added, lost, previous, expectedAdded, expectedLost;
+    bool                             equal{true};
+
+    for (u32 frame{0u}; frame < 20u; ++frame)
+    {
+        for (u32 i{0u}; i < (frame == 0u ? spatialCount : 20u); ++i)
+        {
+            boxes.push_back(randomGridBox(randomGridVector3(-spatialRange * .5f, spatialRange * .5f), 5.f));
+            proxies.push_back(tree.insert(boxes.back(), i));
+            equal = equal && tree.getUserData(proxies.back()) == i;
+        }
+
+        for (u32 i{0u}; i < 20u; ++i)
+        {
+            const size_t removed{static_cast<size_t>(rand()) % proxies.size()};
+            tree.remove(proxies[removed]);
+
+            proxies[removed] = proxies.back();
+            boxes[removed]   = boxes.back();
+            proxies.pop_back();
+            boxes.pop_back();
+        }
+
+        for (size_t i{0u}; i < proxies.size(); i += 1u + static_cast<size_t>(rand()) % 3u)
+        {
+            boxes[i] = randomGridBox(boxes[i].center + randomGridVector3(-1.f, 1.f), 5.f);
+            tree.move(proxies[i], boxes[i], randomGridVector3(-2.f, 2.f));
+        }
+
+        tree.updatePairs(added, lost);
+
+        const std::vector<DynamicAABBTreePair> expected{bruteForcePairs(tree, proxies)};
+        expectedAdded.clear();
+        expectedLost.clear();
+        std::set_difference(expected.begin(), expected.end(), previous.begin(), previous.end(), std::back_inserter(expectedAdded));
+        std::set_difference(previous.begin(), previous.end(), expected.begin(), expected.end(), std::back_inserter(expectedLost));
+
+        equal = equal && tree.getPairs() == expected && added == expectedAdded && lost == expectedLost &&
+                tree.getProxyCount() == proxies.size();
+
+        // The fat boxes hold the object boxes
+        for (size_t i{0u}; i < proxies.size(); ++i)
+        {
+            const AABB fat{tree.getFatAABB(proxies[i])};
+            equal = equal && fat.isPointInside(boxes[i].center - boxes[i].extents) && fat.isPointInside(boxes[i].center + boxes[i].extents);
+        }
+
+        previous = expected;
+    }
+
+    TEST("DynamicAABBTree::updatePairs(std::vector<DynamicAABBTreePair>& added, std::vector<DynamicAABBTreePair>& lost)", equal);
+
+    // Queries against the fat boxes, and the early exit
+    std::vector<u32> found;
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const AABB query{randomGridBox(randomGridVector3(-spatialRange * .5f, spatialRange * .5f), 15.f)};
+
+        std::vector<u32> expected;
+        for (const u32 proxy : proxies)
+            if (gridBoxesOverlap(tree.getFatAABB(proxy), query))
+                expected.push_back(proxy);
+
+        std::sort(expected.begin(), expected.end());
+
+        found.clear();
+        tree.query(query, [&](const u32 proxy) { found.push_back(proxy); return true; });
+        equal = equal && sameIndices(found, expected);
+
+        u32 calls{0u};
+        tree.query(query, [&](const u32) { ++calls; return false; });
+        equal = equal && calls == (expected.empty() ? 0u : 1u);
+    }
+
+    TEST("DynamicAABBTree::query(const AABB& aabb, F&& callback)", equal);
+
+    // A fat box stretched by a fast move shrinks back once the proxy stops
+    DynamicAABBTree stopping{.25f};
+    const u32       proxy{stopping.insert(AABB{Vec3::zero(), 1.f, 1.f, 1.f})};
+    const AABB      box  {Vec3{10.f, .0f, .0f}, 1.f, 1.f, 1.f};
+
+    const bool leaves   {stopping.move(proxy, box, Vec3{20.f, .0f, .0f})};
+    const bool stretched{stopping.getFatAABB(proxy).extents.x > 20.f};
+    const bool shrinks  {stopping.move(proxy, box)};
+    const AABB fat      {stopping.getFatAABB(proxy)};
+    const bool fresh    {fat.center == box.center && fat.extents == Vec3(1.25f, 1.25f, 1.25f)};
+
+    TEST("DynamicAABBTree::move(const u32 proxy, const AABB& aabb, const Vec3& displacement)",
+         leaves && stretched && shrinks && fresh && !stopping.move(proxy, box));
+}
+
+
+// Pairs of a broadphase as sorted first << 32 | second keys
+template<typename P>
+std::vector<u64> pairKeys(const std::vector<P>& pairs)
+{
+    std::vector<u64> keys;
+    for (const P& pair : pairs)
+        keys.push_back(static_cast<u64>(pair.first) << 32u | pair.second);
+
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+
+std::vector<u64> bruteForcePairKeys(const std::vector<AABB>& boxes)
+{
+    std::vector<u64> keys;
+    for (u32 i{0u}; i < boxes.size(); ++i)
+        for (u32 j{i + 1u}; j < boxes.size(); ++j)
+            if (gridBoxesOverlap(boxes[i], boxes[j]))
+                keys.push_back(static_cast<u64>(i) << 32u | j);
+
+    return keys;
+}
+
+
+void testSweepAndPrune()
+{
+    fprintf(stderr, "\nSweepAndPrune unit tests:\n");
+
+    // A spread out first frame, coherent moves, then boxes flattened along another axis
+    SweepAndPrune                  sweepAndPrune;
+    std::vector<SweepAndPrunePair> pairs;
+    std::vector<AABB>              boxes;
+    bool                           equal{true}, incremental{false}, axisChanged{false};
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+        boxes.push_back(randomGridBox(randomGridVector3(-spatialRange * .5f, spatialRange * .5f), 5.f));
+
+    for (u32 frame{0u}; frame < 10u; ++frame)
+    {
+        const u32 previousAxis{sweepAndPrune.getAxis()};
+
+        sweepAndPrune.update(boxes.data(), boxes.size(), pairs);
+        equal       = equal && pairKeys(pairs) == bruteForcePairKeys(boxes);
+        incremental = incremental || !sweepAndPrune.wasRebuilt();
+        axisChanged = axisChanged || (frame > 0u && sweepAndPrune.getAxis() != previousAxis);
+
+        for (AABB& box : boxes)
+        {
+            box.center += randomGridVector3(-.5f, .5f);
+            if (frame == 5u)
+                box.center.e[sweepAndPrune.getAxis()] *= .125f;
+        }
+    }
+
+    TEST("SweepAndPrune::update(const AABB* boxes, const size_t count, std::vector<SweepAndPrunePair>& pairs)",
+         equal && incremental && axisChanged);
+
+    // The parallel updates give the same pairs in the same order, over several
+    // chunks of the radix sort and the sweep, then after an incremental sort.
+    // The boxes spread along x, sparse enough for small moves to keep the order.
+    constexpr u32 parallelCount{40000u};
+    constexpr f32 parallelRange{4000.f};
+
+    std::vector<AABB> manyBoxes;
+    for (u32 i{0u}; i < parallelCount; ++i)
+    {
+        const Vec3 center{randomGridf32(-parallelRange * .5f, parallelRange * .5f), randomGridf32(-20.f, 20.f), randomGridf32(-20.f, 20.f)};
+        manyBoxes.push_back(randomGridBox(center, 2.f));
+    }
+
+    JobSystem                      jobs{3u};
+    SweepAndPrune                  serial, parallel;
+    std::vector<SweepAndPrunePair> parallelPairs;
+    equal = true;
+
+    for (u32 frame{0u}; frame < 2u; ++frame)
+    {
+        serial.update(manyBoxes.data(), manyBoxes.size(), pairs);
+        parallel.update(manyBoxes.data(), manyBoxes.size(), parallelPairs, jobs);
+
+        equal = equal && pairs.size() == parallelPairs.size() && serial.wasRebuilt() == parallel.wasRebuilt() &&
+                memcmp(serial.getOrder(), parallel.getOrder(), parallelCount * sizeof(u32)) == 0;
+
+        for (size_t i{0u}; equal && i < pairs.size(); ++i)
+            equal = pairs[i].first == parallelPairs[i].first && pairs[i].second == parallelPairs[i].second;
+
+        for (AABB& box : manyBoxes)
+            box.center += randomGridVector3(-.125f, .125f);
+    }
+
+    TEST("SweepAndPrune::update(const AABB* boxes, const size_t count, std::vector<SweepAndPrunePair>& pairs, JobSystem& jobs)",
+         equal && !parallel.wasRebuilt());
+}
+
+
+// Points or spheres within radius of center, by linear scan
+std::vector<u32> linearRadius(const std::vector<Sphere>& spheres, const Vec3& center, const f32 radius, const bool usesRadii)
+{
+    std::vector<u32> indices;
+    for (u32 i{0u}; i < spheres.size(); ++i)
+    {
+        const f32 distance{usesRadii ? radius + spheres[i].getRadius() : radius};
+        if (center.sqrDistanceTo(spheres[i].getCenter()) <= distance * distance)
+            indices.push_back(i);
+    }
+
+    return indices;
+}
+
+
+// The k nearest, nearest first: the distances are those of the sorted linear
+// scan, and each index goes with its distance
+bool nearestMatch(const std::vector<f32>& sqrDistances, const u32* indices, const f32* foundSqrDistances,
+                  const size_t count, const size_t expectedCount, const std::vector<Vec3>& points, const Vec3& center)
+{
+    bool equal{count == expectedCount};
+    for (size_t i{0u}; equal && i < count; ++i)
+        equal = foundSqrDistances[i] == sqrDistances[i] && center.sqrDistanceTo(points[indices[i]]) == sqrDistances[i];
+
+    return equal;
+}
+
+
+void testSpatialHashGrid()
+{
+    fprintf(stderr, "\nSpatialHashGrid unit tests:\n");
+
+    // A few objects far beyond the clamped cells, which share the border cells
+    std::vector<Vec3>   points;
+    std::vector<Sphere> spheres;
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3 point{i % 100u == 0u ? randomVector3(-1e7f, 1e7f) : randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+        points.push_back(point);
+        spheres.push_back(Sphere{randomf32(.0f, 5.f), point});
+    }
+
+    SpatialHashGrid  grid{5.f}, sphereGrid{5.f};
+    std::vector<u32> found(spatialCount);
+    std::vector<f32> sqrDistances(spatialCount);
+    bool             equal{true};
+
+    grid.build(points.data(), points.size());
+    sphereGrid.build(spheres.data(), spheres.size());
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3 center{randomVector3(-spatialRange * .6f, spatialRange * .6f)};
+        const f32  radius{randomf32(.0f, i % 10u == 0u ? 80.f : 12.f)};
+
+        const std::vector<u32> expected      {linearRadius(spheres, center, radius, false)};
+        const std::vector<u32> expectedSphere{linearRadius(spheres, center, radius, true)};
+
+        found.resize(spatialCount);
+        found.resize(grid.queryRadius(center, radius, found.data(), found.size()));
+        equal = equal && sameIndices(found, expected);
+
+        found.resize(spatialCount);
+        found.resize(sphereGrid.queryRadius(center, radius, found.data(), found.size()));
+        equal = equal && sameIndices(found, expectedSphere);
+
+        equal = equal && grid.queryRadius(center, radius, found.data(), expected.size() / 2u) == expected.size();
+    }
+
+    TEST("SpatialHashGrid::queryRadius(const Vec3& center, const f32 radius, u32* out, const size_t capacity)", equal);
+
+    // k nearest, some of them beyond maxDistance, against the sorted distances
+    found.resize(spatialCount);
+    std::vector<f32> expected;
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3 center     {randomVector3(-spatialRange * .6f, spatialRange * .6f)};
+        const u32  k          {1u + static_cast<u32>(rand()) % 20u};
+        const f32  maxDistance{i % 4u == 0u ? randomf32(1.f, 10.f) : std::numeric_limits<f32>::infinity()};
+
+        expected.clear();
+        for (const Vec3& point : points)
+            if (center.sqrDistanceTo(point) <= maxDistance * maxDistance)
+                expected.push_back(center.sqrDistanceTo(point));
+
+        std::sort(expected.begin(), expected.end());
+
+        const size_t expectedCount{std::min<size_t>(k, expected.size())};
+        const size_t count        {grid.queryNearest(center, k, found.data(), sqrDistances.data(), maxDistance)};
+        equal = equal && nearestMatch(expected, found.data(), sqrDistances.data(), count, expectedCount, points, center);
+
+        // Sphere grids search the centers
+        const size_t sphereCount{sphereGrid.queryNearest(center, k, found.data(), sqrDistances.data(), maxDistance)};
+        equal = equal && nearestMatch(expected, found.data(), sqrDistances.data(), sphereCount, expectedCount, points, center);
+    }
+
+    TEST("SpatialHashGrid::queryNearest(const Vec3& center, const u32 k, u32* out, f32* sqrDistances, const f32 maxDistance)", equal);
+}
+
+
+// Queries of a LooseOctree against every live object, identified by its user data
+bool looseOctreeMatches(const LooseOctree& octree, const std::vector<AABB>& bounds, const std::vector<u32>& live)
+{
+    std::vector<u32>            found(bounds.size());
+    std::vector<LooseOctreeHit> hits(bounds.size());
+    bool                        equal{true};
+
+    auto expect = [&](auto&& accepts)
+    {
+        std::vector<u32> expected;
+        for (const u32 userData : live)
+            if (accepts(bounds[userData].center - bounds[userData].extents, bounds[userData].center + bounds[userData].extents))
+                expected.push_back(userData);
+
+        std::sort(expected.begin(), expected.end());
+        return expected;
+    };
+
+    for (u32 i{0u}; i < 50u; ++i)
+    {
+        const Frustum frustum{randomFrustum()};
+        found.resize(bounds.size());
+        found.resize(octree.cull(frustum, found.data(), found.size()));
+        equal = equal && sameIndices(found, expect([&](const Vec3& min, const Vec3& max)
+        {
+            u32 mask     {Frustum::allPlanes};
+            u8  lastPlane{0u};
+            return frustum.classify(min, max, mask, lastPlane) != EFrustumTest::Outside;
+        }));
+
+        const AABB query   {randomGridBox(randomGridVector3(-spatialRange * .5f, spatialRange * .5f), 15.f)};
+        const Vec3 queryMin{query.center - query.extents}, queryMax{query.center + query.extents};
+        found.resize(bounds.size());
+        found.resize(octree.overlap(query, found.data(), found.size()));
+        equal = equal && sameIndices(found, expect([&](const Vec3& min, const Vec3& max)
+        {
+            return min.x <= queryMax.x && max.x >= queryMin.x && min.y <= queryMax.y && max.y >= queryMin.y &&
+                   min.z <= queryMax.z && max.z >= queryMin.z;
+        }));
+
+        const Sphere sphere{randomGridf32(.0f, 15.f), randomGridVector3(-spatialRange * .5f, spatialRange * .5f)};
+        found.resize(bounds.size());
+        found.resize(octree.overlap(sphere, found.data(), found.size()));
+        equal = equal && sameIndices(found, expect([&](const Vec3& min, const Vec3& max)
+        {
+            const Vec3 center{sphere.getCenter()};
+            const Vec3 offset{fmaxf(min.x - center.x, .0f) + fmaxf(center.x - max.x, .0f),
+                              fmaxf(min.y - center.y, .0f) + fmaxf(center.y - max.y, .0f),
+                              fmaxf(min.z - center.z, .0f) + fmaxf(center.z - max.z, .0f)};
+            return offset.sqrLength() <= sphere.getRadius() * sphere.getRadius();
+        }));
+
+        const Vec3 origin   {randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+        const Vec3 direction{randomVector3(-spatialRange * .5f, spatialRange * .5f)};
+        const Vec3 inverse  {1.f / direction.x, 1.f / direction.y, 1.f / direction.z};
+        const f32  tMax     {randomf32(.5f, 2.f)};
+
+        f32 closest{tMax}, t;
+        const std::vector<u32> expected{expect([&](const Vec3& min, const Vec3& max)
+        {
+            const bool isHit{LooseOctreeDetail::slab(min, max, origin, inverse, tMax, t)};
+            closest = isHit && t < closest ? t : closest;
+            return isHit;
+        })};
+
+        hits.resize(bounds.size());
+        hits.resize(octree.raycast(origin, direction, tMax, hits.data(), hits.size()));
+        found.clear();
+        for (const LooseOctreeHit& hit : hits)
+            found.push_back(hit.userData);
+
+        LooseOctreeHit hit;
+        const bool     isHit{octree.raycast(origin, direction, tMax, hit)};
+        equal = equal && sameIndices(found, expected) && isHit == !expected.empty() && (!isHit || hit.t == closest);
+    }
+
+    return equal;
+}
+
+
+void testLooseOctree()
+{
+    fprintf(stderr, "\nLooseOctree unit tests:\n");
+
+    // Rounds of relocations, small and large, removals and insertions, half of
+    // the objects as spheres. Bounds are indexed by user data.
+    LooseOctree       octree{Vec3::zero(), 64.f, 6u};
+    std::vector<AABB> bounds;
+    std::vector<u32>  live, handles;
+    bool              equal{true}, relocated{false}, kept{false};
+
+    auto insert = [&]()
+    {
+        const u32 userData{static_cast<u32>(bounds.size())};
+        const f32 radius  {randomGridf32(.0f, 5.f)};
+        const Vec3 center {randomGridVector3(-spatialRange * .5f, spatialRange * .5f)};
+
+        bounds.push_back(userData % 2u == 0u ? randomGridBox(center, 5.f) : AABB{center, radius, radius, radius});
+        handles.push_back(userData % 2u == 0u ? octree.insert(bounds.back(), userData) : octree.insert(Sphere{radius, center}, userData));
+        live.push_back(userData);
+    };
+
+    for (u32 i{0u}; i < spatialCount; ++i)
+        insert();
+
+    for (u32 round{0u}; round < 4u; ++round)
+    {
+        equal = equal && looseOctreeMatches(octree, bounds, live) && octree.getObjectCount() == live.size();
+
+        for (size_t i{0u}; i < live.size(); i += 3u)
+        {
+            AABB&      box   {bounds[live[i]]};
+            const Vec3 moved {box.center + randomGridVector3(i % 2u == 0u ? -1.f : -20.f, i % 2u == 0u ? 1.f : 20.f)};
+            const Vec3 center{fminf(fmaxf(moved.x, -50.f), 50.f), fminf(fmaxf(moved.y, -50.f), 50.f), fminf(fmaxf(moved.z, -50.f), 50.f)};
+
+            box = AABB{center, box.extents.x, box.extents.y, box.extents.z};
+            const bool changedNode{octree.relocate(handles[i], box)};
+            relocated = relocated || changedNode;
+            kept      = kept || !changedNode;
+        }
+
+        for (u32 i{0u}; i < 20u; ++i)
+        {
+            const size_t removed{static_cast<size_t>(rand()) % live.size()};
+            octree.remove(handles[removed]);
+
+            live[removed]    = live.back();
+            handles[removed] = handles.back();
+            live.pop_back();
+            handles.pop_back();
+        }
+
+        for (u32 i{0u}; i < 20u; ++i)
+            insert();
+    }
+
+    for (size_t i{0u}; i < live.size(); ++i)
+        equal = equal && octree.getUserData(handles[i]) == live[i];
+
+    TEST("LooseOctree queries after insert(), relocate() and remove()", equal && relocated && kept);
+}
+
+
+// Exact and approximate k nearest, and radius searches of a KdTree against
+// the sorted distances of a linear scan
+template<typename T>
+bool kdTreeMatches(const std::vector<T>& points, const std::vector<T>& queries)
+{
+    const KdTree<T> tree{points.data(), points.size()};
+
+    std::vector<u32> found(points.size());
+    std::vector<f32> sqrDistances(points.size()), expected;
+    bool             equal{true};
+
+    for (u32 i{0u}; i < queries.size(); ++i)
+    {
+        const T&  query      {queries[i]};
+        const u32 k          {1u + static_cast<u32>(rand()) % 20u};
+        const f32 epsilon    {randomf32(.1f, 1.f)};
+        const f32 maxDistance{i % 4u == 0u ? randomf32(1.f, 10.f) : std::numeric_limits<f32>::infinity()};
+
+        expected.clear();
+        for (const T& point : points)
+            if (KdTreeDetail::sqrDistance(query, point) <= maxDistance * maxDistance)
+                expected.push_back(KdTreeDetail::sqrDistance(query, point));
+
+        std::sort(expected.begin(), expected.end());
+        const size_t expectedCount{std::min<size_t>(k, expected.size())};
+
+        // Each index goes with its distance, nearest first
+        auto consistent = [&](const size_t count)
+        {
+            bool isConsistent{count == expectedCount};
+            for (size_t j{0u}; isConsistent && j < count; ++j)
+            {
+                isConsistent = KdTreeDetail::sqrDistance(query, points[found[j]]) == sqrDistances[j] &&
+                               (j == 0u || sqrDistances[j - 1u] <= sqrDistances[j]);
+            }
+
+            return isConsistent;
+        };
+
+        size_t count{tree.nearest(query, k, found.data(), sqrDistances.data(), .0f, maxDistance)};
+        equal = equal && consistent(count);
+        for (size_t j{0u}; equal && j < count; ++j)
+            equal = sqrDistances[j] == expected[j];
+
+        // The j-th approximate neighbour is at most 1 + epsilon times farther than the exact one
+        const f32 bound{(1.f + epsilon) * (1.f + epsilon) * (1.f + 1e-6f)};
+        count = tree.nearest(query, k, found.data(), sqrDistances.data(), epsilon, maxDistance);
+        equal = equal && consistent(count);
+        for (size_t j{0u}; equal && j < count; ++j)
+            equal = sqrDistances[j] <= expected[j] * bound;
+
+        // Radius searches
+        const f32 radius{randomf32(.0f, i % 10u == 0u ? 80.f : 12.f)};
+        std::vector<u32> inRadius;
+        for (u32 j{0u}; j < points.size(); ++j)
+            if (KdTreeDetail::sqrDistance(query, points[j]) <= radius * radius)
+                inRadius.push_back(j);
+
+        found.resize(points.size());
+        found.resize(tree.radius(query, radius, found.data(), found.size()));
+        equal = equal && sameIndices(found, inRadius) && tree.radius(query, radius, found.data(), inRadius.size() / 2u) == inRadius.size();
+        found.resize(points.size());
+    }
+
+    return equal;
+}
+
+
+void testKdTree()
+{
+    fprintf(stderr, "\nKdTree unit tests:\n");
+
+    // Clustered points, with duplicates, where ties and empty splits happen
+    std::vector<Vec3> points, queries;
+    std::vector<Vec2> points2, queries2;
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const Vec3 point{i % 10u == 0u && i > 0u ? points[i / 2u] : randomVector3(-spatialRange * .5f, spatialRange * .5f) * (i % 3u == 0u ? .05f : 1.f)};
+        points.push_back(point);
+        points2.push_back(Vec2{point.x, point.y});
+
+        queries.push_back(randomVector3(-spatialRange * .6f, spatialRange * .6f));
+        queries2.push_back(Vec2{queries.back().x, queries.back().y});
+    }
+
+    TEST("KdTree3::nearest() and KdTree3::radius()", kdTreeMatches(points, queries));
+    TEST("KdTree2::nearest() and KdTree2::radius()", kdTreeMatches(points2, queries2));
+
+    // Parallel build and batched queries against the serial ones
+    constexpr u32 parallelCount{20000u};
+    constexpr u32 k            {8u};
+
+    std::vector<Vec3> manyPoints;
+    for (u32 i{0u}; i < parallelCount; ++i)
+        manyPoints.push_back(randomVector3(-spatialRange * .5f, spatialRange * .5f));
+
+    JobSystem    jobs{3u};
+    const KdTree3 serial  {manyPoints.data(), manyPoints.size()};
+    const KdTree3 parallel{manyPoints.data(), manyPoints.size(), jobs};
+
+    std::vector<u32> batched(spatialCount * k), counts(spatialCount), found(k);
+    std::vector<f32> batchedDistances(spatialCount * k), sqrDistances(k);
+
+    parallel.nearest(queries.data(), queries.size(), k, batched.data(), batchedDistances.data(), counts.data(), jobs);
+
+    bool equal{memcmp(serial.indices(), parallel.indices(), parallelCount * sizeof(u32)) == 0};
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const size_t count{serial.nearest(queries[i], k, found.data(), sqrDistances.data())};
+        equal = equal && counts[i] == count &&
+                memcmp(batched.data() + i * k, found.data(), count * sizeof(u32)) == 0 &&
+                memcmp(batchedDistances.data() + i * k, sqrDistances.data(), count * sizeof(f32)) == 0;
+    }
+
+    parallel.radius(queries.data(), queries.size(), 5.f, batched.data(), k, counts.data(), jobs);
+    for (u32 i{0u}; i < spatialCount; ++i)
+    {
+        const size_t count{serial.radius(queries[i], 5.f, found.data(), k)};
+        equal = equal && counts[i] == count && memcmp(batched.data() + i * k, found.data(), std::min<size_t>(count, k) * sizeof(u32)) == 0;
+    }
+
+    TEST("KdTree::build(const T* points, const size_t count, JobSystem& jobs) and batched queries", equal);
+}
+
+} // End of namespace GPM
@@ -0,0 +1,348 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "TestingTools.hpp"
+#include "../include/GPM/TransformHierarchy.hpp"
+#include "../include/GPM/JobSystem.hpp"
+#include "../include/GPM/Animation.hpp"
+#include "../include/GPM/conversion.hpp"
+#include "../include/GPM/Calc.hpp"
+
+namespace GPM
+{
+
+SplitTransform randomSplitTransform()
+{
+    return {Quat::angleAxis(randomf32(-3.f, 3.f), randomVector3(-1.f, 1.f).normalized()),
+            randomVector3(-10.f, 10.f),
+            Vec3{randomf32(.5f, 1.5f), randomf32(.5f, 1.5f), randomf32(.5f, 1.5f)}};
+}
+
+
+// Reference world matrices, computed in handle order: every parent handle is
+// smaller than the handles of its children
+std::vector<Mat4> bruteForceWorlds(const std::vector<SplitTransform>& locals,
+                                   const std::vector<u32>&            parents)
+{
+    std::vector<Mat4> worlds(locals.size());
+
+    for (size_t i{0u}; i < locals.size(); ++i)
+    {
+        const Mat4 local{toTransform(locals[i]).model};
+        worlds[i] = parents[i] == TransformHierarchy::invalidNode ? local : worlds[parents[i]].multiplyAffine(local);
+    }
+
+    return worlds;
+}
+
+
+bool hierarchyMatches(const TransformHierarchy& hierarchy, const std::vector<Mat4>& expected,
+                      const std::vector<u32>& parents)
+{
+    if (hierarchy.size() != expected.size())
+        return false;
+
+    for (u32 node{0u}; node < expected.size(); ++node)
+    {
+        if (hierarchy.getParent(node) != parents[node] ||
+            hierarchy.handleAt(hierarchy.storageIndex(node)) != node ||
+            !hierarchy.getWorld(node).isEqualTo(expected[node], 1e-3f))
+            return false;
+    }
+
+    return true;
+}
+
+
+// Breadth-first storage: the roots come first, then the parent index of the
+// other nodes never decreases, which also makes the children of a node contiguous
+bool isBreadthFirst(const TransformHierarchy& hierarchy)
+{
+    u32  previousParent{0u};
+    bool hasChildren   {false};
+
+    for (u32 i{0u}; i < hierarchy.size(); ++i)
+    {
+        const u32 parent{hierarchy.getParent(hierarchy.handleAt(i))};
+
+        if (parent == TransformHierarchy::invalidNode)
+        {
+            if (hasChildren)
+                return false;
+            continue;
+        }
+        hasChildren = true;
+
+        const u32 parentIndex{hierarchy.storageIndex(parent)};
+        if (parentIndex >= i || parentIndex < previousParent)
+            return false;
+
+        previousParent = parentIndex;
+    }
+
+    return true;
+}
+
+
+void testTransformHierarchy()
+{
+    fprintf(stderr, "\nTransformHierarchy's unit tests:\n");
+
+    constexpr u32 count{2000u};
+    constexpr u32 rootCount{5u};
+
+    std::vector<SplitTransform> locals (count);
+    std::vector<u32>            parents(count);
+    TransformHierarchy          hierarchy;
+
+    for (u32 i{0u}; i < count; ++i)
+    {
+        locals [i] = randomSplitTransform();
+        parents[i] = i < rootCount ? TransformHierarchy::invalidNode : static_cast<u32>(rand()) % i;
+        hierarchy.addNode(locals[i], parents[i]);
+    }
+    hierarchy.updateWorld();
+
+    TEST("TransformHierarchy::updateWorld() after addNode()",
+         hierarchyMatches(hierarchy, bruteForceWorlds(locals, parents), parents) && isBreadthFirst(hierarchy));
+
+    // Incremental updates: a few moving nodes per frame, some of them in the
+    // subtree of another one, and nodes marked dirty without changing
+    bool incremental{true};
+    for (u32 frame{0u}; frame < 10u; ++frame)
+    {
+        for (u32 moved{0u}; moved < 20u; ++moved)
+        {
+            const u32 node{static_cast<u32>(rand()) % count};
+            locals[node] = randomSplitTransform();
+            hierarchy.setLocal(node, locals[node]);
+        }
+        hierarchy.markDirty(static_cast<u32>(rand()) % count);
+
+        hierarchy.updateWorld();
+        incremental = incremental && hierarchyMatches(hierarchy, bruteForceWorlds(locals, parents), parents);
+    }
+
+    TEST("TransformHierarchy::updateWorld() of the dirty subtrees only", incremental);
+
+    // Reparenting under a node of smaller handle or to a root keeps the
+    // reference order valid, and moves whole subtrees
+    for (u32 moved{0u}; moved < 50u; ++moved)
+    {
+        const u32 node{rootCount + static_cast<u32>(rand()) % (count - rootCount)};
+        parents[node] = moved % 10u == 0u ? TransformHierarchy::invalidNode : static_cast<u32>(rand()) % node;
+        hierarchy.setParent(node, parents[node]);
+    }
+    locals[0u] = randomSplitTransform();
+    hierarchy.setLocal(0u, locals[0u]);
+    hierarchy.updateWorld();
+
+    TEST("TransformHierarchy::setParent() and the breadth-first order",
+         hierarchyMatches(hierarchy, bruteForceWorlds(locals, parents), parents) && isBreadthFirst(hierarchy));
+}
+
+
+// updateWorld(JobSystem&) against updateWorld() on a forest wide enough to
+// split its levels across the workers
+void testTransformHierarchyParallel()
+{
+    fprintf(stderr, "\nTransformHierarchy's parallel update unit tests:\n");
+
+    constexpr u32 count{40000u};
+
+    JobSystem          jobs{3u};
+    TransformHierarchy serial;
+    for (u32 i{0u}; i < count; ++i)
+        serial.addNode(randomSplitTransform(), i < 16u ? TransformHierarchy::invalidNode : static_cast<u32>(rand()) % i);
+
+    TransformHierarchy parallel{serial};
+    serial.updateWorld();
+    parallel.updateWorld(jobs);
+
+    const size_t bytes{count * sizeof(Mat4)};
+    bool         same {memcmp(serial.worldMatrices(), parallel.worldMatrices(), bytes) == 0};
+
+    for (u32 frame{0u}; frame < 5u; ++frame)
+    {
+        for (u32 moved{0u}; moved < 2000u; ++moved)
+        {
+            const u32            node {static_cast<u32>(rand()) % count};
+            const SplitTransform local{randomSplitTransform()};
+
+            serial  .setLocal(node, local);
+            parallel.setLocal(node, local);
+        }
+
+        serial.updateWorld();
+        parallel.updateWorld(jobs);
+        same = same && memcmp(serial.worldMatrices(), parallel.worldMatrices(), bytes) == 0;
+    }
+
+    TEST("TransformHierarchy::updateWorld(JobSystem& jobs) and TransformHierarchy::updateWorld()", same);
+}
+
+
+// Track sampled at time, checked against the segment found by a linear scan
+template<typename T>
+bool sampleMatches(const KeyframeTrack<T>& track, const f32 time, const T& sample, const u32 cursor)
+{
+    const f32* times{track.times()};
+    const T*   values{track.values()};
+    const u32  last {static_cast<u32>(track.size()) - 1u};
+
+    if (time <= times[0u])
+        return cursor == 0u && sample == values[0u];
+    if (time >= times[last])
+        return cursor == last && sample == values[last];
+
+    u32 key{0u};
+    while (times[key + 1u] <= time)
+        ++key;
+
+    const T expected{Keyframe::interpolate(values[key], values[key + 1u], (time - times[key]) / (times[key + 1u] - times[key]))};
+    return cursor == key && sample.isEqualTo(expected, 1e-5f);
+}
+
+
+void testAnimation()
+{
+    fprintf(stderr, "\nAnimation's unit tests:\n");
+
+    // Keys added out of order every fifth time, to go through the insertion
+    constexpr u32 keyCount{40u};
+    Vec3Track     positions;
+    QuatTrack     rotations;
+    f32           keyTimes[keyCount];
+    keyTimes[0u] = randomf32(-1.f, 0.f);
+    for (u32 i{1u}; i < keyCount; ++i)
+        keyTimes[i] = keyTimes[i - 1u] + randomf32(.01f, .2f);
+
+    for (u32 i{0u}; i < keyCount; ++i)
+    {
+        const u32 key{i % 5u == 4u ? i - 1u : (i % 5u == 3u ? i + 1u : i)};
+        positions.addKey(keyTimes[key], randomVector3(-10.f, 10.f));
+        rotations.addKey(keyTimes[key], Quat::angleAxis(randomf32(-PI, PI), randomVector3(-1.f, 1.f)));
+    }
+
+    bool sorted{positions.size() == keyCount && rotations.size() == keyCount};
+    for (u32 i{0u}; i < keyCount; ++i)
+        sorted = sorted && positions.times()[i] == keyTimes[i] && rotations.times()[i] == keyTimes[i];
+
+    TEST("KeyframeTrack::addKey(const f32 time, const T& value)", sorted);
+
+    // Forward playback at several speeds, seeks, loops and backward playback,
+    // past both ends of the track
+    const f32 start{positions.startTime()}, end{positions.endTime()};
+    u32       positionCursor{0u}, rotationCursor{0u};
+    bool      cursorMatch{true};
+    f32       time{start - .1f};
+    for (u32 frame{0u}; frame < 2000u; ++frame)
+    {
+        const u32 action{static_cast<u32>(rand()) % 100u};
+        if (action < 2u)
+            time = randomf32(start - .2f, end + .2f);
+        else if (action < 10u)
+            time -= randomf32(0.f, .05f);
+        else
+            time += randomf32(0.f, action < 50u ? .01f : .3f);
+
+        if (time > end + .2f)
+            time = start - .1f + (time - end - .2f);
+
+        const Vec3 position{positions.sample(time, positionCursor)};
+        const Quat rotation{rotations.sample(time, rotationCursor)};
+
+        cursorMatch = cursorMatch && sampleMatches(positions, time, position, positionCursor) &&
+                                     sampleMatches(rotations, time, rotation, rotationCursor) &&
+                                     position.isEqualTo(positions.sample(time), 1e-5f) &&
+                                     rotation.isEqualTo(rotations.sample(time), 1e-6f);
+    }
+
+    TEST("KeyframeTrack::sample(const f32 time, u32& cursor) and KeyframeTrack::sample(const f32 time)", cursorMatch);
+
+    // Poses of a few bones, one more than a whole number of registers
+    constexpr size_t boneCount{3u * GPM_SIMD_WIDTH + 1u};
+    SplitTransform   a[boneCount], b[boneCount], blended[boneCount];
+    for (size_t i{0u}; i < boneCount; ++i)
+    {
+        a[i] = randomSplitTransform();
+        b[i] = randomSplitTransform();
+    }
+
+    const f32 t{randomf32(0.f, 1.f)};
+    blendPoses(a, b, t, blended, boneCount);
+
+    SplitTransform inPlace[boneCount];
+    std::copy(a, a + boneCount, inPlace);
+    blendPoses(inPlace, b, t, inPlace, boneCount);
+
+    bool blendMatch{true};
+    for (size_t i{0u}; i < boneCount; ++i)
+    {
+        const Quat from    {a[i].rotation.dot(b[i].rotation) < 0.f ? -a[i].rotation : a[i].rotation};
+        const Quat rotation{(from * (1.f - t) + b[i].rotation * t).normalized()};
+
+        blendMatch = blendMatch && blended[i].rotation.isEqualTo(rotation, 1e-6f) &&
+                                   blended[i].position.isEqualTo(a[i].position.lerp(b[i].position, t), 1e-5f) &&
+                                   blended[i].scale.isEqualTo(a[i].scale.lerp(b[i].scale, t), 1e-6f) &&
+                                   inPlace[i].rotation == blended[i].rotation &&
+                                   inPlace[i].position == blended[i].position && inPlace[i].scale == blended[i].scale;
+    }
+
+    TEST("blendPoses(const SplitTransform* a, const SplitTransform* b, const f32 t, SplitTransform* out, const size_t count)", blendMatch);
+
+    // Batched matrices against toTransform(), then down a hierarchy
+    u32  parents[boneCount];
+    Mat4 locals[boneCount], models[boneCount], inverseBinds[boneCount], palette[boneCount];
+    for (size_t i{0u}; i < boneCount; ++i)
+    {
+        parents[i]      = i == 0u ? invalidBone : static_cast<u32>(rand()) % static_cast<u32>(i);
+        inverseBinds[i] = toTransform(randomSplitTransform()).model;
+    }
+
+    localMatrices(blended, locals, boneCount);
+    modelMatrices(blended, parents, models, boneCount);
+    skinningPalette(models, inverseBinds, palette, boneCount);
+
+    bool localMatch{true}, modelMatch{true};
+    Mat4 expected[boneCount]{};
+    for (size_t i{0u}; i < boneCount; ++i)
+    {
+        const Mat4 local{toTransform(blended[i]).model};
+        expected[i] = parents[i] == invalidBone ? local : expected[parents[i]].multiplyAffine(local);
+
+        localMatch = localMatch && locals[i].isEqualTo(local, 1e-5f);
+        modelMatch = modelMatch && models[i].isEqualTo(expected[i], 1e-3f) &&
+                                   palette[i].isEqualTo(expected[i].multiplyAffine(inverseBinds[i]), 1e-2f);
+    }
+
+    TEST("localMatrices(const SplitTransform* pose, Mat4* out, const size_t count)", localMatch);
+    TEST("modelMatrices(...) and skinningPalette(...)", modelMatch);
+
+    // Whole bone tracks, with empty tracks left to the identity
+    TransformTrack tracks[2];
+    tracks[0].position = positions;
+    tracks[0].rotation = rotations;
+    tracks[1].scale    = positions;
+
+    u32            cursors[6]{};
+    SplitTransform pose[2];
+    bool           tracksMatch{true};
+    for (f32 sampleTime{start - .1f}; sampleTime < end + .1f; sampleTime += .05f)
+    {
+        sampleTracks(tracks, sampleTime, pose, cursors, 2u);
+
+        tracksMatch = tracksMatch && pose[0].position.isEqualTo(positions.sample(sampleTime), 1e-5f) &&
+                                     pose[0].rotation.isEqualTo(rotations.sample(sampleTime), 1e-6f) &&
+                                     pose[1].scale.isEqualTo(positions.sample(sampleTime), 1e-5f) &&
+                                     pose[0].scale == Vec3::one() && pose[1].rotation == Quat::identity() &&
+                                     pose[1].position == Vec3::zero();
+    }
+
+    TEST("sampleTracks(const TransformTrack* tracks, const f32 time, SplitTransform* pose, u32* cursors, const size_t count)", tracksMatch);
+}
+
+} // End of namespace GPM
@@ -2,6 +2,8 @@
 
 #include "TestingTools.hpp"
 #include "../include/GPM/Vector3.hpp"
+#include "../include/GPM/Vector3SoA.hpp"
+#include "../include/GPM/Vector.hpp"
 #include "../include/GPM/Calc.hpp"
 
 namespace GPM
@@ -72,12 +74,158 @@ void testVec3SpecificMethods()
            val.lerp(normalized, .5f).isEqualTo((val * .5f) + (normalized * .5f)));
 }
 
+// Every kernel of the stream against the Vector3 method of the same name, on
+// a count that leaves a scalar tail after the SIMD body
+void testVec3SoA()
+{
+    fprintf(stderr, "\nVector3SoA's unit tests:\n");
+
+    constexpr size_t count{5u * GPM_SIMD_WIDTH + 3u};
+
+    Vec3 a[count], b[count];
+    for (size_t i{0u}; i < count; ++i)
+    {
+        a[i] = randomVector3(-10.f, 10.f);
+        b[i] = randomVector3(-10.f, 10.f);
+    }
+    const Vec3 point{randomVector3(-10.f, 10.f)};
+    const f32  t    {randomf32(0.f, 1.f)};
+
+    const Vec3SoA sa{a, count};
+    Vec3SoA       sb;
+    for (size_t i{0u}; i < count; ++i)
+        sb.pushBack(b[i]);
+
+    const Vec3SoA copy{sa};
+    Vec3          copied[count];
+    copy.copyTo(copied);
+
+    bool storage{sa.size() == count && sb.size() == count && sa.capacity() % GPM_SIMD_WIDTH == 0u};
+    for (size_t i{0u}; i < count; ++i)
+        storage = storage && sa.get(i).isEqualTo(a[i], 0.f) && sb.get(i).isEqualTo(b[i], 0.f) &&
+                             copied[i].isEqualTo(a[i], 0.f);
+
+    f32 sqrLengths[count], lengths[count], dots[count], dotsVec3[count],
+        sqrDistances[count], distances[count], distancesVec3[count];
+    sa.sqrLength(sqrLengths);
+    sa.length(lengths);
+    sa.dot(sb, dots);
+    sa.dot(point, dotsVec3);
+    sa.sqrDistanceTo(sb, sqrDistances);
+    sa.distanceTo(sb, distances);
+    sa.distanceTo(point, distancesVec3);
+
+    Vec3SoA crosses, lerps, normalized{sa};
+    sa.cross(sb, crosses);
+    sa.lerp(sb, t, lerps);
+    normalized.normalize();
+
+    bool lengthMatch{true}, dotMatch{true}, distanceMatch{true}, crossMatch{true},
+         lerpMatch{crosses.size() == count && lerps.size() == count}, normalizeMatch{true};
+    for (size_t i{0u}; i < count; ++i)
+    {
+        lengthMatch    = lengthMatch && f32AreEqual(sqrLengths[i], a[i].sqrLength(), 1e-3f) &&
+                                        f32AreEqual(lengths[i], a[i].length(), 1e-4f);
+        dotMatch       = dotMatch && f32AreEqual(dots[i], a[i].dot(b[i]), 1e-3f) &&
+                                     f32AreEqual(dotsVec3[i], a[i].dot(point), 1e-3f);
+        distanceMatch  = distanceMatch && f32AreEqual(sqrDistances[i], a[i].sqrDistanceTo(b[i]), 1e-3f) &&
+                                          f32AreEqual(distances[i], a[i].distanceTo(b[i]), 1e-4f) &&
+                                          f32AreEqual(distancesVec3[i], a[i].distanceTo(point), 1e-4f);
+        crossMatch     = crossMatch && crosses.get(i).isEqualTo(a[i].cross(b[i]), 1e-3f);
+        lerpMatch      = lerpMatch && lerps.get(i).isEqualTo(a[i].lerp(b[i], t), 1e-5f);
+        normalizeMatch = normalizeMatch && normalized.get(i).isEqualTo(a[i].normalized(), 1e-6f);
+    }
+
+    TEST("Vector3SoA storage, pushBack() and copyTo()", storage);
+    TEST("Vector3SoA::sqrLength() and Vector3SoA::length()", lengthMatch);
+    TEST("Vector3SoA::dot()", dotMatch);
+    TEST("Vector3SoA::sqrDistanceTo() and Vector3SoA::distanceTo()", distanceMatch);
+    TEST("Vector3SoA::cross()", crossMatch);
+    TEST("Vector3SoA::lerp()", lerpMatch);
+    TEST("Vector3SoA::normalize()", normalizeMatch);
+
+    // Batched transforms, both layouts, against Matrix4 * Vector4
+    const Mat4 m{randomMatrix4(-10.f, 10.f)};
+    Vec3       points[count], directions[count];
+    Vec3SoA    soaPoints, soaDirections{sa};
+    transformPoints(m, a, points, count);
+    transformDirections(m, a, directions, count);
+    transformPoints(m, sa, soaPoints);
+    transformDirections(m, soaDirections, soaDirections);
+
+    bool pointMatch{soaPoints.size() == count}, directionMatch{soaDirections.size() == count};
+    for (size_t i{0u}; i < count; ++i)
+    {
+        const Vec3 point3    {(m * Vec4{a[i], 1.f}).xyz};
+        const Vec3 direction3{(m * Vec4{a[i], .0f}).xyz};
+
+        pointMatch     = pointMatch && points[i].isEqualTo(point3, 1e-3f) &&
+                                       soaPoints.get(i).isEqualTo(point3, 1e-3f);
+        directionMatch = directionMatch && directions[i].isEqualTo(direction3, 1e-3f) &&
+                                           soaDirections.get(i).isEqualTo(direction3, 1e-3f);
+    }
+
+    TEST("transformPoints(const Matrix4& m, ...) on arrays and on Vector3SoA", pointMatch);
+    TEST("transformDirections(const Matrix4& m, ...) on arrays and on Vector3SoA, in place", directionMatch);
+}
+
+
+// Vector<N, T> in double precision against Vector3 and Vector4, and in integers
+void testVecTemplate()
+{
+    fprintf(stderr, "\nVector<N, T>'s unit tests:\n");
+
+    static_assert(std::is_same_v<Vec<3u, f32>, Vector3> && std::is_same_v<Vector<4u, f32>, Vec4>,
+                  "The single-precision vectors are specialisations of Vector<N, T>");
+    static_assert(Vec3i{1, 2, 3}.dot(Vec3i{4, 5, 6}) == 32, "Vector<N, T> is usable in constant expressions");
+
+    bool  vec3Match{true}, vec4Match{true};
+    const auto closeTo = [](const f64 a, const f32 b) { return std::abs(a - static_cast<f64>(b)) <= 1e-5 * (1. + std::abs(a)); };
+    const auto closeToVec3 = [&](const Vec3d& a, const Vec3& b) { return closeTo(a.x, b.x) && closeTo(a.y, b.y) && closeTo(a.z, b.z); };
+
+    for (u32 i{0u}; i < 100u; ++i)
+    {
+        const Vec3  a {randomVector3(-10.f, 10.f)}, b {randomVector3(-10.f, 10.f)};
+        const Vec3d da{a.x, a.y, a.z},              db{b.x, b.y, b.z};
+        const f32   t {randomf32(0.f, 1.f)};
+
+        vec3Match = vec3Match && closeTo(da.dot(db), a.dot(b)) && closeToVec3(da.cross(db), a.cross(b)) &&
+                                 closeTo(da.length(), a.length()) && closeTo(da.distanceTo(db), a.distanceTo(b)) &&
+                                 closeToVec3(da.normalized(), a.normalized()) &&
+                                 closeToVec3(da.lerp(db, t), a.lerp(b, t)) &&
+                                 closeToVec3(da - db * 2., a - b * 2.f) && closeToVec3(-da / 4., -a / 4.f) &&
+                                 da.cast<f32>() == a;
+
+        const Vec4  c {a, randomf32(-10.f, 10.f)};
+        const Vec4d dc{da.x, da.y, da.z, c.w};
+        vec4Match = vec4Match && closeTo(dc.dot(dc), c.dot(c)) && closeTo(dc.length(), c.length()) &&
+                                 closeTo(dc.x, c.x) && closeTo(dc.y, c.y) && closeTo(dc.z, c.z) && dc.w == c.w;
+    }
+
+    TEST("Vector<3u, f64> against Vector3", vec3Match);
+    TEST("Vector<4u, f64> against Vector4", vec4Match);
+
+    Vec4d v{1., 2., 3., 4.};
+    v.z    = 5.;
+    v.e[1] = 6.;
+    TEST("Vector<N, T>'s x, y, z and w alias e",
+         v.e[2] == 5. && v[2] == 5. && v.y == 6. && v.x == 1. && v.w == 4.);
+
+    const Vec3i i1{7, -8, 9}, i2{-2, 3, 4};
+    TEST("Vector<N, s32>'s integer arithmetic",
+         i1.cross(i2) == Vec3i(-59, -46, 5) && i1.dot(i2) == -2 && i1 / 2 == Vec3i(3, -4, 4) &&
+         i1.abs() == Vec3i(7, 8, 9) && Vec3i::min(i1, i2) == Vec3i(-2, -8, 4) &&
+         Vec3i::max(i1, i2) == Vec3i(7, 3, 9) && (i1 * i2).sqrLength() == 196 + 576 + 1296);
+}
+
 
 void testVec3()
 {
     testVec3Constructors();
     testVec3StaticMethods();
     testVec3SpecificMethods();
+    testVec3SoA();
+    testVecTemplate();
 }
 
 }
\ No newline at end of file
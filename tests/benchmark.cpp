@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+#include "../include/GPM/BVH.hpp"
+#include "../include/GPM/Noise.hpp"
+#include "../include/GPM/SpatialHashGrid.hpp"
+
+// Timings of the batched kernels, best of several runs.
+// Build it like the tests, execute from the root of the repository:
+// - clang++: clang++ -W -Wall -Werror -O3 -ffp-contract=fast -march=native -fno-reciprocal-math -fno-trapping-math -fno-math-errno -fno-signed-zeros -msse2 tests/benchmark.cpp -o benchmark.exe
+// - g++: g++ -W -Wall -Werror -O3 -ffp-contract=fast -march=native -freciprocal-math -fno-trapping-math -fno-math-errno -fno-signed-zeros -msse2 tests/benchmark.cpp -o benchmark.exe
+
+namespace GPM
+{
+
+template<typename F>
+f64 bestTime(const u32 runs, F&& function)
+{
+    f64 best{1e30};
+    for (u32 run{0u}; run < runs; ++run)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        function();
+        const std::chrono::duration<f64, std::milli> elapsed{std::chrono::steady_clock::now() - start};
+
+        best = elapsed.count() < best ? elapsed.count() : best;
+    }
+
+    return best;
+}
+
+
+// A 512 x 512 heightmap tile, with one octave and with 5
+template<ENoise N>
+void benchmarkNoiseTile(const char* name)
+{
+    constexpr u32 size{512u};
+
+    std::vector<f32> tile(size * size);
+    Fractal          octave{ELayering::FBm, 1u, 1.f / 64.f};
+    Fractal          fBm   {ELayering::FBm, 5u, 1.f / 64.f};
+
+    const f64 single {bestTime(20u, [&]() { Noise::fractalGrid<N>(Vec2{.0f, .0f}, Vec2{1.f, 1.f}, size, size, tile.data(), octave, 7u); })};
+    const f64 layered{bestTime(10u, [&]() { Noise::fractalGrid<N>(Vec2{.0f, .0f}, Vec2{1.f, 1.f}, size, size, tile.data(), fBm, 7u); })};
+
+    printf("Noise::fractalGrid<%s>, 512 x 512: %6.2f ms, 5 octaves: %6.2f ms\n", name, single, layered);
+}
+
+
+// Serial and parallel builds over a million boxes scattered in a cube. Without
+// several hardware threads, the global job system has no workers and both are serial.
+void benchmarkBVHBuild()
+{
+    constexpr u32 count{1u << 20u};
+
+    std::vector<AABB> boxes;
+    boxes.reserve(count);
+    for (u32 i{0u}; i < count; ++i)
+    {
+        const Vec3 center{static_cast<f32>(rand() % 10000) * .1f, static_cast<f32>(rand() % 10000) * .1f,
+                          static_cast<f32>(rand() % 10000) * .1f};
+        boxes.push_back(AABB{center, .5f, .5f, .5f});
+    }
+
+    JobSystem& jobs{JobSystem::global()};
+    BVH        bvh;
+
+    const f64 serial  {bestTime(3u, [&]() { bvh.build(boxes.data(), boxes.size()); })};
+    const f64 parallel{bestTime(3u, [&]() { bvh.build(boxes.data(), boxes.size(), jobs); })};
+
+    printf("BVH::build, %u boxes: %6.2f ms, %u workers: %6.2f ms\n", count, serial, jobs.workerCount(), parallel);
+}
+
+
+
+// Every agent of a crowd of 100k queries its neighbours within the cell size, then its 8 nearest
+void benchmarkSpatialHashGrid()
+{
+    constexpr u32 count{100000u}, k{8u};
+
+    std::vector<Vec3> agents;
+    agents.reserve(count);
+    for (u32 i{0u}; i < count; ++i)
+        agents.push_back(Vec3{static_cast<f32>(rand() % 100000) * .01f, static_cast<f32>(rand() % 100) * .01f,
+                              static_cast<f32>(rand() % 100000) * .01f});
+
+    SpatialHashGrid  grid{2.f};
+    std::vector<u32> neighbours(count);
+    f32              sqrDistances[k];
+    size_t           found{0u};
+
+    const f64 build {bestTime(5u, [&]() { grid.build(agents.data(), agents.size()); })};
+    const f64 radius{bestTime(5u, [&]()
+    {
+        for (const Vec3& agent : agents)
+            found += grid.queryRadius(agent, 2.f, neighbours.data(), neighbours.size());
+    })};
+    const f64 nearest{bestTime(5u, [&]()
+    {
+        for (const Vec3& agent : agents)
+            found += grid.queryNearest(agent, k, neighbours.data(), sqrDistances);
+    })};
+
+    printf("SpatialHashGrid, %u agents: build %6.2f ms, radius %6.2f ms, %u nearest %6.2f ms (%zu found)\n",
+           count, build, radius, k, nearest, found);
+}
+
+} // End of namespace GPM
+
+
+int main()
+{
+    printf("SIMD width: %u\n", GPM_SIMD_WIDTH);
+
+    // GPM::Noise
+    GPM::benchmarkNoiseTile<GPM::ENoise::Value>("Value");
+    GPM::benchmarkNoiseTile<GPM::ENoise::Perlin>("Perlin");
+    GPM::benchmarkNoiseTile<GPM::ENoise::Simplex>("Simplex");
+
+    // GPM::BVH
+    GPM::benchmarkBVHBuild();
+
+    // GPM::SpatialHashGrid
+    GPM::benchmarkSpatialHashGrid();
+
+    return 0;
+}
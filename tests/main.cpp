@@ -8,6 +8,13 @@
 #include "TestVec3.hpp"
 #include "TestQuat.hpp"
 #include "TestMat4.hpp"
+#include "TestTransform.hpp"
+#include "TestQuantization.hpp"
+#include "TestCalc.hpp"
+#include "TestRandom.hpp"
+#include "TestSampling.hpp"
+#include "TestNoise.hpp"
+#include "TestSpatial.hpp"
 #include "../include/GPM/Random.hpp"
 
 // Test compilation line, execute from the root of the repository:
@@ -22,14 +29,62 @@ int main()
     GPM::testVec3Constructors();
     GPM::testVec3StaticMethods();
     GPM::testVec3SpecificMethods();
+    GPM::testVec3SoA();
+    GPM::testVecTemplate();
 
     // GPM::Quaternion
     GPM::testQuatStaticMethods();
     GPM::testQuatMethods();
     GPM::testQuatOperators();
+    GPM::testQuatBatched();
 
     // GPM::Matrix4
     GPM::testMat4Methods();
+    GPM::testMatTemplate();
+
+    // GPM::TransformHierarchy
+    GPM::testTransformHierarchy();
+    GPM::testTransformHierarchyParallel();
+
+    // GPM::Animation
+    GPM::testAnimation();
+
+    // GPM::Quantize
+    GPM::testQuantization();
+
+    // GPM::Math
+    GPM::testMath();
+
+    // GPM::Random
+    GPM::testRandomGenerator();
+    GPM::testRandomPhilox();
+    GPM::testDistributions();
+    GPM::testShapeSampling();
+    GPM::testPointSets();
+
+    // GPM::Noise
+    GPM::testNoise();
+
+    // GPM::Frustum
+    GPM::testFrustum();
+
+    // GPM::BVH
+    GPM::testBVH();
+
+    // GPM::DynamicAABBTree
+    GPM::testDynamicAABBTree();
+
+    // GPM::SweepAndPrune
+    GPM::testSweepAndPrune();
+
+    // GPM::SpatialHashGrid
+    GPM::testSpatialHashGrid();
+
+    // GPM::LooseOctree
+    GPM::testLooseOctree();
+
+    // GPM::KdTree
+    GPM::testKdTree();
 
     GPM::endTests();
 